@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/obj-cpp.dir/src/async_file.cpp.o"
+  "CMakeFiles/obj-cpp.dir/src/async_file.cpp.o.d"
+  "CMakeFiles/obj-cpp.dir/src/batch.cpp.o"
+  "CMakeFiles/obj-cpp.dir/src/batch.cpp.o.d"
+  "CMakeFiles/obj-cpp.dir/src/cache.cpp.o"
+  "CMakeFiles/obj-cpp.dir/src/cache.cpp.o.d"
+  "CMakeFiles/obj-cpp.dir/src/float_parser.cpp.o"
+  "CMakeFiles/obj-cpp.dir/src/float_parser.cpp.o.d"
+  "CMakeFiles/obj-cpp.dir/src/lexer.cpp.o"
+  "CMakeFiles/obj-cpp.dir/src/lexer.cpp.o.d"
+  "CMakeFiles/obj-cpp.dir/src/mapped_file.cpp.o"
+  "CMakeFiles/obj-cpp.dir/src/mapped_file.cpp.o.d"
+  "CMakeFiles/obj-cpp.dir/src/mtl_parser.cpp.o"
+  "CMakeFiles/obj-cpp.dir/src/mtl_parser.cpp.o.d"
+  "CMakeFiles/obj-cpp.dir/src/normals.cpp.o"
+  "CMakeFiles/obj-cpp.dir/src/normals.cpp.o.d"
+  "CMakeFiles/obj-cpp.dir/src/obj_parser.cpp.o"
+  "CMakeFiles/obj-cpp.dir/src/obj_parser.cpp.o.d"
+  "CMakeFiles/obj-cpp.dir/src/obj_writer.cpp.o"
+  "CMakeFiles/obj-cpp.dir/src/obj_writer.cpp.o.d"
+  "CMakeFiles/obj-cpp.dir/src/tangents.cpp.o"
+  "CMakeFiles/obj-cpp.dir/src/tangents.cpp.o.d"
+  "CMakeFiles/obj-cpp.dir/src/thread_pool.cpp.o"
+  "CMakeFiles/obj-cpp.dir/src/thread_pool.cpp.o.d"
+  "CMakeFiles/obj-cpp.dir/src/vertex_cache.cpp.o"
+  "CMakeFiles/obj-cpp.dir/src/vertex_cache.cpp.o.d"
+  "CMakeFiles/obj-cpp.dir/src/welding.cpp.o"
+  "CMakeFiles/obj-cpp.dir/src/welding.cpp.o.d"
+  "libobj-cpp.a"
+  "libobj-cpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/obj-cpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
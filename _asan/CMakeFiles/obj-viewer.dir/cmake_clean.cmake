@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/obj-viewer.dir/src/viewer.cpp.o"
+  "CMakeFiles/obj-viewer.dir/src/viewer.cpp.o.d"
+  "obj-viewer"
+  "obj-viewer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/obj-viewer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
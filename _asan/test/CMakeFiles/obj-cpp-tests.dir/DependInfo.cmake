@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/async_file_tests.cpp" "test/CMakeFiles/obj-cpp-tests.dir/async_file_tests.cpp.o" "gcc" "test/CMakeFiles/obj-cpp-tests.dir/async_file_tests.cpp.o.d"
+  "/root/repo/test/batch_tests.cpp" "test/CMakeFiles/obj-cpp-tests.dir/batch_tests.cpp.o" "gcc" "test/CMakeFiles/obj-cpp-tests.dir/batch_tests.cpp.o.d"
+  "/root/repo/test/float_parser_tests.cpp" "test/CMakeFiles/obj-cpp-tests.dir/float_parser_tests.cpp.o" "gcc" "test/CMakeFiles/obj-cpp-tests.dir/float_parser_tests.cpp.o.d"
+  "/root/repo/test/fuzzy_tests.cpp" "test/CMakeFiles/obj-cpp-tests.dir/fuzzy_tests.cpp.o" "gcc" "test/CMakeFiles/obj-cpp-tests.dir/fuzzy_tests.cpp.o.d"
+  "/root/repo/test/lexer_tests.cpp" "test/CMakeFiles/obj-cpp-tests.dir/lexer_tests.cpp.o" "gcc" "test/CMakeFiles/obj-cpp-tests.dir/lexer_tests.cpp.o.d"
+  "/root/repo/test/mtl_parser_tests.cpp" "test/CMakeFiles/obj-cpp-tests.dir/mtl_parser_tests.cpp.o" "gcc" "test/CMakeFiles/obj-cpp-tests.dir/mtl_parser_tests.cpp.o.d"
+  "/root/repo/test/normals_tests.cpp" "test/CMakeFiles/obj-cpp-tests.dir/normals_tests.cpp.o" "gcc" "test/CMakeFiles/obj-cpp-tests.dir/normals_tests.cpp.o.d"
+  "/root/repo/test/obj_parser_tests.cpp" "test/CMakeFiles/obj-cpp-tests.dir/obj_parser_tests.cpp.o" "gcc" "test/CMakeFiles/obj-cpp-tests.dir/obj_parser_tests.cpp.o.d"
+  "/root/repo/test/obj_writer_tests.cpp" "test/CMakeFiles/obj-cpp-tests.dir/obj_writer_tests.cpp.o" "gcc" "test/CMakeFiles/obj-cpp-tests.dir/obj_writer_tests.cpp.o.d"
+  "/root/repo/test/reader_tests.cpp" "test/CMakeFiles/obj-cpp-tests.dir/reader_tests.cpp.o" "gcc" "test/CMakeFiles/obj-cpp-tests.dir/reader_tests.cpp.o.d"
+  "/root/repo/test/tangents_tests.cpp" "test/CMakeFiles/obj-cpp-tests.dir/tangents_tests.cpp.o" "gcc" "test/CMakeFiles/obj-cpp-tests.dir/tangents_tests.cpp.o.d"
+  "/root/repo/test/vertex_cache_tests.cpp" "test/CMakeFiles/obj-cpp-tests.dir/vertex_cache_tests.cpp.o" "gcc" "test/CMakeFiles/obj-cpp-tests.dir/vertex_cache_tests.cpp.o.d"
+  "/root/repo/test/welding_tests.cpp" "test/CMakeFiles/obj-cpp-tests.dir/welding_tests.cpp.o" "gcc" "test/CMakeFiles/obj-cpp-tests.dir/welding_tests.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan/CMakeFiles/obj-cpp.dir/DependInfo.cmake"
+  "/root/repo/_asan/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_asan/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_asan/test/obj-cpp-tests[1]_tests.cmake")
+  include("/root/repo/_asan/test/obj-cpp-tests[1]_tests.cmake")
+else()
+  add_test(obj-cpp-tests_NOT_BUILT obj-cpp-tests_NOT_BUILT)
+endif()
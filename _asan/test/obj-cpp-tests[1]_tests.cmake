@@ -0,0 +1,131 @@
+add_test([=[FloatParser.FixedAndScientific]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=FloatParser.FixedAndScientific]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FloatParser.FixedAndScientific]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FloatParser.RandomDecimals]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=FloatParser.RandomDecimals]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FloatParser.RandomDecimals]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FloatParser.RoundTrip]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=FloatParser.RoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FloatParser.RoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Lexer.SingleLineComment]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Lexer.SingleLineComment]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Lexer.SingleLineComment]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Lexer.Token]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Lexer.Token]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Lexer.Token]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Lexer.AlphabetCoverage]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Lexer.AlphabetCoverage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Lexer.AlphabetCoverage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Lexer.MultiLineComments]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Lexer.MultiLineComments]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Lexer.MultiLineComments]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Lexer.MultiComments]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Lexer.MultiComments]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Lexer.MultiComments]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Lexer.SingleLineAlphanum]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Lexer.SingleLineAlphanum]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Lexer.SingleLineAlphanum]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Lexer.MultiLineAlphanum]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Lexer.MultiLineAlphanum]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Lexer.MultiLineAlphanum]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Lexer.MixedTokenTypes]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Lexer.MixedTokenTypes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Lexer.MixedTokenTypes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Lexer.VectorizedMatchesScalar]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Lexer.VectorizedMatchesScalar]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Lexer.VectorizedMatchesScalar]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Lexer.BoundedSource]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Lexer.BoundedSource]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Lexer.BoundedSource]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Lexer.TagTable]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Lexer.TagTable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Lexer.TagTable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjParser.Comments]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjParser.Comments]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjParser.Comments]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjParser.Vertices]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjParser.Vertices]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjParser.Vertices]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjParser.ScientificNotation]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjParser.ScientificNotation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjParser.ScientificNotation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjParser.Normals]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjParser.Normals]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjParser.Normals]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjParser.Texcoords]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjParser.Texcoords]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjParser.Texcoords]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjParser.Triplets]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjParser.Triplets]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjParser.Triplets]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjParser.Faces]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjParser.Faces]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjParser.Faces]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjParser.FastPathMatchesTokenPath]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjParser.FastPathMatchesTokenPath]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjParser.FastPathMatchesTokenPath]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjParser.Polygons]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjParser.Polygons]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjParser.Polygons]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjParser.RelativeIndices]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjParser.RelativeIndices]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjParser.RelativeIndices]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjParser.ZeroBasedIndices]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjParser.ZeroBasedIndices]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjParser.ZeroBasedIndices]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjParser.ValueAndIndexTypes]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjParser.ValueAndIndexTypes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjParser.ValueAndIndexTypes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjParser.ParallelMatchesSerial]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjParser.ParallelMatchesSerial]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjParser.ParallelMatchesSerial]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjParser.Prescan]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjParser.Prescan]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjParser.Prescan]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjParser.StructureOfArrays]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjParser.StructureOfArrays]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjParser.StructureOfArrays]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjParser.Visitor]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjParser.Visitor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjParser.Visitor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjParser.StreamParser]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjParser.StreamParser]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjParser.StreamParser]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjParser.TryParse]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjParser.TryParse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjParser.TryParse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjParser.RecoveredParallelMatchesSerial]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjParser.RecoveredParallelMatchesSerial]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjParser.RecoveredParallelMatchesSerial]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjParser.SmoothingGroups]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjParser.SmoothingGroups]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjParser.SmoothingGroups]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjParser.MemoryResource]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjParser.MemoryResource]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjParser.MemoryResource]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjParser.ReusedStorage]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjParser.ReusedStorage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjParser.ReusedStorage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjWriter.Format]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjWriter.Format]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjWriter.Format]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjWriter.Unwritable]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjWriter.Unwritable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjWriter.Unwritable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjWriter.RoundTrip]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjWriter.RoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjWriter.RoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjWriter.Materials]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=ObjWriter.Materials]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjWriter.Materials]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Reader.AssetFiles]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Reader.AssetFiles]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Reader.AssetFiles]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Reader.MappedFile]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Reader.MappedFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Reader.MappedFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Reader.MappedFilePageMultiple]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Reader.MappedFilePageMultiple]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Reader.MappedFilePageMultiple]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Reader.Cache]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Reader.Cache]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Reader.Cache]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MtlParser.SingleMaterial]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=MtlParser.SingleMaterial]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MtlParser.SingleMaterial]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MtlParser.MultiMaterial]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=MtlParser.MultiMaterial]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MtlParser.MultiMaterial]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MtlParser.StringTerminator]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=MtlParser.StringTerminator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MtlParser.StringTerminator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MtlParser.MemoryResource]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=MtlParser.MemoryResource]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MtlParser.MemoryResource]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Normals.SmoothingGroups]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Normals.SmoothingGroups]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Normals.SmoothingGroups]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Normals.ParallelMatchesSerial]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Normals.ParallelMatchesSerial]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Normals.ParallelMatchesSerial]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AsyncFile.ReadAhead]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=AsyncFile.ReadAhead]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AsyncFile.ReadAhead]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AsyncFile.Parse]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=AsyncFile.Parse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AsyncFile.Parse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WorkStealingPool.RunAll]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=WorkStealingPool.RunAll]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WorkStealingPool.RunAll]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Batch.LoadBatch]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Batch.LoadBatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Batch.LoadBatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Fuzzy.mtl_file_only]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Fuzzy.mtl_file_only]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Fuzzy.mtl_file_only]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Fuzzy.obj_file_only]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Fuzzy.obj_file_only]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Fuzzy.obj_file_only]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Tangents.Quad]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Tangents.Quad]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Tangents.Quad]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Tangents.CurvedSurface]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Tangents.CurvedSurface]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Tangents.CurvedSurface]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Welding.SharedTriplets]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Welding.SharedTriplets]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Welding.SharedTriplets]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Welding.ParallelMatchesSerial]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Welding.ParallelMatchesSerial]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Welding.ParallelMatchesSerial]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Welding.NearbyPositions]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Welding.NearbyPositions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Welding.NearbyPositions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Welding.NoisyGrid]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=Welding.NoisyGrid]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Welding.NoisyGrid]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VertexCache.Analyze]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=VertexCache.Analyze]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VertexCache.Analyze]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VertexCache.OptimizeFaces]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=VertexCache.OptimizeFaces]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VertexCache.OptimizeFaces]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VertexCache.OptimizeFetch]=]  /root/repo/_asan/test/obj-cpp-tests [==[--gtest_filter=VertexCache.OptimizeFetch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VertexCache.OptimizeFetch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/assets SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  obj-cpp-tests_TESTS FloatParser.FixedAndScientific FloatParser.RandomDecimals FloatParser.RoundTrip Lexer.SingleLineComment Lexer.Token Lexer.AlphabetCoverage Lexer.MultiLineComments Lexer.MultiComments Lexer.SingleLineAlphanum Lexer.MultiLineAlphanum Lexer.MixedTokenTypes Lexer.VectorizedMatchesScalar Lexer.BoundedSource Lexer.TagTable ObjParser.Comments ObjParser.Vertices ObjParser.ScientificNotation ObjParser.Normals ObjParser.Texcoords ObjParser.Triplets ObjParser.Faces ObjParser.FastPathMatchesTokenPath ObjParser.Polygons ObjParser.RelativeIndices ObjParser.ZeroBasedIndices ObjParser.ValueAndIndexTypes ObjParser.ParallelMatchesSerial ObjParser.Prescan ObjParser.StructureOfArrays ObjParser.Visitor ObjParser.StreamParser ObjParser.TryParse ObjParser.RecoveredParallelMatchesSerial ObjParser.SmoothingGroups ObjParser.MemoryResource ObjParser.ReusedStorage ObjWriter.Format ObjWriter.Unwritable ObjWriter.RoundTrip ObjWriter.Materials Reader.AssetFiles Reader.MappedFile Reader.MappedFilePageMultiple Reader.Cache MtlParser.SingleMaterial MtlParser.MultiMaterial MtlParser.StringTerminator MtlParser.MemoryResource Normals.SmoothingGroups Normals.ParallelMatchesSerial AsyncFile.ReadAhead AsyncFile.Parse WorkStealingPool.RunAll Batch.LoadBatch Fuzzy.mtl_file_only Fuzzy.obj_file_only Tangents.Quad Tangents.CurvedSurface Welding.SharedTriplets Welding.ParallelMatchesSerial Welding.NearbyPositions Welding.NoisyGrid VertexCache.Analyze VertexCache.OptimizeFaces VertexCache.OptimizeFetch)
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/async_file.cpp" "CMakeFiles/obj-cpp.dir/src/async_file.cpp.o" "gcc" "CMakeFiles/obj-cpp.dir/src/async_file.cpp.o.d"
+  "/root/repo/src/batch.cpp" "CMakeFiles/obj-cpp.dir/src/batch.cpp.o" "gcc" "CMakeFiles/obj-cpp.dir/src/batch.cpp.o.d"
+  "/root/repo/src/cache.cpp" "CMakeFiles/obj-cpp.dir/src/cache.cpp.o" "gcc" "CMakeFiles/obj-cpp.dir/src/cache.cpp.o.d"
+  "/root/repo/src/float_parser.cpp" "CMakeFiles/obj-cpp.dir/src/float_parser.cpp.o" "gcc" "CMakeFiles/obj-cpp.dir/src/float_parser.cpp.o.d"
+  "/root/repo/src/lexer.cpp" "CMakeFiles/obj-cpp.dir/src/lexer.cpp.o" "gcc" "CMakeFiles/obj-cpp.dir/src/lexer.cpp.o.d"
+  "/root/repo/src/mapped_file.cpp" "CMakeFiles/obj-cpp.dir/src/mapped_file.cpp.o" "gcc" "CMakeFiles/obj-cpp.dir/src/mapped_file.cpp.o.d"
+  "/root/repo/src/mtl_parser.cpp" "CMakeFiles/obj-cpp.dir/src/mtl_parser.cpp.o" "gcc" "CMakeFiles/obj-cpp.dir/src/mtl_parser.cpp.o.d"
+  "/root/repo/src/normals.cpp" "CMakeFiles/obj-cpp.dir/src/normals.cpp.o" "gcc" "CMakeFiles/obj-cpp.dir/src/normals.cpp.o.d"
+  "/root/repo/src/obj_parser.cpp" "CMakeFiles/obj-cpp.dir/src/obj_parser.cpp.o" "gcc" "CMakeFiles/obj-cpp.dir/src/obj_parser.cpp.o.d"
+  "/root/repo/src/obj_writer.cpp" "CMakeFiles/obj-cpp.dir/src/obj_writer.cpp.o" "gcc" "CMakeFiles/obj-cpp.dir/src/obj_writer.cpp.o.d"
+  "/root/repo/src/tangents.cpp" "CMakeFiles/obj-cpp.dir/src/tangents.cpp.o" "gcc" "CMakeFiles/obj-cpp.dir/src/tangents.cpp.o.d"
+  "/root/repo/src/thread_pool.cpp" "CMakeFiles/obj-cpp.dir/src/thread_pool.cpp.o" "gcc" "CMakeFiles/obj-cpp.dir/src/thread_pool.cpp.o.d"
+  "/root/repo/src/vertex_cache.cpp" "CMakeFiles/obj-cpp.dir/src/vertex_cache.cpp.o" "gcc" "CMakeFiles/obj-cpp.dir/src/vertex_cache.cpp.o.d"
+  "/root/repo/src/welding.cpp" "CMakeFiles/obj-cpp.dir/src/welding.cpp.o" "gcc" "CMakeFiles/obj-cpp.dir/src/welding.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
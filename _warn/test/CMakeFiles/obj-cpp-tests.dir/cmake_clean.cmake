@@ -0,0 +1,36 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/obj-cpp-tests.dir/async_file_tests.cpp.o"
+  "CMakeFiles/obj-cpp-tests.dir/async_file_tests.cpp.o.d"
+  "CMakeFiles/obj-cpp-tests.dir/batch_tests.cpp.o"
+  "CMakeFiles/obj-cpp-tests.dir/batch_tests.cpp.o.d"
+  "CMakeFiles/obj-cpp-tests.dir/float_parser_tests.cpp.o"
+  "CMakeFiles/obj-cpp-tests.dir/float_parser_tests.cpp.o.d"
+  "CMakeFiles/obj-cpp-tests.dir/fuzzy_tests.cpp.o"
+  "CMakeFiles/obj-cpp-tests.dir/fuzzy_tests.cpp.o.d"
+  "CMakeFiles/obj-cpp-tests.dir/lexer_tests.cpp.o"
+  "CMakeFiles/obj-cpp-tests.dir/lexer_tests.cpp.o.d"
+  "CMakeFiles/obj-cpp-tests.dir/mtl_parser_tests.cpp.o"
+  "CMakeFiles/obj-cpp-tests.dir/mtl_parser_tests.cpp.o.d"
+  "CMakeFiles/obj-cpp-tests.dir/normals_tests.cpp.o"
+  "CMakeFiles/obj-cpp-tests.dir/normals_tests.cpp.o.d"
+  "CMakeFiles/obj-cpp-tests.dir/obj_parser_tests.cpp.o"
+  "CMakeFiles/obj-cpp-tests.dir/obj_parser_tests.cpp.o.d"
+  "CMakeFiles/obj-cpp-tests.dir/obj_writer_tests.cpp.o"
+  "CMakeFiles/obj-cpp-tests.dir/obj_writer_tests.cpp.o.d"
+  "CMakeFiles/obj-cpp-tests.dir/reader_tests.cpp.o"
+  "CMakeFiles/obj-cpp-tests.dir/reader_tests.cpp.o.d"
+  "CMakeFiles/obj-cpp-tests.dir/tangents_tests.cpp.o"
+  "CMakeFiles/obj-cpp-tests.dir/tangents_tests.cpp.o.d"
+  "CMakeFiles/obj-cpp-tests.dir/vertex_cache_tests.cpp.o"
+  "CMakeFiles/obj-cpp-tests.dir/vertex_cache_tests.cpp.o.d"
+  "CMakeFiles/obj-cpp-tests.dir/welding_tests.cpp.o"
+  "CMakeFiles/obj-cpp-tests.dir/welding_tests.cpp.o.d"
+  "obj-cpp-tests"
+  "obj-cpp-tests.pdb"
+  "obj-cpp-tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/obj-cpp-tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
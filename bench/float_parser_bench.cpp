@@ -0,0 +1,92 @@
+#include "obj-cpp/float_parser.hpp"
+#include "obj-cpp/lexer.hpp"
+#include "obj-cpp/reader.hpp"
+
+#include <charconv>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+constexpr const auto helper = "Benchmark of floating point parsing on vertex data\n"
+                              "Usage: obj-cpp-float-bench [FILE]\n"
+                              "Without arguments a vertex-heavy source is generated.\n";
+
+// generate a source with the same shape of scanned meshes
+[[nodiscard]] std::string generate_source(std::size_t vertices)
+{
+    std::mt19937_64                       rng{ 42 };
+    std::uniform_real_distribution<float> coord{ -100.f, 100.f };
+    std::uniform_real_distribution<float> unit{ 0.f, 1.f };
+
+    std::stringstream s{};
+    s.precision(7);
+    s << std::fixed;
+    for (std::size_t i = 0; i < vertices; ++i)
+        s << "v " << coord(rng) << ' ' << coord(rng) << ' ' << coord(rng) << '\n'
+          << "vn " << unit(rng) << ' ' << unit(rng) << ' ' << unit(rng) << '\n'
+          << "vt " << unit(rng) << ' ' << unit(rng) << '\n';
+    return s.str();
+}
+
+// extract all the numeric arguments of the 'v', 'vn' and 'vt' statements
+[[nodiscard]] std::vector<obj::Token> collect_values(const std::string& source)
+{
+    std::vector<obj::Token> values, line;
+    obj::LineLexer          lexer;
+    for (auto p = std::data(source); p != std::data(source) + std::size(source); line.clear())
+    {
+        p = lexer.lex_until_linefeed(p, line);
+        if (!std::empty(line) && (line[0] == "v" || line[0] == "vn" || line[0] == "vt"))
+            values.insert(std::end(values), std::next(std::begin(line)), std::end(line));
+    }
+    return values;
+}
+
+template <class Parse>
+void run(const char* name, const std::vector<obj::Token>& values, Parse parse)
+{
+    double best = 1e9, checksum = 0;
+    for (auto repeat = 0; repeat < 10; ++repeat)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (const auto& t : values)
+        {
+            float v{};
+            parse(std::data(t), std::data(t) + std::size(t), v);
+            checksum += v;
+        }
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+    std::cout << name << ":\t" << best << " ms\t"
+              << (best * 1e6 / static_cast<double>(std::size(values))) << " ns/value\t"
+              << "(checksum " << checksum << ")\n";
+}
+
+int main(const int argc, const char* argv[])
+{
+    if (argc > 2)
+    {
+        std::cout << helper;
+        return EXIT_FAILURE;
+    }
+
+    std::string source;
+    if (argc == 2)
+        source = obj::MappedFile{ argv[1] }.view();
+    else
+        source = generate_source(100000);
+
+    const auto values = collect_values(source);
+    std::cout << "Parsing " << std::size(values) << " values\n";
+
+    run("std::from_chars", values, [](const char* f, const char* l, float& v) {
+        return std::from_chars(f, l, v, std::chars_format::general);
+    });
+    run("obj::parse_float", values, [](const char* f, const char* l, float& v) {
+        return obj::parse_float(f, l, v);
+    });
+}
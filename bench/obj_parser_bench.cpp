@@ -0,0 +1,70 @@
+#include "obj-cpp/obj_parser.hpp"
+#include "obj-cpp/reader.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+
+constexpr const auto helper = "Benchmark of whole file parsing\n"
+                              "Usage: obj-cpp-parse-bench [FILE]\n"
+                              "Without arguments a mesh-like source is generated.\n";
+
+// generate a source with the same shape of exported meshes
+[[nodiscard]] std::string generate_source(std::size_t vertices)
+{
+    std::mt19937_64                       rng{ 42 };
+    std::uniform_real_distribution<float> coord{ -100.f, 100.f };
+    std::uniform_real_distribution<float> unit{ 0.f, 1.f };
+
+    std::stringstream s{};
+    s.precision(6);
+    s << std::fixed << "o mesh\n";
+    for (std::size_t i = 0; i < vertices; ++i)
+        s << "v " << coord(rng) << ' ' << coord(rng) << ' ' << coord(rng) << '\n'
+          << "vn " << unit(rng) << ' ' << unit(rng) << ' ' << unit(rng) << '\n'
+          << "vt " << unit(rng) << ' ' << unit(rng) << '\n';
+
+    std::uniform_int_distribution<std::size_t> index{ 1, vertices };
+    for (std::size_t i = 0; i < 2 * vertices; ++i)
+    {
+        s << 'f';
+        for (auto k = 0; k < 3; ++k)
+        {
+            const auto t = index(rng);
+            s << ' ' << t << '/' << t << '/' << t;
+        }
+        s << '\n';
+    }
+    return s.str();
+}
+
+int main(const int argc, const char* argv[])
+{
+    if (argc > 2)
+    {
+        std::cout << helper;
+        return EXIT_FAILURE;
+    }
+
+    std::string source;
+    if (argc == 2)
+        source = obj::MappedFile{ argv[1] }.view();
+    else
+        source = generate_source(500000);
+
+    double      best  = 1e9;
+    std::size_t faces = 0;
+    for (auto repeat = 0; repeat < 5; ++repeat)
+    {
+        const auto start  = std::chrono::steady_clock::now();
+        const auto result = obj::parse_as_obj(source);
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+        best  = std::min(best, elapsed.count());
+        faces = std::size(result.data.faces);
+    }
+    std::cout << "Parsed " << std::size(source) << " bytes, " << faces << " faces:\t" << best << " ms\t"
+              << (static_cast<double>(std::size(source)) / (best * 1e3)) << " MB/s\n";
+}
@@ -0,0 +1,102 @@
+#include "obj-cpp/lexer.hpp"
+#include "obj-cpp/reader.hpp"
+#include "obj-cpp/tag_table.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+constexpr const auto helper = "Benchmark of statement tag dispatch\n"
+                              "Usage: obj-cpp-tag-bench [FILE]\n"
+                              "Without arguments a tag-diverse sequence of statements is generated.\n";
+
+constexpr std::array<std::string_view, 11> tags = {
+    "v", "vn", "vt", "f", "o", "g", "s", "mtllib", "usemtl", "call", "csh"
+};
+
+// generate tags with the frequencies of a mesh with many small parts and materials
+[[nodiscard]] std::vector<obj::Token> generate_tags(std::size_t count)
+{
+    std::mt19937_64                         rng{ 42 };
+    std::discrete_distribution<std::size_t> pick{ 30, 20, 20, 20, 2, 2, 2, 1, 2, 0.5, 0.5 };
+
+    std::vector<obj::Token> result(count);
+    std::generate(std::begin(result), std::end(result), [&] { return tags[pick(rng)]; });
+    return result;
+}
+
+// collect the tag of every statement of a file
+[[nodiscard]] std::vector<obj::Token> collect_tags(const std::string& source)
+{
+    std::vector<obj::Token> result, line;
+    obj::LineLexer          lexer;
+    for (auto p = std::data(source); p != std::data(source) + std::size(source); line.clear())
+    {
+        p = lexer.lex_until_linefeed(p, line);
+        if (!std::empty(line))
+            result.push_back(line[0]);
+    }
+    return result;
+}
+
+template <class Find>
+void run(const char* name, const std::vector<obj::Token>& statements, Find find)
+{
+    double      best     = 1e9;
+    std::size_t checksum = 0;
+    for (auto repeat = 0; repeat < 10; ++repeat)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (const auto& t : statements)
+            checksum += find(t);
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+    std::cout << name << ":\t" << best << " ms\t"
+              << (best * 1e6 / static_cast<double>(std::size(statements))) << " ns/tag\t"
+              << "(checksum " << checksum << ")\n";
+}
+
+int main(const int argc, const char* argv[])
+{
+    if (argc > 2)
+    {
+        std::cout << helper;
+        return EXIT_FAILURE;
+    }
+
+    std::string             source;
+    std::vector<obj::Token> statements;
+    if (argc == 2)
+    {
+        source     = obj::MappedFile{ argv[1] }.view();
+        statements = collect_tags(source);
+    }
+    else
+        statements = generate_tags(1'000'000);
+
+    std::cout << "Dispatching " << std::size(statements) << " tags\n";
+
+    // previous implementation: linear scan of handled tags, then of ignored ones
+    const std::vector<std::pair<obj::Token, std::size_t>> handled = {
+        { "v", 0 }, { "vn", 1 }, { "vt", 2 }, { "f", 3 }, { "o", 4 },
+        { "g", 5 }, { "s", 6 }, { "mtllib", 7 }, { "usemtl", 8 }
+    };
+    const std::vector<std::string_view> ignored = { "call", "csh" };
+    run("linear scan", statements, [&](const obj::Token& t) -> std::size_t {
+        if (const auto it = std::find_if(std::cbegin(handled), std::cend(handled),
+                [&](const auto& x) { return x.first == t; });
+            it != std::cend(handled))
+            return it->second;
+        return 9 + static_cast<std::size_t>(std::find(std::cbegin(ignored), std::cend(ignored), t) - std::cbegin(ignored));
+    });
+
+    constexpr obj::TagTable table{ tags };
+    run("obj::TagTable", statements, [&](const obj::Token& t) { return table.find(t); });
+}
@@ -0,0 +1,96 @@
+#pragma once
+#ifndef OBJCPP_ASYNC_FILE_HPP
+#define OBJCPP_ASYNC_FILE_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string_view>
+
+namespace obj
+{
+    /// @brief Configuration parameters for asynchronous reads.
+    struct AsyncFileConfig
+    {
+        /// @brief Size in bytes of each read request.
+        std::size_t block_size = 1 << 20;
+
+        /// @brief Maximum number of read requests in flight.
+        std::size_t queue_depth = 8;
+
+        /// @brief Submit the requests to an io_uring instance when the kernel supports it,
+        ///        otherwise they are served by a background thread.
+        bool io_uring = true;
+    };
+
+
+    /// @brief Source of the blocks of an AsyncFile.
+    class _BlockReader
+    {
+    public:
+        virtual ~_BlockReader() = default;
+
+        // wait until at least n characters are available from the start, returns how many are
+        [[nodiscard]] virtual std::size_t wait_for(std::size_t n) = 0;
+
+        [[nodiscard]] virtual bool io_uring() const noexcept = 0;
+    };
+
+
+    /// @brief Content of a file that is read in the background, in blocks of the same size.
+    ///
+    /// Reads of the following blocks are kept in flight while the ones already completed
+    /// are consumed, so that parsing a file overlaps with reading it. The content is stored
+    /// in a single buffer followed by a '\0' character like C strings, and each prefix of it
+    /// can be used as soon as wait_for() reports it as available.
+    class AsyncFile
+    {
+    public:
+        /// @brief Open a file and start reading it.
+        ///
+        /// Files whose size isn't known in advance, such as pipes, are read before returning.
+        ///
+        /// @throw std::system_error If the file cannot be opened or read.
+        explicit AsyncFile(const std::filesystem::path& p, const AsyncFileConfig& c = {});
+
+        AsyncFile(const AsyncFile&) = delete;
+        AsyncFile& operator=(const AsyncFile&) = delete;
+
+        /// @brief Wait for the reads in flight, without submitting further ones.
+        ~AsyncFile() noexcept;
+
+        /// @brief First character of the content, available up to the size returned by wait_for().
+        [[nodiscard]] const char* data() const noexcept { return _data; }
+
+        /// @brief Size of the whole content, excluding the terminator.
+        [[nodiscard]] std::size_t size() const noexcept { return _size; }
+
+        /// @brief Wait until at least the first n characters of the content are available.
+        ///
+        /// @return Number of characters available, at least min(n, size()).
+        ///
+        /// @throw std::system_error If a read fails.
+        std::size_t wait_for(std::size_t n);
+
+        /// @brief Wait until the whole content is available.
+        ///
+        /// @throw std::system_error If a read fails.
+        [[nodiscard]] std::string_view view()
+        {
+            (void)wait_for(_size);
+            return { _data, _size };
+        }
+
+        /// @brief Check whether the reads are served by io_uring rather than by a background thread.
+        [[nodiscard]] bool uses_io_uring() const noexcept { return _reader && _reader->io_uring(); }
+
+    private:
+        const char*                   _data = nullptr;
+        std::size_t                   _size = 0;
+        std::unique_ptr<char[]>       _buffer;
+        std::unique_ptr<_BlockReader> _reader; // null if the content has been read up front
+    };
+
+} // namespace obj
+
+#endif // !OBJCPP_ASYNC_FILE_HPP
@@ -0,0 +1,72 @@
+#pragma once
+#ifndef OBJCPP_BATCH_HPP
+#define OBJCPP_BATCH_HPP
+
+#include "obj-cpp/core.hpp"
+#include "obj-cpp/mtl_parser.hpp"
+#include "obj-cpp/obj_parser.hpp"
+#include "obj-cpp/thread_pool.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <span>
+#include <variant>
+#include <vector>
+
+namespace obj
+{
+    /// @brief Configuration parameters for loading many files at once.
+    struct BatchConfig
+    {
+        /// @brief Configuration of the .obj parser.
+        ///
+        /// The thread count and the executor are replaced by the ones of the batch,
+        /// while a memory resource must be safe to use from many threads.
+        ObjParserConfig obj{};
+
+        /// @brief Configuration of the .mtl parser, with the same constraints on the memory resource.
+        MtlParserConfig mtl{};
+
+        /// @brief Number of threads, where 0 uses one thread for each hardware core.
+        std::size_t thread_count = 0;
+    };
+
+
+    /// @brief Content of a file loaded as part of a batch.
+    template <class Value = DefaultValueType, class Index = DefaultIndexType>
+    struct BatchResult
+    {
+        /// @brief Parsed content, either .obj or .mtl, empty if the file couldn't be loaded.
+        std::variant<std::monostate, ObjParserResult<Value, Index>, MtlParserResult> content;
+
+        /// @brief Exception thrown while loading the file, the same one that loading it alone would throw.
+        std::exception_ptr error;
+    };
+
+
+    /// @brief Load and parse many files concurrently.
+    ///
+    /// Files with the .mtl extension are parsed as material libraries, the other ones as .obj files.
+    /// Each file is a task of a work-stealing thread pool, and files larger than
+    /// ObjParserConfig::min_chunk_size are further split in chunks of lines parsed by the same pool,
+    /// so that a single large file doesn't leave the other threads idle.
+    ///
+    /// @param[in] paths Files to load.
+    /// @param[in] c     Batch configuration.
+    ///
+    /// @return Content or error of each file, in the same order of the paths.
+    template <class Value = DefaultValueType, class Index = DefaultIndexType>
+    [[nodiscard]] std::vector<BatchResult<Value, Index>> load_batch(
+        std::span<const std::filesystem::path> paths, const BatchConfig& c = {});
+
+    /// @brief Load and parse many files concurrently on an existing thread pool.
+    ///
+    /// BatchConfig::thread_count is ignored, the threads of the pool are used instead.
+    template <class Value = DefaultValueType, class Index = DefaultIndexType>
+    [[nodiscard]] std::vector<BatchResult<Value, Index>> load_batch(
+        std::span<const std::filesystem::path> paths, WorkStealingPool& pool, const BatchConfig& c = {});
+
+} // namespace obj
+
+#endif // !OBJCPP_BATCH_HPP
@@ -0,0 +1,145 @@
+#pragma once
+#ifndef OBJCPP_CACHE_HPP
+#define OBJCPP_CACHE_HPP
+
+#include "obj-cpp/core.hpp"
+#include "obj-cpp/mapped_file.hpp"
+#include "obj-cpp/obj_parser.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+
+namespace obj
+{
+    /// @brief Error raised by cache files that cannot be used.
+    class CacheError : public std::runtime_error
+    {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+
+
+    /// @brief Object stored in a cache file.
+    template <class Index = DefaultIndexType>
+    struct CachedObject
+    {
+        /// @brief Object name.
+        std::string_view name;
+
+        /// @brief List of faces associated with the object.
+        std::span<const Index> faces;
+    };
+
+
+    /// @brief Polygons stored in a cache file, see PolygonData.
+    template <class Index = DefaultIndexType>
+    struct CachedPolygons
+    {
+        /// @brief Position of the first triplet of each polygon.
+        std::span<const Index> offsets;
+
+        /// @brief Vertex triplets of all polygons.
+        std::span<const Triplet<Index>> triplets;
+
+        /// @brief Position in the face list of the first triangle of each polygon.
+        std::span<const Index> faces;
+    };
+
+
+    /// @brief Entry of the object table of a cache file.
+    struct _CacheObject
+    {
+        std::uint64_t name_offset; // position in the names section
+        std::uint64_t name_size;
+        std::uint64_t faces_offset; // position in the object faces section
+        std::uint64_t faces_count;
+    };
+
+
+    /// @brief Read-only view of a parsed .obj file stored in binary form.
+    ///
+    /// The cache file is mapped in memory and its sections are exposed in place,
+    /// so loading it requires no parsing and no copies.
+    /// Caches are tied to the machine that wrote them, as data is stored with native
+    /// layout and endianness; incompatible files are rejected, as well as
+    /// files written with different value or index types, or with parser options
+    /// that change the result (indices, triangulation, polygons and extensions).
+    template <class Value = DefaultValueType, class Index = DefaultIndexType>
+    class MeshCache
+    {
+    public:
+        /// @brief Map and validate a cache file.
+        ///
+        /// @param[in] p Cache file.
+        /// @param[in] c Parser configuration the cache must have been written with.
+        ///
+        /// @throw std::system_error  If the file cannot be opened or read.
+        /// @throw CacheError        If the file isn't a valid cache for this build and configuration.
+        explicit MeshCache(const std::filesystem::path& p, const ObjParserConfig& c = {});
+
+        /// @brief List of geometry vertices.
+        [[nodiscard]] std::span<const Vertex<Value>> v() const noexcept { return _v; }
+
+        /// @brief List of normal vectors.
+        [[nodiscard]] std::span<const Normal<Value>> vn() const noexcept { return _vn; }
+
+        /// @brief List of texture vertices.
+        [[nodiscard]] std::span<const Texcoord<Value>> vt() const noexcept { return _vt; }
+
+        /// @brief List of face elements.
+        [[nodiscard]] std::span<const Face<Index>> faces() const noexcept { return _faces; }
+
+        /// @brief Number of objects.
+        [[nodiscard]] std::size_t object_count() const noexcept { return std::size(_objects); }
+
+        /// @brief Object at the given position, in declaration order.
+        [[nodiscard]] CachedObject<Index> object(std::size_t i) const noexcept;
+
+        /// @brief Smoothing groups of the faces, see ObjParserResult::smoothing_groups.
+        [[nodiscard]] std::span<const SmoothingGroup<Index>> smoothing_groups() const noexcept { return _smoothing_groups; }
+
+        /// @brief Faces as written in the source, see ObjParserResult::polygons.
+        [[nodiscard]] CachedPolygons<Index> polygons() const noexcept { return _polygons; }
+
+        /// @brief Copy the content in a result equal to the one produced by the parser.
+        [[nodiscard]] ObjParserResult<Value, Index> to_result() const;
+
+    private:
+        MappedFile                       _file;
+        std::span<const Vertex<Value>>   _v;
+        std::span<const Normal<Value>>   _vn;
+        std::span<const Texcoord<Value>> _vt;
+        std::span<const Face<Index>>     _faces;
+        std::span<const _CacheObject>    _objects;
+        std::span<const Index>           _object_faces; // faces of all objects, one after the other
+        std::string_view                 _names;        // names of all objects, one after the other
+
+        std::span<const SmoothingGroup<Index>> _smoothing_groups;
+        CachedPolygons<Index>                  _polygons;
+    };
+
+
+    /// @brief Write a parsed .obj file in binary form, readable by MeshCache.
+    ///
+    /// The content is written to a temporary file with a unique name, that replaces the destination
+    /// once complete, so concurrent readers never observe a partial cache and concurrent writers
+    /// don't interfere. Padding bytes of the elements are written as zeros.
+    ///
+    /// @param[in] r Parsed file.
+    /// @param[in] p Cache file.
+    /// @param[in] c Parser configuration that produced the result, recorded in the cache.
+    ///
+    /// @throw std::system_error If the file cannot be written.
+    template <class Value, class Index>
+    void write_cache(const ObjParserResult<Value, Index>& r, const std::filesystem::path& p, const ObjParserConfig& c = {});
+
+    /// @brief Check whether a cache file exists and is not older than its source file.
+    [[nodiscard]] bool is_cache_fresh(const std::filesystem::path& source, const std::filesystem::path& cache);
+
+} // namespace obj
+
+#endif // !OBJCPP_CACHE_HPP
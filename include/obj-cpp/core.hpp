@@ -3,25 +3,25 @@
 #define OBJCPP_CORE_HPP
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <memory_resource>
 #include <string>
 #include <type_traits>
 #include <vector>
 
 namespace obj
 {
-    using Value = float;
-    using Index = std::size_t;
-
     /// @brief Default type in template parameters for real values.
     using DefaultValueType = float;
 
     /// @brief Default type in template parameters for index values.
-    using DefaultIndexType = std::int32_t;
+    using DefaultIndexType = std::uint64_t;
 
 
     /// @brief Geometric vertex.
-    //template <class Value = DefaultValueType>
+    template <class Value = DefaultValueType>
     struct alignas(16) Vertex
     {
         /// @brief The x component.
@@ -41,7 +41,7 @@ namespace obj
     };
 
     /// @brief Geometric normal.
-    //template <class Value = DefaultValueType>
+    template <class Value = DefaultValueType>
     struct alignas(16) Normal
     {
         /// @brief The x component.
@@ -58,7 +58,7 @@ namespace obj
     };
 
     /// @brief Geometric texture coordinates.
-    //template <class Value = DefaultValueType>
+    template <class Value = DefaultValueType>
     struct alignas(16) Texcoord
     {
         /// @brief First coordinate component u.
@@ -76,7 +76,7 @@ namespace obj
 
 
     /// @brief Gemotric vertex, normal and texture coordinate triple.
-    //template <class Index = DefaultIndexType>
+    template <class Index = DefaultIndexType>
     struct Triplet
     {
         /// @brief Zero-based index of a vertex.
@@ -94,19 +94,50 @@ namespace obj
 
 
     /// @brief Triangular face.
-    //template <class Index = DefaultIndexType>
+    template <class Index = DefaultIndexType>
     struct Face
     {
-        std::array<Triplet, 3> triplets;
-        //std::array<Triplet<Index>, 3> triplets;
+        std::array<Triplet<Index>, 3> triplets;
 
         [[nodiscard]] constexpr bool operator==(const Face&) const noexcept = default;
         [[nodiscard]] constexpr bool operator!=(const Face&) const noexcept = default;
     };
 
 
+    /// @brief Polygonal faces as written in the source, stored one after the other.
+    ///
+    /// Each polygon is also split in consecutive triangles of the face list,
+    /// so the original structure can be recovered from the triangulated data.
+    template <class Index = DefaultIndexType>
+    struct PolygonData
+    {
+        /// @brief Position of the first triplet of each polygon.
+        std::pmr::vector<Index> offsets;
+
+        /// @brief Vertex triplets of all polygons.
+        std::pmr::vector<Triplet<Index>> triplets;
+
+        /// @brief Position in the face list of the first triangle of each polygon.
+        std::pmr::vector<Index> faces;
+
+        /// @brief Number of polygons.
+        [[nodiscard]] std::size_t size() const noexcept { return std::size(offsets); }
+
+        /// @brief Position of the first triplet of a polygon.
+        [[nodiscard]] std::size_t first(std::size_t i) const noexcept { return static_cast<std::size_t>(offsets[i]); }
+
+        /// @brief Position past the last triplet of a polygon.
+        [[nodiscard]] std::size_t last(std::size_t i) const noexcept
+        {
+            return (i + 1 < std::size(offsets)) ? static_cast<std::size_t>(offsets[i + 1]) : std::size(triplets);
+        }
+
+        [[nodiscard]] bool operator==(const PolygonData&) const noexcept = default;
+    };
+
+
     /// @brief A range of indices defined as [begin, end).
-    //template <class Index = DefaultIndexType>
+    template <class Index = DefaultIndexType>
     struct IndexRange
     {
         Index begin;
@@ -118,24 +149,20 @@ namespace obj
 
 
     /// @brief Polygonal data covered by the scope of a statement.
-    //template <class Index = DefaultIndexType>
+    template <class Index = DefaultIndexType>
     struct PolygonalDataScope
     {
         /// @brief Range of vertex indices included in the scope.
-        IndexRange vertices;
-        //IndexRange<Index> vertices;
+        IndexRange<Index> vertices;
 
         /// @brief Range of normals indices included in the scope.
-        IndexRange normals;
-        //IndexRange<Index> normals;
+        IndexRange<Index> normals;
 
         /// @brief Range of texture coordinate indices included in the scope.
-        IndexRange texcoords;
-        //IndexRange<Index> texcoords;
+        IndexRange<Index> texcoords;
 
         /// @brief Range of faces indices included in the scope.
-        IndexRange faces;
-        //IndexRange<Index> faces;
+        IndexRange<Index> faces;
     };
 
 
@@ -148,48 +175,93 @@ namespace obj
 
 
     /// @brief Mesh data from a whole .obj file.
-    //template <class Value = DefaultValueType, class Index = DefaultIndexType>
+    template <class Value = DefaultValueType, class Index = DefaultIndexType>
     struct MeshData
     {
         /// @brief List of geometry vertices ('v' statements).
-        std::vector<Vertex> v;
-        //std::vector<Vertex<Value>> v;
+        std::pmr::vector<Vertex<Value>> v;
 
         /// @brief List of normal vectors ('vn' statement).
-        std::vector<Normal> vn;
-        //std::vector<Normal<Value>> vn;
+        std::pmr::vector<Normal<Value>> vn;
 
         /// @brief List of texture vertices ('vt' statements).
-        std::vector<Texcoord> vt;
-        //std::vector<Texcoord<Value>> vt;
+        std::pmr::vector<Texcoord<Value>> vt;
 
         /// @brief List of face elements ('f' statement).
-        std::vector<Face> faces;
-        //std::vector<Face<Index>> faces;
+        std::pmr::vector<Face<Index>> faces;
+    };
+
+
+    /// @brief Mesh data from a whole .obj file, stored as structure of arrays.
+    ///
+    /// With the default 32-bit indices it takes about half the memory of MeshData, and it exposes
+    /// each component as a contiguous array, ready for vectorized processing. Vertex weights and the third texture
+    /// coordinate are not stored. Indices keep the MeshData convention: one-based
+    /// as written in the source, zero for the missing ones.
+    template <class Value = DefaultValueType, class Index = std::uint32_t>
+    struct SoaMeshData
+    {
+        /// @brief Components of the geometry vertices ('v' statements).
+        std::pmr::vector<Value> x, y, z;
+
+        /// @brief Components of the normal vectors ('vn' statements).
+        std::pmr::vector<Value> nx, ny, nz;
+
+        /// @brief Texture vertices ('vt' statements), as packed (u, v) pairs.
+        std::pmr::vector<Value> uv;
+
+        /// @brief Vertex indices of the faces, three for each face ('f' statements).
+        std::pmr::vector<Index> v_indices;
+
+        /// @brief Texture vertex indices of the faces, three for each face.
+        std::pmr::vector<Index> vt_indices;
+
+        /// @brief Normal indices of the faces, three for each face.
+        std::pmr::vector<Index> vn_indices;
+
+        [[nodiscard]] bool operator==(const SoaMeshData&) const noexcept = default;
     };
 
 
     /// @brief Group of element under the same group tag.
-    //template <class Index = DefaultIndexType>
+    template <class Index = DefaultIndexType>
     struct Group
     {
         /// @brief Group name.
-        std::string name;
+        std::pmr::string name;
 
         /// @brief List of faces associated with the object.
-        std::vector<Index> faces;
+        std::pmr::vector<Index> faces;
     };
 
 
     /// @brief Group of elements under the same object tag.
-    //template <class Index = DefaultIndexType>
+    template <class Index = DefaultIndexType>
     struct Object
     {
         /// @brief Object name.
-        std::string name;
+        std::pmr::string name;
 
         /// @brief List of faces associated with the object.
-        std::vector<Index> faces;
+        std::pmr::vector<Index> faces;
+
+        [[nodiscard]] constexpr bool operator==(const Object&) const noexcept = default;
+        [[nodiscard]] constexpr bool operator!=(const Object&) const noexcept = default;
+    };
+
+
+    /// @brief Smoothing group of a run of consecutive faces ('s' statement).
+    template <class Index = DefaultIndexType>
+    struct SmoothingGroup
+    {
+        /// @brief Position of the first face of the run, that extends up to the next run.
+        Index first_face;
+
+        /// @brief Group number, zero for faces that aren't smoothed ('s off').
+        std::uint32_t id;
+
+        [[nodiscard]] constexpr bool operator==(const SmoothingGroup&) const noexcept = default;
+        [[nodiscard]] constexpr bool operator!=(const SmoothingGroup&) const noexcept = default;
     };
 
 
@@ -198,26 +270,26 @@ namespace obj
     struct Material
     {
         /// @brief Associated material name.
-        std::string name;
+        std::pmr::string name;
 
         /// @brief Ambient reflectivity.
-        Value ka[3] = { 0.2f, 0.2f, 0.2f };
+        DefaultValueType ka[3] = { 0.2f, 0.2f, 0.2f };
 
         /// @brief Diffuse reflectivity.
-        Value kd[3] = { 0.8f, 0.8f, 0.8f };
+        DefaultValueType kd[3] = { 0.8f, 0.8f, 0.8f };
 
         /// @brief Specular reflectivity.
-        Value ks[3] = { 1.0f, 1.0f, 1.0f };
+        DefaultValueType ks[3] = { 1.0f, 1.0f, 1.0f };
 
         /// @brief Transmission filter.
-        Value tf[3] = { 0.0f, 0.0f, 0.0f };
+        DefaultValueType tf[3] = { 0.0f, 0.0f, 0.0f };
 
         /// @brief Index of the illumination model.
         std::uint32_t illumination_model;
 
-        std::string map_ka;
-        std::string map_kd;
-        std::string map_ks;
+        std::pmr::string map_ka;
+        std::pmr::string map_kd;
+        std::pmr::string map_ks;
 
 #if defined(OBJCPP_PBR_EXT)
 
@@ -227,6 +299,19 @@ namespace obj
     };
 
 
+    /// @brief Configuration parameters shared by the algorithms that process parsed mesh data.
+    struct MeshProcessingConfig
+    {
+        /// @brief Face indices are zero-based, as produced with ObjParserConfig::zero_based_indices.
+        ///
+        /// Otherwise they are one-based as written in the source, with zero for missing elements.
+        bool zero_based_indices = false;
+
+        /// @brief Number of threads, where 0 uses one thread for each hardware core.
+        std::size_t thread_count = 1;
+    };
+
+
 } // namespace obj
 
 #endif // !OBJCPP_CORE_HPP
\ No newline at end of file
@@ -0,0 +1,166 @@
+#pragma once
+#ifndef OBJCPP_FLOAT_PARSER_HPP
+#define OBJCPP_FLOAT_PARSER_HPP
+
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+namespace obj
+{
+    /// @brief Compute the nearest floating point value of w * 10^q with the Eisel-Lemire algorithm.
+    ///
+    /// @return False if the result cannot be determined cheaply, e.g. subnormal values,
+    ///         overflows or exponents outside the range covered by the internal tables.
+    template <class Value>
+    [[nodiscard]] bool _eisel_lemire(std::uint64_t w, std::int64_t q, bool negative, Value& value) noexcept;
+
+    extern template bool _eisel_lemire<float>(std::uint64_t, std::int64_t, bool, float&) noexcept;
+    extern template bool _eisel_lemire<double>(std::uint64_t, std::int64_t, bool, double&) noexcept;
+
+
+    // exact powers of ten in double precision
+    inline constexpr double _exact_powers_of_ten[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    [[nodiscard]] constexpr bool _is_digit(const char c) noexcept
+    {
+        return static_cast<unsigned char>(c - '0') < 10;
+    }
+
+    // number of significant digits of a value in [0, 9999]
+    [[nodiscard]] constexpr int _count_digits(std::uint32_t v) noexcept
+    {
+        return (v >= 1000) ? 4 : (v >= 100) ? 3 : (v >= 10) ? 2 : (v >= 1) ? 1 : 0;
+    }
+
+    // accumulate a run of digits into the mantissa, four at a time when possible
+    [[nodiscard]] inline const char* _parse_digits(
+        const char* p, const char* last, std::uint64_t& mantissa, int& digits) noexcept
+    {
+        if constexpr (std::endian::native == std::endian::little)
+        {
+            for (; last - p >= 4; p += 4)
+            {
+                std::uint32_t v;
+                std::memcpy(&v, p, sizeof(v));
+                if ((v & 0xF0F0F0F0) != 0x30303030 || ((v + 0x06060606) & 0xF0F0F0F0) != 0x30303030)
+                    break; // not all digits
+
+                // combine pairs of digits then pairs of pairs
+                v = v & 0x0F0F0F0F;
+                v = (v * 10 + (v >> 8)) & 0x00FF00FF;
+                v = (v * 100 + (v >> 16)) & 0x0000FFFF;
+
+                digits   = (digits != 0) ? digits + 4 : _count_digits(v);
+                mantissa = mantissa * 10000 + v;
+            }
+        }
+
+        for (; p != last && _is_digit(*p); ++p)
+        {
+            mantissa = mantissa * 10 + static_cast<unsigned>(*p - '0');
+            digits += (digits != 0 || *p != '0');
+        }
+        return p;
+    }
+
+    /// @brief Parse a floating point number in fixed or scientific notation.
+    ///
+    /// Same interface and results of std::from_chars with std::chars_format::general.
+    /// Decimals with up to 15 significant digits and small exponents, like the ones
+    /// written by most exporters, are converted exactly with a single multiplication or division.
+    /// Longer mantissas go through the Eisel-Lemire algorithm and the remaining hard cases
+    /// are forwarded to std::from_chars.
+    template <class Value>
+    [[nodiscard]] inline std::from_chars_result parse_float(
+        const char* first, const char* last, Value& value) noexcept
+    {
+        static_assert(std::is_same_v<Value, float> || std::is_same_v<Value, double>,
+            "Only single and double precision values are supported");
+
+        auto p = first;
+
+        const auto negative = (p != last && *p == '-');
+        if (negative)
+            ++p;
+
+        std::uint64_t mantissa = 0;
+        std::int64_t  exponent = 0;
+        int           digits   = 0; // significant digits, leading zeros excluded
+
+        const auto integer_begin = p;
+        p                        = _parse_digits(p, last, mantissa, digits);
+        auto any_digit           = (p != integer_begin);
+
+        if (p != last && *p == '.')
+        {
+            const auto fraction_begin = ++p;
+            p                         = _parse_digits(p, last, mantissa, digits);
+            exponent -= (p - fraction_begin);
+            any_digit |= (p != fraction_begin);
+        }
+
+        if (!any_digit) // special values and malformed inputs
+            return std::from_chars(first, last, value, std::chars_format::general);
+
+        if (p != last && (*p == 'e' || *p == 'E'))
+        {
+            auto e = p + 1;
+
+            const auto negative_exponent = (e != last && *e == '-');
+            if (e != last && (*e == '-' || *e == '+'))
+                ++e;
+
+            if (e != last && _is_digit(*e)) // otherwise the exponent isn't part of the number
+            {
+                std::int64_t explicit_exponent = 0;
+                for (; e != last && _is_digit(*e); ++e)
+                    if (explicit_exponent < 0x10000) // saturate, far beyond any representable value
+                        explicit_exponent = explicit_exponent * 10 + (*e - '0');
+                exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+                p = e;
+            }
+        }
+
+        if (digits == 0)
+        {
+            value = negative ? -Value{ 0 } : Value{ 0 };
+            return { p, std::errc{} };
+        }
+
+        if (digits <= 19) // the mantissa is exact
+        {
+            // Clinger's fast path: both operands are exact, so the result is correctly rounded
+            if (mantissa <= (std::uint64_t{ 1 } << 53) && exponent >= -22 && exponent <= 22)
+            {
+                auto d = static_cast<double>(mantissa);
+                d      = (exponent < 0) ? d / _exact_powers_of_ten[-exponent] : d * _exact_powers_of_ten[exponent];
+
+                // the double result rounds correctly to single precision
+                // unless it lies exactly halfway between two floats
+                constexpr std::uint64_t tail_mask = (std::uint64_t{ 1 } << 29) - 1;
+                if (std::is_same_v<Value, double> ||
+                    (std::bit_cast<std::uint64_t>(d) & tail_mask) != (std::uint64_t{ 1 } << 28))
+                {
+                    value = static_cast<Value>(negative ? -d : d);
+                    return { p, std::errc{} };
+                }
+            }
+
+            if (_eisel_lemire(mantissa, exponent, negative, value))
+                return { p, std::errc{} };
+        }
+
+        return std::from_chars(first, last, value, std::chars_format::general);
+    }
+
+} // namespace obj
+
+#endif // !OBJCPP_FLOAT_PARSER_HPP
@@ -4,7 +4,9 @@
 
 #include <array>
 #include <cassert>
+#include <cstdint>
 #include <iostream>
+#include <memory_resource>
 #include <span>
 #include <string>
 #include <vector>
@@ -187,8 +189,8 @@ namespace obj
     private:
         //std::array<EquivClass, 256> _eq_classes;
         static constexpr auto nsymbols = 256; // unsigned char
-        static constexpr auto nstates  = static_cast<std::size_t>(State::last_nonfinal_state);
-        static constexpr auto nclasses = static_cast<std::size_t>(EquivClass::last_valid_value);
+        static constexpr auto nstates  = static_cast<std::size_t>(State::last_nonfinal_state) + 1;
+        static constexpr auto nclasses = static_cast<std::size_t>(EquivClass::last_valid_value) + 1;
 
         EquivClass _eq_classes[nsymbols];
         State      _fsa[nstates][nclasses];
@@ -216,6 +218,19 @@ namespace obj
         }
     }
 
+    /// @brief Instruction sets available to the line lexer.
+    enum class LexerIsa : unsigned char
+    {
+        scalar, // byte-by-byte finite state automata
+        sse2,   // classifies 16 characters per instruction
+        avx2,   // classifies 32 characters per instruction
+    };
+
+    /// @brief Best instruction set supported by the running processor.
+    [[nodiscard]] LexerIsa detect_lexer_isa() noexcept;
+
+#if !defined(_drako_disable_exceptions) /*vvv exceptions vvv*/
+
     /// @brief Parse tokens from the whole source text.
     [[nodiscard]] std::vector<Token> lex(std::span<const char> s);
 
@@ -227,6 +242,120 @@ namespace obj
     /// @return Ending position of the lexing phase.
     [[nodiscard]] const char* lex_until_linefeed(const char* from, std::vector<Token>& tokens);
 
+    /// @brief Parse tokens from a single line of source text with a specific instruction set.
+    ///
+    /// No character is read past the line feed or the string terminator that ends the line.
+    ///
+    /// @param[in]  from   Starting position for the lexing phase.
+    /// @param[out] tokens Destination for produced tokens.
+    /// @param[in]  isa    Instruction set, must be supported by the running processor.
+    ///
+    /// @return Ending position of the lexing phase.
+    [[nodiscard]] const char* lex_until_linefeed(const char* from, std::vector<Token>& tokens, LexerIsa isa);
+
+#endif /*^^^ exceptions ^^^*/
+
+
+    /// @brief Number of statements found by a quick scan of the source text.
+    struct StatementCounts
+    {
+        std::size_t v  = 0; // geometric vertices
+        std::size_t vn = 0; // normals
+        std::size_t vt = 0; // texture vertices
+        std::size_t f  = 0; // faces
+        std::size_t o  = 0; // objects
+    };
+
+    /// @brief Count the statements by looking only at the first characters of each line.
+    ///
+    /// Lines are not validated and the ones indented with whitespace are skipped,
+    /// so the result is meant for allocating storage before the actual parsing.
+    ///
+    /// @param[in] data Source text.
+    /// @param[in] size Size of the source text.
+    [[nodiscard]] StatementCounts count_statements(const char* data, std::size_t size) noexcept;
+
+
+    /// @brief Character classes of a block of source text, one bit for each character.
+    struct _LexerWindow
+    {
+        const char*   position = nullptr; // null if the block isn't reusable
+        std::uint64_t token    = 0; // identifier characters, same set as FSA::EquivClass::alphanum
+        std::uint64_t hash     = 0; // comment start
+        std::uint64_t eol      = 0; // line feed or string terminator
+        std::uint64_t invalid  = 0; // characters rejected by the FSA
+    };
+
+    /// @brief Line lexer for sequential scans of the same source text.
+    ///
+    /// Consecutive lines usually share a block of characters, so the classification
+    /// of the last block is kept and reused by the vectorized implementations.
+    /// Characters are read up to the end of the source text set by reset(), or when
+    /// that is unknown up to the line feed or the string terminator of each line.
+    class LineLexer
+    {
+    public:
+        explicit LineLexer(LexerIsa isa = detect_lexer_isa()) noexcept
+            : _isa{ isa } {}
+
+        /// @brief Parse tokens from a single line of source text, without throwing on invalid characters.
+        ///
+        /// The tokens of a line with invalid characters are unspecified, and lexing
+        /// still ends at the start of the next line. Only std::bad_alloc is thrown.
+        ///
+        /// @param[in]  from    Starting position for the lexing phase.
+        /// @param[out] tokens  Destination for produced tokens.
+        /// @param[out] invalid First invalid character of the line, or nullptr.
+        ///
+        /// @return Ending position of the lexing phase.
+        [[nodiscard]] const char* try_lex_until_linefeed(
+            const char* from, std::vector<Token>& tokens, const char*& invalid);
+
+        /// @brief Parse tokens from a single line of source text into a buffer from a memory resource.
+        [[nodiscard]] const char* try_lex_until_linefeed(
+            const char* from, std::pmr::vector<Token>& tokens, const char*& invalid);
+
+#if !defined(_drako_disable_exceptions)
+        /// @brief Parse tokens from a single line of source text.
+        ///
+        /// @param[in]  from   Starting position for the lexing phase.
+        /// @param[out] tokens Destination for produced tokens.
+        ///
+        /// @return Ending position of the lexing phase.
+        ///
+        /// @throw std::runtime_error If the line contains invalid characters.
+        [[nodiscard]] const char* lex_until_linefeed(const char* from, std::vector<Token>& tokens);
+
+        /// @brief Parse tokens from a single line of source text into a buffer from a memory resource.
+        [[nodiscard]] const char* lex_until_linefeed(const char* from, std::pmr::vector<Token>& tokens);
+#endif
+
+        /// @brief Discard cached state, required before lexing a different source text.
+        ///
+        /// @param[in] end End of the source text, which doesn't need a string terminator:
+        ///                no character is read from it onwards. Null if unknown.
+        void reset(const char* end = nullptr) noexcept
+        {
+            _window = {};
+            _end    = end;
+        }
+
+        [[nodiscard]] LexerIsa isa() const noexcept { return _isa; }
+
+    private:
+        template <class Tokens>
+        [[nodiscard]] const char* _try_lex_until_linefeed(const char* from, Tokens& tokens, const char*& invalid);
+
+#if !defined(_drako_disable_exceptions)
+        template <class Tokens>
+        [[nodiscard]] const char* _lex_until_linefeed(const char* from, Tokens& tokens);
+#endif
+
+        LexerIsa     _isa;
+        _LexerWindow _window;
+        const char*  _end = nullptr;
+    };
+
 } // namespace obj
 
 #endif // !OBJCPP_LEXER_HPP
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+#ifndef OBJCPP_MAPPED_FILE_HPP
+#define OBJCPP_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace obj
+{
+    /// @brief Read-only view of the whole content of a file.
+    ///
+    /// The content is mapped in memory when possible, so that it can be parsed directly
+    /// from the page cache, and it is always followed by a '\0' character like C strings.
+    class MappedFile
+    {
+    public:
+        /// @brief Open and map a file.
+        ///
+        /// @throw std::system_error If the file cannot be opened or read.
+        explicit MappedFile(const std::filesystem::path& p);
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        ~MappedFile() noexcept;
+
+        /// @brief First character of the content.
+        [[nodiscard]] const char* data() const noexcept { return _data; }
+
+        /// @brief Size of the content, excluding the terminator.
+        [[nodiscard]] std::size_t size() const noexcept { return _size; }
+
+        /// @brief Content of the file, excluding the terminator.
+        [[nodiscard]] std::string_view view() const noexcept { return { _data, _size }; }
+
+        /// @brief Check whether the content is mapped or has been copied in a buffer.
+        [[nodiscard]] bool mapped() const noexcept { return _mapping != nullptr; }
+
+    private:
+        const char* _data        = nullptr;
+        std::size_t _size        = 0;
+        void*       _mapping     = nullptr; // start of the mapped address range
+        std::size_t _mapping_len = 0;       // length of the mapped address range
+        std::string _buffer;                // fallback storage for unmappable files
+
+        void _release() noexcept;
+    };
+
+} // namespace obj
+
+#endif // !OBJCPP_MAPPED_FILE_HPP
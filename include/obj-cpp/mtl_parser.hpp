@@ -3,8 +3,10 @@
 
 #include "obj-cpp/core.hpp"
 
+#include <memory_resource>
 #include <string>
 #include <vector>
+#include <version>
 
 #if __cpp_lib_string_view
 #include <string_view>
@@ -19,13 +21,17 @@ namespace obj
     /// @brief Configuration parameters for the parser.
     struct MtlParserConfig
     {
+        /// @brief Memory resource for the containers of the result and the scratch buffers.
+        ///
+        /// A null pointer selects std::pmr::get_default_resource().
+        std::pmr::memory_resource* memory_resource = nullptr;
     };
 
     /// @brief Output produced by parsing a .mtl file.
     //template <class Value = DefaultValueType>
     struct MtlParserResult
     {
-        std::vector<Material> materials;
+        std::pmr::vector<Material> materials;
         //std::vector<Material<Value>> materials;
     };
 
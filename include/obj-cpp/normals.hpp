@@ -0,0 +1,76 @@
+#pragma once
+#ifndef OBJCPP_NORMALS_HPP
+#define OBJCPP_NORMALS_HPP
+
+#include "obj-cpp/core.hpp"
+#include "obj-cpp/obj_parser.hpp"
+
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace obj
+{
+    /// @brief Configuration parameters for normal generation.
+    struct NormalConfig
+    {
+        /// @brief Contribution of each face to the normals of its vertices.
+        enum class Weighting
+        {
+            /// @brief Proportional to the area of the face.
+            area,
+
+            /// @brief Proportional to the angle of the face at the vertex, independent of the tessellation.
+            angle,
+        };
+
+        Weighting weighting = Weighting::angle;
+
+        /// @brief See MeshProcessingConfig::zero_based_indices.
+        bool zero_based_indices = false;
+
+        /// @brief See MeshProcessingConfig::thread_count.
+        std::size_t thread_count = 1;
+    };
+
+
+    /// @brief Replace the normals of a mesh with vertex normals computed from the faces.
+    ///
+    /// Faces in the same smoothing group share one normal for each geometric vertex,
+    /// averaged over the faces of the group around it, while faces that aren't smoothed
+    /// get the normal of their plane. Normals are stored in order of first use by the faces,
+    /// so the output doesn't depend on the number of threads. Only the faces are updated,
+    /// see the overload for parser results to update the polygons.
+    ///
+    /// @param[in,out] d      Mesh data.
+    /// @param[in]     groups Smoothing groups of the faces, as collected by the parser.
+    /// @param[in]     c      Normal generation configuration.
+    ///
+    /// @throw std::out_of_range If a face vertex doesn't refer to an existing vertex, data is left unchanged.
+    /// @throw std::length_error If there are more normals than the Index type can address.
+    template <class Value, class Index>
+    void generate_normals(MeshData<Value, Index>& d, std::type_identity_t<std::span<const SmoothingGroup<Index>>> groups,
+        const NormalConfig& c = {});
+
+    /// @brief Replace the normals of a mesh with vertex normals computed from the faces.
+    template <class Value, class Index>
+    void generate_normals(SoaMeshData<Value, Index>& d, std::type_identity_t<std::span<const SmoothingGroup<Index>>> groups,
+        const NormalConfig& c = {});
+
+    /// @brief Replace the normals of a parsed file with vertex normals computed from its faces.
+    ///
+    /// Faces are smoothed according to the smoothing groups of the file, and the polygons
+    /// take the normals of their triangles at the same vertices.
+    ///
+    /// @throw std::out_of_range If a face vertex doesn't refer to an existing vertex, data is left unchanged.
+    /// @throw std::length_error If there are more normals than the Index type can address.
+    template <class Value, class Index>
+    void generate_normals(ObjParserResult<Value, Index>& r, const NormalConfig& c = {});
+
+    /// @brief Replace the normals of a parsed file with vertex normals computed from its faces.
+    template <class Value, class Index>
+    void generate_normals(ObjParserSoaResult<Value, Index>& r, const NormalConfig& c = {});
+
+} // namespace obj
+
+#endif // !OBJCPP_NORMALS_HPP
\ No newline at end of file
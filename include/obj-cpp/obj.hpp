@@ -4,8 +4,17 @@
 
 // Include all relevant headers.
 
+#include "async_file.hpp"
+#include "batch.hpp"
+#include "cache.hpp"
 #include "core.hpp"
 #include "mtl_parser.hpp"
+#include "normals.hpp"
 #include "obj_parser.hpp"
+#include "obj_writer.hpp"
+#include "tangents.hpp"
+#include "thread_pool.hpp"
+#include "vertex_cache.hpp"
+#include "welding.hpp"
 
 #endif // !OBJCPP_OBJ_HPP
\ No newline at end of file
@@ -1,9 +1,19 @@
 #ifndef OBJCPP_OBJ_PARSER_HPP
 #define OBJCPP_OBJ_PARSER_HPP
 
+#include "obj-cpp/async_file.hpp"
 #include "obj-cpp/core.hpp"
+#include "obj-cpp/lexer.hpp"
+#include "obj-cpp/parallel.hpp"
+#include "obj-cpp/parser.hpp"
 
+#include <filesystem>
+#include <memory_resource>
+#include <optional>
 #include <string>
+#include <tuple>
+#include <utility>
+#include <variant>
 #include <vector>
 
 #if __cpp_lib_string_view
@@ -26,60 +36,557 @@ namespace obj
             vertex_color = (1 << 0),
         };
 
-        /// @brief Expected number of objects.
-        std::size_t expected_object_count = 1;
+        /// @brief Method used to split faces with more than three vertices in triangles.
+        enum class Triangulation
+        {
+            /// @brief Fan of triangles around the first vertex, exact for convex polygons.
+            fan,
+
+            /// @brief Ear clipping for concave polygons, while convex ones still use a fan.
+            ///
+            /// Polygons that reference vertices not declared in the source keep the fan.
+            ear_clipping,
+        };
 
-        /// @brief Expected number of vertices.
-        std::size_t expected_vertex_count = 10'000;
+        /// @brief Expected number of objects, storage is reserved in advance unless it is 0.
+        std::size_t expected_object_count = 0;
 
-        /// @brief Expected number of triangle.
-        std::size_t expected_triangle_count = 10'000;
+        /// @brief Expected number of vertices, storage is reserved in advance unless it is 0.
+        std::size_t expected_vertex_count = 0;
+
+        /// @brief Expected number of triangle, storage is reserved in advance unless it is 0.
+        std::size_t expected_triangle_count = 0;
+
+        /// @brief Count the statements with a quick scan of the source text before parsing.
+        ///
+        /// Storage is then allocated exactly once and the expected counts are ignored.
+        bool prescan = false;
 
         ExtensionFlag flags = ExtensionFlag::standard;
+
+        /// @brief Method used to split polygonal faces in triangles.
+        Triangulation triangulation = Triangulation::fan;
+
+        /// @brief Store the faces as written in the source, in addition to their triangles.
+        bool keep_polygons = false;
+
+        /// @brief Check the face indices after parsing and convert them to zero-based.
+        ///
+        /// See normalize_indices().
+        bool zero_based_indices = false;
+
+        /// @brief Number of threads used to parse the source text.
+        ///
+        /// A value of 1 selects the serial parser, while 0 uses one thread for each hardware core.
+        std::size_t thread_count = 1;
+
+        /// @brief Minimum size in bytes of the chunk of source text assigned to each thread.
+        std::size_t min_chunk_size = 1 << 20;
+
+        /// @brief Memory resource for the containers of the result and the scratch buffers of the calling thread.
+        ///
+        /// A null pointer selects std::pmr::get_default_resource(). The resource is only used
+        /// by the calling thread, chunks parsed by other threads use the default resource
+        /// and are then moved into the result.
+        std::pmr::memory_resource* memory_resource = nullptr;
+
+        /// @brief Executor of the chunks of the parallel parser, such as a shared thread pool.
+        ///
+        /// A null pointer starts a thread for each chunk but the first one.
+        TaskExecutor* executor = nullptr;
+    };
+
+
+    /// @brief Configuration parameters for parsing into a visitor.
+    ///
+    /// The visitor stores the statements in its own layout, in source order, so only the options
+    /// of the parser itself apply: the triangulation, the storage and the threads are up to the visitor.
+    struct ObjVisitorConfig
+    {
+        /// @brief Memory resource for the scratch buffers of the parser.
+        ///
+        /// A null pointer selects std::pmr::get_default_resource().
+        std::pmr::memory_resource* memory_resource = nullptr;
     };
 
 
     /// @brief Output produced by parsing a .obj file.
-    //template <class Value = DefaultValueType, class Index = DefaultIndexType>
+    template <class Value = DefaultValueType, class Index = DefaultIndexType>
     struct ObjParserResult
     {
         /// @brief Geometric data.
-        MeshData data;
-        //MeshData<Value> data;
+        MeshData<Value, Index> data;
 
         /// @brief List of objects.
-        std::vector<Object> objects;
-        //std::vector<Object<Index>> objects;
+        std::pmr::vector<Object<Index>> objects;
+
+        /// @brief Faces as written in the source, filled if ObjParserConfig::keep_polygons is set.
+        PolygonData<Index> polygons;
+
+        /// @brief Smoothing groups of the faces, one run for each change of group.
+        ///
+        /// Faces before the first run aren't smoothed.
+        std::pmr::vector<SmoothingGroup<Index>> smoothing_groups;
 
         // TODO: add support for groups
         /// @brief List of groups.
         //std::vector<Group<Index>> groups;
     };
 
+    /// @brief Output produced by parsing a .obj file in structure of arrays layout.
+    template <class Value = DefaultValueType, class Index = std::uint32_t>
+    struct ObjParserSoaResult
+    {
+        /// @brief Geometric data.
+        SoaMeshData<Value, Index> data;
+
+        /// @brief List of objects.
+        std::pmr::vector<Object<Index>> objects;
+
+        /// @brief Faces as written in the source, filled if ObjParserConfig::keep_polygons is set.
+        PolygonData<Index> polygons;
+
+        /// @brief Smoothing groups of the faces, one run for each change of group.
+        ///
+        /// Faces before the first run aren't smoothed.
+        std::pmr::vector<SmoothingGroup<Index>> smoothing_groups;
+    };
+
+
+    /// @brief Receiver of the statements of a .obj file.
+    ///
+    /// Callbacks are invoked in source order, as soon as each statement is parsed,
+    /// so that consumers can store the data in their own layout without intermediate copies.
+    /// Statements without an overridden callback are validated and then discarded.
+    /// Callbacks that reject a statement report it through take_error(), instead of throwing.
+    template <class Value = DefaultValueType, class Index = DefaultIndexType>
+    class ObjVisitor
+    {
+    public:
+        using value_type = Value;
+        using index_type = Index;
+
+        virtual ~ObjVisitor() = default;
+
+        /// @brief Geometric vertex ('v' statement).
+        virtual void on_vertex(const Vertex<Value>&) {}
+
+        /// @brief Normal vector ('vn' statement).
+        virtual void on_normal(const Normal<Value>&) {}
+
+        /// @brief Texture vertex ('vt' statement).
+        virtual void on_texcoord(const Texcoord<Value>&) {}
+
+        /// @brief Face element ('f' statement), with one-based indices and relative ones made absolute.
+        virtual void on_face(const Face<Index>&) {}
+
+        /// @brief Face element with more than three vertices ('f' statement).
+        ///
+        /// By default the polygon is split in a fan of triangles, each one passed to on_face().
+        virtual void on_polygon(std::span<const Triplet<Index>> triplets)
+        {
+            for (std::size_t i = 1; i + 1 < std::size(triplets); ++i)
+                on_face({ { triplets[0], triplets[i], triplets[i + 1] } });
+        }
+
+        /// @brief Object name ('o' statement).
+        virtual void on_object(std::string_view /*name*/) {}
+
+        /// @brief Group names ('g' statement).
+        virtual void on_group(std::span<const Token> /*names*/) {}
+
+        /// @brief Material library files ('mtllib' statement).
+        virtual void on_material_library(std::span<const Token> /*files*/) {}
+
+        /// @brief Material reference ('usemtl' statement).
+        virtual void on_use_material(std::span<const Token> /*args*/) {}
+
+        /// @brief Smoothing group ('s' statement).
+        virtual void on_smoothing_group(std::span<const Token> /*args*/) {}
+
+        /// @brief Error raised by the callbacks of the last statement, cleared once taken.
+        ///
+        /// Polled by the parser after each statement, that is then reported as invalid.
+        [[nodiscard]] virtual std::optional<ParserErrorCode> take_error() noexcept { return std::nullopt; }
+    };
+
+
+    // faces stored in the result by the builders, besides their triangles
+    enum class _RecordedPolygons
+    {
+        none,
+        split, // only the ones with more than three vertices
+        all,
+    };
+
+    [[nodiscard]] constexpr _RecordedPolygons _recorded_polygons(const ObjParserConfig& c) noexcept
+    {
+        if (c.keep_polygons)
+            return _RecordedPolygons::all;
+        return (c.triangulation == ObjParserConfig::Triangulation::ear_clipping)
+                   ? _RecordedPolygons::split // needed to fix the fans once all vertices are known
+                   : _RecordedPolygons::none;
+    }
+
+
+    /// @brief Visitor that collects the statements in a ObjParserResult.
+    ///
+    /// Rejects objects with the name of a previous one, smoothing groups that aren't 'off' or a number,
+    /// and faces whose position in the result doesn't fit in the Index type.
+    template <class Value = DefaultValueType, class Index = DefaultIndexType>
+    class ObjResultBuilder final : public ObjVisitor<Value, Index>
+    {
+    public:
+        explicit ObjResultBuilder(ObjParserResult<Value, Index>& r, const ObjParserConfig& c = {}) noexcept
+            : _result{ r }, _polygons{ _recorded_polygons(c) } {}
+
+        void on_vertex(const Vertex<Value>& v) override;
+        void on_normal(const Normal<Value>& vn) override;
+        void on_texcoord(const Texcoord<Value>& vt) override;
+        void on_face(const Face<Index>& f) override;
+        void on_polygon(std::span<const Triplet<Index>> triplets) override;
+        void on_object(std::string_view name) override;
+        void on_smoothing_group(std::span<const Token> args) override;
+
+        [[nodiscard]] std::optional<ParserErrorCode> take_error() noexcept override
+        {
+            return _error ? std::exchange(_error, std::nullopt) : std::nullopt;
+        }
+
+    private:
+        ObjParserResult<Value, Index>& _result;
+        _RecordedPolygons              _polygons;
+        std::optional<ParserErrorCode> _error;
+
+        void _push_face(const Face<Index>& f);
+    };
+
+
+    /// @brief Visitor that collects the statements in a ObjParserSoaResult.
+    template <class Value = DefaultValueType, class Index = std::uint32_t>
+    class SoaResultBuilder final : public ObjVisitor<Value, Index>
+    {
+    public:
+        explicit SoaResultBuilder(ObjParserSoaResult<Value, Index>& r, const ObjParserConfig& c = {}) noexcept
+            : _result{ r }, _polygons{ _recorded_polygons(c) } {}
+
+        void on_vertex(const Vertex<Value>& v) override;
+        void on_normal(const Normal<Value>& vn) override;
+        void on_texcoord(const Texcoord<Value>& vt) override;
+        void on_face(const Face<Index>& f) override;
+        void on_polygon(std::span<const Triplet<Index>> triplets) override;
+        void on_object(std::string_view name) override;
+        void on_smoothing_group(std::span<const Token> args) override;
+
+        [[nodiscard]] std::optional<ParserErrorCode> take_error() noexcept override
+        {
+            return _error ? std::exchange(_error, std::nullopt) : std::nullopt;
+        }
+
+    private:
+        ObjParserSoaResult<Value, Index>& _result;
+        _RecordedPolygons                 _polygons;
+        std::optional<ParserErrorCode>    _error;
+
+        void _push_face(const Face<Index>& f);
+    };
+
+
+    /// @brief Parse the content of a file according to the .obj format, without throwing on errors.
+    ///
+    /// Parsing stops at the first error, that is reported with its location in the source text.
+    /// No exception is thrown but std::bad_alloc, so this is the only entry point of the parser
+    /// available when exceptions are disabled.
+    ///
+    /// @param[in] s Source text to parse.
+    /// @param[in] c Parser configuration.
+    ///
+    /// @return Parsed content, or the first error in source order.
+    template <class Value = DefaultValueType, class Index = DefaultIndexType>
+    [[nodiscard]] std::variant<ObjParserResult<Value, Index>, ParserErrorReport> try_parse(
+        const std::string_view s, const ObjParserConfig& c = {});
+
+    /// @brief Parse the content of a file according to the .obj format, skipping invalid statements.
+    ///
+    /// Parsing resumes at the line after each error, so that all of them are reported at once.
+    /// Invalid 'v', 'vn' and 'vt' statements still declare an element with default values,
+    /// so that the indices of the following faces refer to the same elements as in the source.
+    /// With ObjParserConfig::zero_based_indices set, indices are left one-based if some are invalid.
+    ///
+    /// @param[in] s Source text to parse.
+    /// @param[in] c Parser configuration.
+    ///
+    /// @return Content of the valid statements and errors in source order.
+    template <class Value = DefaultValueType, class Index = DefaultIndexType>
+    [[nodiscard]] std::tuple<ObjParserResult<Value, Index>, std::vector<ParserErrorReport>> try_force_parse(
+        const std::string_view s, const ObjParserConfig& c = {});
+
+    /// @brief Parse the content of a file according to the .obj format, without throwing on errors,
+    ///        storing geometric data in structure of arrays layout.
+    template <class Value = DefaultValueType, class Index = std::uint32_t>
+    [[nodiscard]] std::variant<ObjParserSoaResult<Value, Index>, ParserErrorReport> try_parse_soa(
+        const std::string_view s, const ObjParserConfig& c = {});
+
+    /// @brief Parse the content of a file according to the .obj format, skipping invalid statements,
+    ///        storing geometric data in structure of arrays layout.
+    template <class Value = DefaultValueType, class Index = std::uint32_t>
+    [[nodiscard]] std::tuple<ObjParserSoaResult<Value, Index>, std::vector<ParserErrorReport>> try_force_parse_soa(
+        const std::string_view s, const ObjParserConfig& c = {});
+
+    /// @brief Parse the content of a file according to the .obj format, without throwing on errors,
+    ///        forwarding each statement to a visitor.
+    ///
+    /// Statements before the first error have already been forwarded when it is reported.
+    ///
+    /// @param[in] s Source text to parse.
+    /// @param[in] v Receiver of the parsed statements.
+    /// @param[in] c Visitor parsing configuration.
+    ///
+    /// @return First error in source order, if any.
+    template <class Value, class Index>
+    [[nodiscard]] std::optional<ParserErrorReport> try_parse(
+        const std::string_view s, ObjVisitor<Value, Index>& v, const ObjVisitorConfig& c = {});
+
+
+    /// @brief Parser that keeps its storage across sources, to parse many of them without allocations.
+    ///
+    /// Each source replaces the result of the previous one, whose containers are emptied
+    /// but keep their capacity, while object names and face lists return to a pool owned
+    /// by the parser. Once the storage has grown, parsing sources of similar size doesn't
+    /// allocate memory and finds the lexer scratch and the result already in the caches.
+    /// The pool draws from ObjParserConfig::memory_resource, and like it is only used by the
+    /// calling thread: with several threads, the chunks parsed by the other ones still allocate
+    /// from the default resource before being merged into the kept storage.
+    /// Objects of this class are not thread-safe, use one for each thread.
+    template <class Value = DefaultValueType, class Index = DefaultIndexType>
+    class ObjParser
+    {
+    public:
+        explicit ObjParser(const ObjParserConfig& c = {});
+
+        ObjParser(const ObjParser&) = delete;
+        ObjParser& operator=(const ObjParser&) = delete;
+
+        /// @brief Parse the content of a file according to the .obj format, without throwing on errors.
+        ///
+        /// Parsing stops at the first error as with the free function try_parse(), and the content
+        /// of the result is then unspecified until the next source is parsed.
+        ///
+        /// @return First error in source order, if any.
+        [[nodiscard]] std::optional<ParserErrorReport> try_parse(const std::string_view s);
+
+#if !defined(_drako_disable_exceptions)
+        /// @brief Parse the content of a file according to the .obj format.
+        ///
+        /// @return Parsed content, valid until the next source is parsed.
+        ///
+        /// @throw ParserError On the first error, with the message and location reported by try_parse().
+        const ObjParserResult<Value, Index>& parse(const std::string_view s);
+
+        /// @brief Load .obj file, parsed directly from its memory mapping.
+        ///
+        /// @return Parsed content, valid until the next source is parsed.
+        ///
+        /// @throw std::system_error If the file cannot be opened or read.
+        /// @throw ParserError       On the first error in the content of the file.
+        const ObjParserResult<Value, Index>& load(const std::filesystem::path& p);
+#endif
+
+        /// @brief Result of the last source, valid until the next one is parsed.
+        [[nodiscard]] const ObjParserResult<Value, Index>& result() const noexcept { return _result; }
+
+        /// @brief Result of the last source, that can be modified in place until the next one is parsed.
+        [[nodiscard]] ObjParserResult<Value, Index>& result() noexcept { return _result; }
+
+    private:
+        ObjParserConfig                        _config; // with the pool as memory resource
+        std::pmr::unsynchronized_pool_resource _pool;
+        ObjParserResult<Value, Index>          _result;
+        std::vector<ParserErrorReport>         _errors;
+        LineLexer                              _lexer;
+        std::pmr::vector<Token>                _tokens;
+    };
+
+
+#if !defined(_drako_disable_exceptions) /*vvv exceptions vvv*/
+
+    /// @brief Incremental parser for .obj sources delivered in blocks of arbitrary size.
+    ///
+    /// Complete statements are forwarded to the visitor as soon as they are received,
+    /// while a trailing incomplete line is kept until the rest of it arrives,
+    /// so memory usage is bounded by the block size and the longest line.
+    /// Errors are located in the whole stream, and after one is thrown the parser must be discarded.
+    template <class Value = DefaultValueType, class Index = DefaultIndexType>
+    class ObjStreamParser
+    {
+    public:
+        explicit ObjStreamParser(ObjVisitor<Value, Index>& v, const ObjVisitorConfig& c = {});
+
+        /// @brief Parse all the lines completed by a block of source text.
+        void feed(const char* data, std::size_t size);
+
+        /// @brief Parse all the lines completed by a block of source text.
+        void feed(const std::string_view block) { feed(std::data(block), std::size(block)); }
+
+        /// @brief Parse the last line, if the source doesn't end with a line feed.
+        ///
+        /// Must be called once at the end of the input.
+        void finish();
+
+    private:
+        ObjVisitor<Value, Index>& _visitor;
+        ObjVisitorConfig          _config;
+        LineLexer                 _lexer;
+        std::pmr::vector<Token>   _tokens;
+        std::pmr::string          _pending;    // incomplete line carried over from previous blocks
+        StatementCounts           _declared;   // elements parsed so far, for relative indices
+        std::size_t               _lines  = 0; // line feeds parsed so far, to locate the errors
+        std::size_t               _offset = 0; // characters parsed so far
+
+        // parse the whole lines of [first, last), that starts a line of the stream
+        void _parse_block(const char* first, const char* last);
+    };
+
+
     /// @brief Parse the content of a file according to the .obj format.
     ///
+    /// Values and indices are parsed directly into the requested types,
+    /// supported ones are float and double for Value and unsigned integers
+    /// of 16, 32 and 64 bits for Index.
+    ///
     /// @param[in] s Source text to parse.
     /// @param[in] c Parser configuration.
     ///
     /// @return Parsed content.
-    //template <class Value = DefaultValueType, class Index = DefaultIndexType>
-    [[nodiscard]] ObjParserResult parse_as_obj(
+    ///
+    /// @throw ParserError On the first error, with the message and location reported by try_parse().
+    template <class Value = DefaultValueType, class Index = DefaultIndexType>
+    [[nodiscard]] ObjParserResult<Value, Index> parse_as_obj(
         const std::string& s, const ObjParserConfig& c = {});
 
 #if __cpp_lib_string_view
 
     /// @brief Parse the content of a file according to the .obj format.
-    [[nodiscard]] ObjParserResult parse_as_obj(
+    template <class Value = DefaultValueType, class Index = DefaultIndexType>
+    [[nodiscard]] ObjParserResult<Value, Index> parse_as_obj(
         const std::string_view s, const ObjParserConfig& c = {});
 #endif
 
 #if __cpp_lib_span
 
     /// @brief Parse the content of a file according to the .obj format.
-    [[nodiscard]] ObjParserResult parse_as_obj(
+    template <class Value = DefaultValueType, class Index = DefaultIndexType>
+    [[nodiscard]] ObjParserResult<Value, Index> parse_as_obj(
         const std::span<const char> s, const ObjParserConfig& c = {});
 #endif
 
+
+    /// @brief Parse a file according to the .obj format while it is being read.
+    ///
+    /// Lines are parsed as soon as the blocks that contain them have been read, while the reads
+    /// of the following blocks are in flight, so that loading a large file takes about as long
+    /// as the slowest of reading and parsing rather than their sum. Statements can't be counted
+    /// in advance, so ObjParserConfig::prescan is ignored, and the parallel parser needs the
+    /// whole source, so with more than one thread the file is read before parsing it.
+    ///
+    /// @param[in] f File being read.
+    /// @param[in] c Parser configuration.
+    ///
+    /// @return Parsed content.
+    ///
+    /// @throw std::system_error If a read fails.
+    /// @throw ParserError       On the first error, with the message and location reported by try_parse().
+    template <class Value = DefaultValueType, class Index = DefaultIndexType>
+    [[nodiscard]] ObjParserResult<Value, Index> parse_as_obj(AsyncFile& f, const ObjParserConfig& c = {});
+
+
+    /// @brief Parse the content of a file according to the .obj format,
+    ///        storing geometric data in structure of arrays layout.
+    ///
+    /// @param[in] s Source text to parse.
+    /// @param[in] c Parser configuration.
+    ///
+    /// @return Parsed content.
+    ///
+    /// @throw ParserError On the first error, with the message and location reported by try_parse().
+    template <class Value = DefaultValueType, class Index = std::uint32_t>
+    [[nodiscard]] ObjParserSoaResult<Value, Index> parse_as_obj_soa(
+        const std::string& s, const ObjParserConfig& c = {});
+
+#if __cpp_lib_string_view
+
+    /// @brief Parse the content of a file according to the .obj format,
+    ///        storing geometric data in structure of arrays layout.
+    template <class Value = DefaultValueType, class Index = std::uint32_t>
+    [[nodiscard]] ObjParserSoaResult<Value, Index> parse_as_obj_soa(
+        const std::string_view s, const ObjParserConfig& c = {});
+#endif
+
+#if __cpp_lib_span
+
+    /// @brief Parse the content of a file according to the .obj format,
+    ///        storing geometric data in structure of arrays layout.
+    template <class Value = DefaultValueType, class Index = std::uint32_t>
+    [[nodiscard]] ObjParserSoaResult<Value, Index> parse_as_obj_soa(
+        const std::span<const char> s, const ObjParserConfig& c = {});
+#endif
+
+
+    /// @brief Parse the content of a file according to the .obj format,
+    ///        forwarding each statement to a visitor.
+    ///
+    /// @param[in] s Source text to parse.
+    /// @param[in] v Receiver of the parsed statements.
+    /// @param[in] c Visitor parsing configuration.
+    template <class Value, class Index>
+    void parse_as_obj(const std::string& s, ObjVisitor<Value, Index>& v, const ObjVisitorConfig& c = {});
+
+#if __cpp_lib_string_view
+
+    /// @brief Parse the content of a file according to the .obj format,
+    ///        forwarding each statement to a visitor.
+    template <class Value, class Index>
+    void parse_as_obj(const std::string_view s, ObjVisitor<Value, Index>& v, const ObjVisitorConfig& c = {});
+#endif
+
+#if __cpp_lib_span
+
+    /// @brief Parse the content of a file according to the .obj format,
+    ///        forwarding each statement to a visitor.
+    template <class Value, class Index>
+    void parse_as_obj(const std::span<const char> s, ObjVisitor<Value, Index>& v, const ObjVisitorConfig& c = {});
+#endif
+
+
+    /// @brief Check that the indices of all faces refer to existing elements.
+    ///
+    /// Indices are expected one-based, with zero only for missing texture vertices and normals,
+    /// as produced by the parser. Faces are split among the given number of threads,
+    /// where 0 uses one thread for each hardware core.
+    ///
+    /// @throw ParserError With the index_out_of_range message and the position of the first invalid face.
+    template <class Value, class Index>
+    void validate_indices(const MeshData<Value, Index>& d, std::size_t thread_count = 1);
+
+    /// @brief Check that the indices of all faces refer to existing elements.
+    template <class Value, class Index>
+    void validate_indices(const SoaMeshData<Value, Index>& d, std::size_t thread_count = 1);
+
+    /// @brief Check the indices of all faces, then convert them to zero-based.
+    ///
+    /// Missing texture vertices and normals get the largest value of Index.
+    /// Data is left unchanged if validation fails.
+    ///
+    /// @throw ParserError As validate_indices().
+    template <class Value, class Index>
+    void normalize_indices(MeshData<Value, Index>& d, std::size_t thread_count = 1);
+
+    /// @brief Check the indices of all faces, then convert them to zero-based.
+    template <class Value, class Index>
+    void normalize_indices(SoaMeshData<Value, Index>& d, std::size_t thread_count = 1);
+
+#endif /*^^^ exceptions ^^^*/
+
 } // namespace obj
 
 #endif // !OBJCPP_OBJ_PARSER_HPP
\ No newline at end of file
@@ -0,0 +1,107 @@
+#pragma once
+#ifndef OBJCPP_OBJ_WRITER_HPP
+#define OBJCPP_OBJ_WRITER_HPP
+
+#include "obj-cpp/core.hpp"
+#include "obj-cpp/mtl_parser.hpp"
+#include "obj-cpp/obj_parser.hpp"
+
+#include <filesystem>
+#include <string>
+
+namespace obj
+{
+    /// @brief Configuration parameters for the writer.
+    using ObjWriterConfig = MeshProcessingConfig;
+
+
+    /// @brief Format mesh data as the content of a .obj file.
+    ///
+    /// Values are written in the shortest form that parses back to the same value, vertex weights
+    /// and third texture coordinates only when they differ from their defaults, and face indices
+    /// as absolute v/vt/vn triplets. Large meshes are formatted in chunks by different threads,
+    /// each one in its own buffer, and the chunks are then concatenated.
+    ///
+    /// @param[in] d Mesh data to write.
+    /// @param[in] c Writer configuration.
+    ///
+    /// @return Text that parse_as_obj() turns back into the same mesh data.
+    ///
+    /// @throw std::invalid_argument If a value is nan or infinite.
+    template <class Value, class Index>
+    [[nodiscard]] std::string format_obj(const MeshData<Value, Index>& d, const ObjWriterConfig& c = {});
+
+    /// @brief Format a parsed .obj file, with its objects, smoothing groups and polygons.
+    ///
+    /// Faces that don't belong to any object are written first, followed by each object with
+    /// its faces in the order of its list, so that a parsed result is written in source order.
+    /// Faces recorded with ObjParserConfig::keep_polygons are written as the original polygons.
+    ///
+    /// @throw std::out_of_range     If an object or a polygon refers to a face that doesn't exist.
+    /// @throw std::invalid_argument If a value is nan or infinite, or an object name is empty or
+    ///                              isn't a single token.
+    template <class Value, class Index>
+    [[nodiscard]] std::string format_obj(const ObjParserResult<Value, Index>& r, const ObjWriterConfig& c = {});
+
+    /// @brief Format materials as the content of a .mtl file.
+    ///
+    /// Only the statements read by parse_as_mtl() are written.
+    ///
+    /// @throw std::invalid_argument If a value is nan or infinite, or a material name is empty or
+    ///                              isn't a single token.
+    [[nodiscard]] std::string format_mtl(const MtlParserResult& r);
+
+
+    /// @brief Write mesh data to a .obj file, see format_obj().
+    ///
+    /// @throw std::invalid_argument If a value is nan or infinite.
+    /// @throw std::system_error     If the file cannot be written.
+    template <class Value, class Index>
+    void write_obj(const MeshData<Value, Index>& d, const std::filesystem::path& p, const ObjWriterConfig& c = {});
+
+    /// @brief Write a parsed .obj file, see format_obj().
+    ///
+    /// @throw std::out_of_range     If an object or a polygon refers to a face that doesn't exist.
+    /// @throw std::invalid_argument If a value or an object name cannot be written, see format_obj().
+    /// @throw std::system_error     If the file cannot be written.
+    template <class Value, class Index>
+    void write_obj(const ObjParserResult<Value, Index>& r, const std::filesystem::path& p, const ObjWriterConfig& c = {});
+
+    /// @brief Write materials to a .mtl file, see format_mtl().
+    ///
+    /// @throw std::invalid_argument If a value or a material name cannot be written, see format_mtl().
+    /// @throw std::system_error     If the file cannot be written.
+    void write_mtl(const MtlParserResult& r, const std::filesystem::path& p);
+
+
+    /// @brief Writer of .obj and .mtl files, counterpart of Reader.
+    class Writer
+    {
+    public:
+        explicit Writer(const ObjWriterConfig& c = {})
+            : _config{ c } {}
+
+        /// @brief Save .obj file.
+        template <class Value, class Index>
+        void save(const ObjParserResult<Value, Index>& r, const std::filesystem::path& p) const
+        {
+            write_obj(r, p, _config);
+        }
+
+        /// @brief Save .obj file with mesh data only.
+        template <class Value, class Index>
+        void save(const MeshData<Value, Index>& d, const std::filesystem::path& p) const
+        {
+            write_obj(d, p, _config);
+        }
+
+        /// @brief Save .mtl file.
+        void save_mtl(const MtlParserResult& r, const std::filesystem::path& p) const { write_mtl(r, p); }
+
+    private:
+        ObjWriterConfig _config;
+    };
+
+} // namespace obj
+
+#endif // !OBJCPP_OBJ_WRITER_HPP
@@ -0,0 +1,108 @@
+#pragma once
+#ifndef OBJCPP_PARALLEL_HPP
+#define OBJCPP_PARALLEL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace obj
+{
+    /// @brief Number of threads to use, where 0 selects one thread for each hardware core.
+    [[nodiscard]] inline std::size_t _thread_count(std::size_t threads) noexcept
+    {
+        return (threads == 0) ? std::max<std::size_t>(std::thread::hardware_concurrency(), 1) : threads;
+    }
+
+    /// @brief Split [0, n) in ranges of at least min_size elements, one for each thread.
+    ///
+    /// @return Boundaries of the ranges as [b0, b1, ..., bn].
+    [[nodiscard]] inline std::vector<std::size_t> _split_range(std::size_t n, std::size_t threads, std::size_t min_size)
+    {
+        const auto parts = std::clamp<std::size_t>(n / min_size, 1, _thread_count(threads));
+
+        std::vector<std::size_t> bounds;
+        for (std::size_t i = 0; i <= parts; ++i)
+            bounds.push_back(i * n / parts);
+        return bounds;
+    }
+
+    /// @brief Run a function on the ranges [b(i), b(i + 1)), each one on its own thread,
+    ///        and collect the results in order.
+    template <class Function>
+    [[nodiscard]] auto _map_ranges(const std::vector<std::size_t>& bounds, Function f)
+    {
+        std::vector<std::future<decltype(f(0, 0))>> futures;
+        for (std::size_t i = 1; i < std::size(bounds) - 1; ++i)
+            futures.push_back(std::async(std::launch::async, f, bounds[i], bounds[i + 1]));
+
+        std::vector<decltype(f(0, 0))> results{ f(bounds[0], bounds[1]) };
+        for (auto& r : futures)
+            results.push_back(r.get());
+        return results;
+    }
+
+    /// @brief Run a function on the ranges of [0, n), each one on its own thread,
+    ///        and collect the results in order.
+    template <class Function>
+    [[nodiscard]] auto _map_ranges(std::size_t n, std::size_t threads, Function f)
+    {
+        return _map_ranges(_split_range(n, threads, 1 << 16), f);
+    }
+
+    /// @brief Runs groups of tasks concurrently, to share a thread pool among parsers.
+    class TaskExecutor
+    {
+    public:
+        virtual ~TaskExecutor() = default;
+
+        /// @brief Run all the tasks and return once each one is completed.
+        ///
+        /// The first task is run by the calling thread, the other ones possibly
+        /// concurrently with it. If tasks throw, the first exception is rethrown
+        /// once all of them are completed.
+        virtual void run_all(std::span<const std::function<void()>> tasks) = 0;
+    };
+
+    /// @brief Run all the tasks, each one after the first on its own thread.
+    inline void _run_all_async(std::span<const std::function<void()>> tasks)
+    {
+        std::vector<std::future<void>> futures;
+        futures.reserve(std::size(tasks));
+        for (std::size_t i = 1; i < std::size(tasks); ++i)
+            futures.push_back(std::async(std::launch::async, tasks[i]));
+
+        std::exception_ptr error;
+        try
+        {
+            if (!std::empty(tasks))
+                tasks[0]();
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+        for (auto& f : futures) // wait for all tasks, even after a failure
+        {
+            try
+            {
+                f.get();
+            }
+            catch (...)
+            {
+                if (!error)
+                    error = std::current_exception();
+            }
+        }
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+} // namespace obj
+
+#endif // !OBJCPP_PARALLEL_HPP
\ No newline at end of file
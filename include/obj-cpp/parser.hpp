@@ -3,8 +3,11 @@
 #define OBJCPP_PARSER_HPP
 
 #include "obj-cpp/core.hpp"
+#include "obj-cpp/float_parser.hpp"
 #include "obj-cpp/lexer.hpp"
 
+#include <algorithm>
+#include <cassert>
 #include <charconv>
 #include <stdexcept>
 #include <string>
@@ -33,7 +36,8 @@ namespace obj
         tag_v_invalid_args_count,
         tag_vn_invalid_args_count,
         tag_vt_invalid_args_count,
-        unknown_tag
+        unknown_tag,
+        invalid_character
     };
 
     [[nodiscard]] inline std::string to_string(ParserErrorCode ec) noexcept
@@ -49,14 +53,63 @@ namespace obj
             case _pec::tag_v_invalid_args_count: return "Tag 'v' requires 3 or 4 arguments.";
             case _pec::tag_vn_invalid_args_count: return "Tag 'vn' requires 3 arguments.";
             case _pec::tag_vt_invalid_args_count: return "Tag 'vt' requires 2 or 3 arguments.";
-            case _pec::tag_f_invalid_args_count: return "Tag 'f' requires 3 arguments.";
+            case _pec::tag_f_invalid_args_count: return "Tag 'f' requires at least 3 arguments.";
             case _pec::tag_f_invalid_args_format: return "Invalid triplet format.";
             case _pec::unknown_tag: return "Unknown tag.";
+            case _pec::invalid_character: return "Invalid character.";
             default: return "Unknown error code.";
         }
     }
 
 
+    /// @brief Report data of a parsing error.
+    ///
+    /// Errors found after the whole source has been parsed, like invalid indices,
+    /// are located at the statement that caused them as well.
+    class ParserErrorReport
+    {
+    public:
+        explicit constexpr ParserErrorReport(
+            std::size_t row, std::size_t col, std::size_t offset, ParserErrorCode ec) noexcept
+            : _char_index{ offset }, _row{ row }, _col{ col }, _ec{ ec } {}
+
+        /// @brief Index of the character in the buffer.
+        ///
+        [[nodiscard]] constexpr std::size_t
+        char_index() const noexcept { return _char_index; }
+
+        /// @brief Line number location of the error.
+        ///
+        [[nodiscard]] constexpr std::size_t
+        line() const noexcept { return _row; }
+
+        /// @brief Column number location of the error.
+        ///
+        [[nodiscard]] constexpr std::size_t
+        column() const noexcept { return _col; }
+
+        /// @brief Error code.
+        ///
+        [[nodiscard]] constexpr ParserErrorCode
+        code() const noexcept { return _ec; }
+
+        /// @brief Numeric value of the error code.
+        ///
+        [[nodiscard]] constexpr std::underlying_type_t<ParserErrorCode>
+        value() const noexcept { return static_cast<std::underlying_type_t<ParserErrorCode>>(_ec); }
+
+        /// @brief Short explanatory description of the error.
+        ///
+        [[nodiscard]] std::string
+        message() const noexcept { return to_string(_ec); }
+
+    private:
+        std::size_t     _char_index; // [ 0, size(source) )  , zero-based
+        std::size_t     _row;        // [ 1, #rows ]         , one-based
+        std::size_t     _col;        // [ 1, size(col) ]     , one-based
+        ParserErrorCode _ec;
+    };
+
     /// @brief Exception class for parser errors.
     class ParserError : public std::runtime_error
     {
@@ -69,6 +122,11 @@ namespace obj
 
         explicit ParserError(const std::string& s)
             : std::runtime_error{ s } {}
+
+        explicit ParserError(const ParserErrorReport& r)
+            : std::runtime_error{ (r.line() == 0) ? r.message()
+                                                  : r.message() + " Line " + std::to_string(r.line()) +
+                                                        ", column " + std::to_string(r.column()) + "." } {}
     };
 
     class ParserTokenError : public ParserError
@@ -108,131 +166,80 @@ namespace obj
             : row{ row }, col{ col }, offset{ offset }, warc{ wc } {}
     };*/
 
-    /// @brief Report data of a parsing error.
-    class ParserErrorReport
-    {
-    public:
-        explicit constexpr ParserErrorReport(
-            std::size_t row, std::size_t col, std::size_t offset, ParserErrorCode ec) noexcept
-            : _char_index{ offset }, _row{ row }, _col{ col }, _ec{ ec } {}
-
-        /// @brief Index of the character in the buffer.
-        ///
-        [[nodiscard]] constexpr std::size_t
-        char_index() const noexcept { return _char_index; }
-
-        /// @brief Line number location of the error.
-        ///
-        [[nodiscard]] constexpr std::size_t
-        line() const noexcept { return _row; }
-
-        /// @brief Column number location of the error.
-        ///
-        [[nodiscard]] constexpr std::size_t
-        column() const noexcept { return _col; }
-
-        /// @brief Error code.
-        ///
-        [[nodiscard]] constexpr std::underlying_type_t<ParserErrorCode>
-        value() const noexcept { return static_cast<std::underlying_type_t<ParserErrorCode>>(_ec); }
-
-        /// @brief Short explanatory description of the error.
-        ///
-        [[nodiscard]] std::string
-        message() const noexcept { return to_string(_ec); }
-
-    private:
-        std::size_t     _char_index; // [ 0, size(source) )  , zero-based
-        std::size_t     _row;        // [ 1, #rows ]         , one-based
-        std::size_t     _col;        // [ 1, size(col) ]     , one-based
-        ParserErrorCode _ec;
-    };
-
 #if !defined(_drako_disable_exceptions) /*vvv exceptions vvv*/
 
     // parse an index integer according to specs
-    //template <class Index>
+    template <class Index = DefaultIndexType>
     [[nodiscard]] inline Index parse_index(const char* first, const char* last)
     {
+        static_assert(std::is_integral_v<Index> && std::is_unsigned_v<Index>,
+            "Indices must be unsigned integers");
+
         Index v{};
-        if (const auto r = std::from_chars(first, last, v); r.ec != std::errc{})
+        if (const auto r = std::from_chars(first, last, v); r.ec == std::errc::result_out_of_range)
+            throw ParserError{ ParserErrorCode::index_out_of_range };
+        else if (r.ec != std::errc{})
             throw ParserError{ "Cannot parse " + std::string(first, last) + " as index" };
         //throw ParserError{ ParserErrorCode::invalid_arg_format };
         return v;
     }
 
     // parse an index integer according to specs
-    //template <class Index>
+    template <class Index = DefaultIndexType>
     [[nodiscard]] inline Index parse_index(const Token& t)
     {
-        return parse_index(std::data(t), std::data(t) + std::size(t));
+        return parse_index<Index>(std::data(t), std::data(t) + std::size(t));
     }
 
-    //template <class Value>
+    template <class Value = DefaultValueType>
     [[nodiscard]] inline Value parse_value(const char* first, const char* last)
     {
         Value v{};
-        if (const auto r = std::from_chars(first, last, v, std::chars_format::fixed);
-            r.ec != std::errc{})
+        if (const auto r = parse_float(first, last, v); r.ec != std::errc{} || r.ptr != last)
             throw ParserError{ "Cannot parse " + std::string(first, last) + " as value" };
         //throw ParserError{ ParserErrorCode::invalid_arg_format };
         return v;
     }
 
     // parse a floating point value according to specs
-    //template <class Value>
+    template <class Value = DefaultValueType>
     [[nodiscard]] inline Value parse_value(const Token& t)
     {
-        return parse_value(std::data(t), std::data(t) + std::size(t));
+        return parse_value<Value>(std::data(t), std::data(t) + std::size(t));
     }
 
-    //template <class Index>
-    [[nodiscard]] inline Triplet parse_triplet(const Token& t)
+    template <class Index = DefaultIndexType>
+    [[nodiscard]] inline Triplet<Index> parse_triplet(const Token& t)
     {
         assert(std::size(t) > 0);
 
         if (std::count(std::cbegin(t), std::cend(t), '/') != 2)
             throw ParserError{ ParserErrorCode::invalid_arg_format };
 
-        Triplet triplet{};
+        Triplet<Index> triplet{};
 
         const auto beg_1 = 0;
         const auto end_1 = t.find_first_of('/');
         if (end_1 == beg_1) // there must be the vertex index at least
             throw ParserError{ ParserErrorCode::invalid_arg_format };
-        triplet.v = parse_index(t.substr(beg_1, end_1));
+        triplet.v = parse_index<Index>(t.substr(beg_1, end_1));
         //triplet.v = parse_index(std::data(t), std::data(t) + end_1);
 
         const auto beg_2 = end_1 + 1;
         const auto end_2 = t.find_first_of('/', beg_2);
         if ((end_2 - end_1) > 1) // at least one character
-            triplet.vt = parse_index(t.substr(beg_2, end_2 - beg_2));
+            triplet.vt = parse_index<Index>(t.substr(beg_2, end_2 - beg_2));
 
         const auto beg_3 = end_2 + 1;
         const auto end_3 = std::size(t);
         if ((end_3 - end_2) > 1) // at least one character
-            triplet.vn = parse_index(t.substr(beg_3, end_3 - beg_3));
+            triplet.vn = parse_index<Index>(t.substr(beg_3, end_3 - beg_3));
         //triplet.vn = parse_index(std::data(t) + beg_3, std::data(t) + end_3);
 
         return triplet;
     }
 
-#else /*^^^ exceptions ^^^/vvv error codes vvv*/
-
-
-    /// @brief Parse an ASCII string according to OBJ format.
-    ///
-    /// Stops at first parsing error.
-    ///
-    [[nodiscard]] std::variant<ParserResult, ParserErrorReport>
-    try_parse(const std::string_view source, const ParserConfig& config) noexcept;
-
-    /// @brief Parse an ASCII string acoording to OBJ format.
-    ///
-    [[nodiscard]] std::tuple<ParserResult, std::vector<ParserErrorReport>>
-    try_force_parse(const std::string_view source, const ParserConfig& config) noexcept;
-
-#endif /*^^^ error codes ^^^*/
+#endif /*^^^ exceptions ^^^*/
 
 } // namespace obj
 
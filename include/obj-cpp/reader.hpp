@@ -1,6 +1,9 @@
 #ifndef OBJCPP_READER_HPP
 #define OBJCPP_READER_HPP
 
+#include "obj-cpp/async_file.hpp"
+#include "obj-cpp/cache.hpp"
+#include "obj-cpp/mapped_file.hpp"
 #include "obj-cpp/obj.hpp"
 
 #include <filesystem>
@@ -12,16 +15,71 @@ namespace obj
     class Reader
     {
     public:
+        explicit Reader(const ObjParserConfig& c = {})
+            : _config{ c } {}
 
         /// @brief Load .obj file.
-        [[nodiscard]] ObjParserResult load(const std::filesystem::path& p);
+        ///
+        /// The file is parsed directly from its memory mapping, without intermediate copies.
+        [[nodiscard]] ObjParserResult<Value, Index> load(const std::filesystem::path& p)
+        {
+            const MappedFile file{ p };
+            return parse_as_obj<Value, Index>(file.view(), _config);
+        }
+
+        /// @brief Load .obj file, parsing each block of it while the following ones are being read.
+        ///
+        /// See parse_as_obj(AsyncFile&, const ObjParserConfig&).
+        [[nodiscard]] ObjParserResult<Value, Index> load_async(
+            const std::filesystem::path& p, const AsyncFileConfig& io = {})
+        {
+            AsyncFile file{ p, io };
+            return parse_as_obj<Value, Index>(file, _config);
+        }
+
+        /// @brief Load .obj file through a binary cache.
+        ///
+        /// The cache is used when it is not older than the .obj file and it has been written
+        /// by a compatible build with the same parser options, otherwise the .obj file is parsed
+        /// and the cache is written again.
+        [[nodiscard]] MeshCache<Value, Index> load_cached(
+            const std::filesystem::path& p, const std::filesystem::path& cache)
+        {
+            if (is_cache_fresh(p, cache))
+            {
+                try
+                {
+                    return MeshCache<Value, Index>{ cache, _config };
+                }
+                catch (const CacheError&)
+                {
+                }
+            }
+            write_cache(load(p), cache, _config);
+            return MeshCache<Value, Index>{ cache, _config };
+        }
+
+        /// @brief Load .obj file through a binary cache stored next to it, with the '.cache' suffix.
+        [[nodiscard]] MeshCache<Value, Index> load_cached(const std::filesystem::path& p)
+        {
+            auto cache = p;
+            cache += ".cache";
+            return load_cached(p, cache);
+        }
+
+        /// @brief Load .mtl file.
+        [[nodiscard]] MtlParserResult load_mtl(const std::filesystem::path& p)
+        {
+            const MappedFile file{ p };
+            return parse_as_mtl(file.view());
+        }
 
     private:
-        std::string _buffer;
+        ObjParserConfig _config;
     };
 
 
 
 } // namespace obj
 
-#endif // !OBJCPP_READER_HPP
\ No newline at end of file
+#endif // !OBJCPP_READER_HPP
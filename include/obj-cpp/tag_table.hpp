@@ -0,0 +1,84 @@
+#pragma once
+#ifndef OBJCPP_TAG_TABLE_HPP
+#define OBJCPP_TAG_TABLE_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace obj
+{
+    // not constexpr, so that reaching it in a constant evaluation fails to compile
+    void _no_perfect_hash_for_tags();
+
+    /// @brief Compile-time perfect hash table of statement tags.
+    ///
+    /// Tags are hashed by their length, first and last character, with a multiplier
+    /// chosen at compile time so that every tag gets its own slot.
+    /// A lookup costs one multiplication and a single comparison with the tag in the slot.
+    ///
+    /// @tparam N Number of tags.
+    template <std::size_t N>
+    class TagTable
+    {
+    public:
+        /// @brief Value returned for tags that aren't in the table.
+        static constexpr std::size_t npos = N;
+
+        /// @brief Build the table.
+        ///
+        /// Fails to compile if two tags have the same length, first and last character.
+        consteval explicit TagTable(const std::array<std::string_view, N>& tags)
+        {
+            for (_multiplier = 0x9E3779B1; !_try_build(tags); _multiplier += 2)
+                if (_multiplier > 0x9E3779B1 + 2 * 1'000'000) // no perfect hash for these tags
+                    _no_perfect_hash_for_tags();
+        }
+
+        /// @brief Position of a tag in the list used to build the table, or npos if missing.
+        [[nodiscard]] constexpr std::size_t find(const std::string_view tag) const noexcept
+        {
+            if (std::empty(tag))
+                return npos;
+
+            const auto slot = _slot(tag);
+            return (_tags[slot] == tag) ? _ids[slot] : npos;
+        }
+
+    private:
+        // enough slots to find a multiplier quickly
+        static constexpr std::size_t _bits  = std::bit_width(4 * N - 1);
+        static constexpr std::size_t _slots = std::size_t{ 1 } << _bits;
+
+        std::array<std::string_view, _slots> _tags{};
+        std::array<std::size_t, _slots>      _ids{};
+        std::uint32_t                        _multiplier = 0;
+
+        [[nodiscard]] constexpr std::size_t _slot(const std::string_view tag) const noexcept
+        {
+            const auto key = static_cast<std::uint32_t>(static_cast<unsigned char>(tag.front())) |
+                             static_cast<std::uint32_t>(static_cast<unsigned char>(tag.back())) << 8 |
+                             static_cast<std::uint32_t>(std::size(tag)) << 16;
+            return static_cast<std::size_t>((key * _multiplier) >> (32 - _bits));
+        }
+
+        [[nodiscard]] constexpr bool _try_build(const std::array<std::string_view, N>& tags)
+        {
+            _tags = {};
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                const auto slot = _slot(tags[i]);
+                if (!std::empty(_tags[slot]))
+                    return false;
+                _tags[slot] = tags[i];
+                _ids[slot]  = i;
+            }
+            return true;
+        }
+    };
+
+} // namespace obj
+
+#endif // !OBJCPP_TAG_TABLE_HPP
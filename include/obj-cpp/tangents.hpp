@@ -0,0 +1,63 @@
+#pragma once
+#ifndef OBJCPP_TANGENTS_HPP
+#define OBJCPP_TANGENTS_HPP
+
+#include "obj-cpp/core.hpp"
+
+#include <vector>
+
+namespace obj
+{
+    /// @brief Configuration parameters for tangent generation.
+    using TangentConfig = MeshProcessingConfig;
+
+
+    /// @brief Tangent of a face vertex, in the direction of increasing u texture coordinate.
+    template <class Value = DefaultValueType>
+    struct Tangent
+    {
+        /// @brief The x component.
+        Value x;
+
+        /// @brief The y component.
+        Value y;
+
+        /// @brief The z component.
+        Value z;
+
+        /// @brief Handedness of the tangent space, the bitangent is w * cross(normal, tangent).
+        Value w;
+
+        [[nodiscard]] constexpr bool operator==(const Tangent&) const noexcept = default;
+        [[nodiscard]] constexpr bool operator!=(const Tangent&) const noexcept = default;
+    };
+
+
+    /// @brief Compute the tangent space of each face vertex for normal mapping.
+    ///
+    /// Tangents are computed as the reference implementation of MikkTSpace does with its default
+    /// angular threshold, given the triangles of the mesh, so they match normal maps baked with
+    /// MikkTSpace from the same triangulated mesh. Vertices with the same position, normal and
+    /// texture coordinates are merged. Around each of them, the faces that share an edge and have
+    /// the same orientation of the texture mapping are grouped, and their tangents are projected
+    /// on the plane of the normal and averaged, weighted by the angle at the vertex.
+    /// Faces whose texture coordinates have no area join the group of a neighbor without contributing,
+    /// and faces with two equal positions take the tangents of other faces at the same vertices.
+    /// Vertices left without a group get the tangent (1, 0, 0, -1).
+    ///
+    /// @param[in] d Mesh data with texture vertices and normals.
+    /// @param[in] c Tangent generation configuration.
+    ///
+    /// @return Tangent of each face vertex, three for each face.
+    ///
+    /// @throw std::out_of_range If an index doesn't refer to an existing element.
+    template <class Value, class Index>
+    [[nodiscard]] std::vector<Tangent<Value>> generate_tangents(const MeshData<Value, Index>& d, const TangentConfig& c = {});
+
+    /// @brief Compute the tangent space of each face vertex for normal mapping.
+    template <class Value, class Index>
+    [[nodiscard]] std::vector<Tangent<Value>> generate_tangents(const SoaMeshData<Value, Index>& d, const TangentConfig& c = {});
+
+} // namespace obj
+
+#endif // !OBJCPP_TANGENTS_HPP
\ No newline at end of file
@@ -0,0 +1,79 @@
+#pragma once
+#ifndef OBJCPP_THREAD_POOL_HPP
+#define OBJCPP_THREAD_POOL_HPP
+
+#include "obj-cpp/parallel.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace obj
+{
+    /// @brief Pool of threads that balance the load by stealing tasks from each other.
+    ///
+    /// Each thread has its own queue, where it pushes the tasks it submits and pops them
+    /// in last-in first-out order, while idle threads steal the oldest tasks of the other
+    /// queues. Threads waiting for their tasks to complete run other tasks in the meantime,
+    /// so tasks can submit and wait for further tasks without blocking the pool.
+    class WorkStealingPool final : public TaskExecutor
+    {
+    public:
+        /// @brief Start the threads of the pool.
+        ///
+        /// @param[in] thread_count Number of threads, including the one calling run_all(),
+        ///                         where 0 uses one thread for each hardware core.
+        explicit WorkStealingPool(std::size_t thread_count = 0);
+
+        WorkStealingPool(const WorkStealingPool&) = delete;
+        WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+        /// @brief Wait for the running tasks and stop the threads.
+        ~WorkStealingPool() noexcept override;
+
+        /// @brief Run all the tasks on the pool and return once each one is completed.
+        ///
+        /// The calling thread runs the first task and then helps the pool,
+        /// it may also be one of the threads of the pool.
+        void run_all(std::span<const std::function<void()>> tasks) override;
+
+        /// @brief Number of threads that run the tasks, including the one calling run_all().
+        [[nodiscard]] std::size_t thread_count() const noexcept { return std::size(_threads) + 1; }
+
+    private:
+        struct _Group;
+
+        struct _Task
+        {
+            const std::function<void()>* function;
+            _Group*                      group;
+        };
+
+        struct _Queue
+        {
+            std::mutex        mutex;
+            std::deque<_Task> tasks;
+        };
+
+        std::vector<std::unique_ptr<_Queue>> _queues; // one for each thread, and one for other threads
+        std::vector<std::thread>             _threads;
+        std::atomic<std::size_t>             _queued{ 0 };
+        std::mutex                           _idle_mutex;
+        std::condition_variable              _idle;
+        bool                                 _stop = false;
+
+        void _work(std::size_t index);
+        [[nodiscard]] bool _try_run(std::size_t queue);
+        void _run(const _Task& t) noexcept;
+    };
+
+} // namespace obj
+
+#endif // !OBJCPP_THREAD_POOL_HPP
@@ -0,0 +1,167 @@
+#pragma once
+#ifndef OBJCPP_VERTEX_CACHE_HPP
+#define OBJCPP_VERTEX_CACHE_HPP
+
+#include "obj-cpp/core.hpp"
+#include "obj-cpp/obj_parser.hpp"
+#include "obj-cpp/welding.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace obj
+{
+    /// @brief Configuration parameters for vertex cache optimization.
+    struct VertexCacheConfig
+    {
+        /// @brief Number of vertices kept by the simulated FIFO cache of post-transform vertices.
+        std::size_t cache_size = 16;
+
+        /// @brief See MeshProcessingConfig::zero_based_indices.
+        bool zero_based_indices = false;
+    };
+
+
+    /// @brief Efficiency of a vertex cache, measured by simulating a FIFO cache.
+    struct VertexCacheStats
+    {
+        /// @brief Number of vertices processed, that is cache misses.
+        std::size_t transformed = 0;
+
+        /// @brief Number of triangles.
+        std::size_t triangles = 0;
+
+        /// @brief Number of distinct vertices referenced by the triangles.
+        std::size_t vertices = 0;
+
+        /// @brief Average cache miss ratio, transformed vertices for each triangle.
+        ///
+        /// Ranges from 3 (no reuse) down to about 0.5 for regular meshes.
+        [[nodiscard]] double acmr() const noexcept
+        {
+            return (triangles == 0) ? 0 : static_cast<double>(transformed) / static_cast<double>(triangles);
+        }
+
+        /// @brief Average transformed to vertex ratio, 1 being the optimum.
+        [[nodiscard]] double atvr() const noexcept
+        {
+            return (vertices == 0) ? 0 : static_cast<double>(transformed) / static_cast<double>(vertices);
+        }
+    };
+
+
+    /// @brief Simulate a FIFO vertex cache on the triangles of an index buffer.
+    ///
+    /// @param[in] indices      Zero-based vertex indices, three for each triangle.
+    /// @param[in] vertex_count Number of vertices, greater than all indices.
+    /// @param[in] cache_size   Number of vertices kept by the cache.
+    [[nodiscard]] VertexCacheStats analyze_vertex_cache(
+        std::span<const std::uint32_t> indices, std::size_t vertex_count, std::size_t cache_size = 16);
+
+    /// @brief Reorder the triangles of an index buffer to improve the hit rate of the vertex cache.
+    ///
+    /// Uses the linear time Tipsify algorithm, that fans triangles around vertices
+    /// while they are still expected to be in the cache.
+    ///
+    /// @param[in,out] indices      Zero-based vertex indices, three for each triangle.
+    /// @param[in]     vertex_count Number of vertices, greater than all indices.
+    /// @param[in]     cache_size   Number of vertices kept by the cache.
+    void optimize_vertex_cache(
+        std::span<std::uint32_t> indices, std::size_t vertex_count, std::size_t cache_size = 16);
+
+    /// @brief Reorder the vertices of a mesh by first use in the index buffer, so that they are fetched sequentially.
+    ///
+    /// Vertices not used by any triangle are moved at the end.
+    template <class Value>
+    void optimize_vertex_fetch(IndexedMesh<Value>& m);
+
+
+    /// @brief Simulate a FIFO vertex cache on the faces of a mesh.
+    ///
+    /// Face vertices are the same for the cache when they refer to the same v/vt/vn triplet,
+    /// as after weld_vertices().
+    ///
+    /// @throw std::out_of_range If an index doesn't refer to an existing element.
+    template <class Value, class Index>
+    [[nodiscard]] VertexCacheStats analyze_vertex_cache(const MeshData<Value, Index>& d, const VertexCacheConfig& c = {});
+
+    /// @brief Simulate a FIFO vertex cache on the faces of a mesh.
+    template <class Value, class Index>
+    [[nodiscard]] VertexCacheStats analyze_vertex_cache(const SoaMeshData<Value, Index>& d, const VertexCacheConfig& c = {});
+
+    /// @brief Reorder the faces of a mesh to improve the hit rate of the vertex cache.
+    ///
+    /// Face positions change, see the overload for parser results to update
+    /// the objects, smoothing groups and polygons that refer to them.
+    ///
+    /// @return Previous position of each face.
+    ///
+    /// @throw std::out_of_range If an index doesn't refer to an existing element.
+    template <class Value, class Index>
+    std::vector<std::size_t> optimize_vertex_cache(MeshData<Value, Index>& d, const VertexCacheConfig& c = {});
+
+    /// @brief Reorder the faces of a mesh to improve the hit rate of the vertex cache.
+    template <class Value, class Index>
+    std::vector<std::size_t> optimize_vertex_cache(SoaMeshData<Value, Index>& d, const VertexCacheConfig& c = {});
+
+    /// @brief Reorder the faces of a parsed file to improve the hit rate of the vertex cache.
+    ///
+    /// Objects and smoothing groups follow the faces to their new positions, while
+    /// polygons are cleared since the triangles of each one are no longer consecutive.
+    ///
+    /// @return Previous position of each face.
+    ///
+    /// @throw std::out_of_range If an index doesn't refer to an existing element.
+    template <class Value, class Index>
+    std::vector<std::size_t> optimize_vertex_cache(ObjParserResult<Value, Index>& r, const VertexCacheConfig& c = {});
+
+    /// @brief Reorder the faces of a parsed file to improve the hit rate of the vertex cache.
+    template <class Value, class Index>
+    std::vector<std::size_t> optimize_vertex_cache(ObjParserSoaResult<Value, Index>& r, const VertexCacheConfig& c = {});
+
+    /// @brief Reorder vertices, normals and texture vertices by first use in the faces.
+    ///
+    /// Each list is reordered on its own and face indices are updated to match,
+    /// elements not used by any face are moved at the end.
+    ///
+    /// @throw std::out_of_range If an index doesn't refer to an existing element, data is left unchanged.
+    template <class Value, class Index>
+    void optimize_vertex_fetch(MeshData<Value, Index>& d, const VertexCacheConfig& c = {});
+
+    /// @brief Reorder vertices, normals and texture vertices by first use in the faces.
+    template <class Value, class Index>
+    void optimize_vertex_fetch(SoaMeshData<Value, Index>& d, const VertexCacheConfig& c = {});
+
+    /// @brief Reorder vertices, normals and texture vertices of a parsed file by first use in the faces.
+    ///
+    /// The triplets of the polygons are updated along with the faces.
+    ///
+    /// @throw std::out_of_range If an index doesn't refer to an existing element, data is left unchanged.
+    template <class Value, class Index>
+    void optimize_vertex_fetch(ObjParserResult<Value, Index>& r, const VertexCacheConfig& c = {});
+
+    /// @brief Reorder vertices, normals and texture vertices of a parsed file by first use in the faces.
+    template <class Value, class Index>
+    void optimize_vertex_fetch(ObjParserSoaResult<Value, Index>& r, const VertexCacheConfig& c = {});
+
+    /// @brief Update the face lists of objects after the faces have been reordered.
+    ///
+    /// @param[in,out] objects Objects of a parser result.
+    /// @param[in]     order   Previous position of each face, as returned by optimize_vertex_cache().
+    template <class Index>
+    void reorder_object_faces(std::pmr::vector<Object<Index>>& objects, std::span<const std::size_t> order);
+
+    /// @brief Update the smoothing groups after the faces have been reordered.
+    ///
+    /// Runs are split and merged so that each face keeps its group.
+    ///
+    /// @param[in,out] groups Smoothing groups of a parser result.
+    /// @param[in]     order  Previous position of each face, as returned by optimize_vertex_cache().
+    template <class Index>
+    void reorder_smoothing_groups(std::pmr::vector<SmoothingGroup<Index>>& groups, std::span<const std::size_t> order);
+
+} // namespace obj
+
+#endif // !OBJCPP_VERTEX_CACHE_HPP
\ No newline at end of file
@@ -0,0 +1,109 @@
+#pragma once
+#ifndef OBJCPP_WELDING_HPP
+#define OBJCPP_WELDING_HPP
+
+#include "obj-cpp/core.hpp"
+#include "obj-cpp/obj_parser.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace obj
+{
+    /// @brief Configuration parameters for vertex welding.
+    using WeldConfig = MeshProcessingConfig;
+
+
+    /// @brief Vertex with all its attributes stored together, as expected by GPU vertex buffers.
+    template <class Value = DefaultValueType>
+    struct PackedVertex
+    {
+        /// @brief Geometric vertex.
+        std::array<Value, 3> position;
+
+        /// @brief Normal vector, zero if missing.
+        std::array<Value, 3> normal;
+
+        /// @brief Texture coordinates, zero if missing.
+        std::array<Value, 2> texcoord;
+
+        [[nodiscard]] constexpr bool operator==(const PackedVertex&) const noexcept = default;
+        [[nodiscard]] constexpr bool operator!=(const PackedVertex&) const noexcept = default;
+    };
+
+
+    /// @brief Mesh with a single index for each vertex of the faces.
+    template <class Value = DefaultValueType>
+    struct IndexedMesh
+    {
+        /// @brief Unique combinations of geometric vertex, normal and texture vertex.
+        std::vector<PackedVertex<Value>> vertices;
+
+        /// @brief Zero-based positions in the vertex list, three for each face.
+        std::vector<std::uint32_t> indices;
+    };
+
+
+    /// @brief Merge the face vertices that refer to the same v/vt/vn triplet.
+    ///
+    /// Vertices are stored in order of first use by the faces, so the output
+    /// doesn't depend on the number of threads.
+    ///
+    /// @param[in] d Mesh data, with valid indices.
+    /// @param[in] c Welding configuration.
+    ///
+    /// @return Unique vertices and an index buffer with the faces.
+    ///
+    /// @throw std::out_of_range If an index doesn't refer to an existing element.
+    /// @throw std::length_error If there are more unique vertices than 32-bit indices can address.
+    template <class Value, class Index>
+    [[nodiscard]] IndexedMesh<Value> weld_vertices(const MeshData<Value, Index>& d, const WeldConfig& c = {});
+
+    /// @brief Merge the face vertices that refer to the same v/vt/vn triplet.
+    template <class Value, class Index>
+    [[nodiscard]] IndexedMesh<Value> weld_vertices(const SoaMeshData<Value, Index>& d, const WeldConfig& c = {});
+
+
+    /// @brief Merge geometric vertices closer than a tolerance, and remap the faces to the kept ones.
+    ///
+    /// Only the faces are remapped, see the overload for parser results to update the polygons.
+    /// Vertices are merged transitively, so a chain of vertices each closer than epsilon
+    /// to the next one collapses in a single vertex. The first vertex of each group in list order
+    /// is kept with its position, while the order of the kept vertices doesn't change.
+    /// Nearby vertices are found through a hash grid with cells of the size of the tolerance,
+    /// so the running time is linear unless many vertices fall within the same cell.
+    /// The result doesn't depend on the number of threads.
+    ///
+    /// @param[in,out] d       Mesh data.
+    /// @param[in]     epsilon Maximum euclidean distance between merged vertices, 0 merges only equal ones.
+    /// @param[in]     c       Welding configuration.
+    ///
+    /// @return Number of removed vertices.
+    ///
+    /// @throw std::invalid_argument If epsilon is negative or NaN.
+    /// @throw std::out_of_range If a face index doesn't refer to an existing vertex, data is left unchanged.
+    template <class Value, class Index>
+    std::size_t weld_positions(MeshData<Value, Index>& d, Value epsilon, const WeldConfig& c = {});
+
+    /// @brief Merge geometric vertices closer than a tolerance, and remap the faces to the kept ones.
+    template <class Value, class Index>
+    std::size_t weld_positions(SoaMeshData<Value, Index>& d, Value epsilon, const WeldConfig& c = {});
+
+    /// @brief Merge geometric vertices of a parsed file closer than a tolerance.
+    ///
+    /// The triplets of the polygons are remapped along with the faces.
+    ///
+    /// @throw std::invalid_argument If epsilon is negative or NaN.
+    /// @throw std::out_of_range If an index doesn't refer to an existing vertex, data is left unchanged.
+    template <class Value, class Index>
+    std::size_t weld_positions(ObjParserResult<Value, Index>& r, Value epsilon, const WeldConfig& c = {});
+
+    /// @brief Merge geometric vertices of a parsed file closer than a tolerance.
+    template <class Value, class Index>
+    std::size_t weld_positions(ObjParserSoaResult<Value, Index>& r, Value epsilon, const WeldConfig& c = {});
+
+} // namespace obj
+
+#endif // !OBJCPP_WELDING_HPP
\ No newline at end of file
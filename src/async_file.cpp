@@ -0,0 +1,373 @@
+#include "obj-cpp/async_file.hpp"
+
+#include "obj-cpp/mapped_file.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define OBJCPP_IO_URING 1
+#include <cerrno>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+namespace obj
+{
+    // number of blocks of the given size that cover the content
+    [[nodiscard]] constexpr std::size_t _block_count(std::size_t size, std::size_t block) noexcept
+    {
+        return (size + block - 1) / block;
+    }
+
+    // blocks read in order by a background thread, portable fallback for io_uring
+    class _ThreadReader final : public _BlockReader
+    {
+    public:
+        _ThreadReader(const std::filesystem::path& p, char* buffer, std::size_t size, std::size_t block)
+            : _file{ p, std::ios::binary }
+        {
+            if (!_file)
+                throw std::system_error{ std::make_error_code(std::errc::io_error), "Cannot open file" };
+            _thread = std::thread{ [=, this] { _read(buffer, size, block); } };
+        }
+
+        ~_ThreadReader() noexcept override
+        {
+            _stop = true;
+            _thread.join();
+        }
+
+        std::size_t wait_for(std::size_t n) override
+        {
+            std::unique_lock lock{ _mutex };
+            _progress.wait(lock, [&] { return _available >= n || _error; });
+            if (_available < n)
+                throw std::system_error{ _error, "Cannot read file" };
+            return _available;
+        }
+
+        bool io_uring() const noexcept override { return false; }
+
+    private:
+        std::ifstream           _file;
+        std::mutex              _mutex;
+        std::condition_variable _progress;
+        std::size_t             _available = 0;
+        std::error_code         _error;
+        std::atomic<bool>       _stop{ false };
+        std::thread             _thread;
+
+        void _read(char* buffer, std::size_t size, std::size_t block)
+        {
+            for (std::size_t first = 0; first < size && !_stop;)
+            {
+                const auto length = std::min(block, size - first);
+                _file.read(buffer + first, static_cast<std::streamsize>(length));
+                const auto read = static_cast<std::size_t>(_file.gcount());
+                {
+                    const std::lock_guard lock{ _mutex };
+                    if (read != length) // also when the file has been truncated in the meantime
+                        _error = std::make_error_code(std::errc::io_error);
+                    else
+                        _available = first += length;
+                }
+                _progress.notify_all();
+                if (read != length)
+                    return;
+            }
+        }
+    };
+
+#if defined(OBJCPP_IO_URING)
+
+    // blocks read by an io_uring instance, with up to queue_depth requests in flight;
+    // the rings are driven through the raw system calls by the thread waiting for the content
+    class _UringReader final : public _BlockReader
+    {
+    public:
+        _UringReader(int file, std::unique_ptr<char[]>& buffer, std::size_t size, const AsyncFileConfig& c)
+            : _file{ file }
+            , _owner{ buffer }
+            , _buffer{ buffer.get() }
+            , _size{ size }
+            , _block{ std::max<std::size_t>(c.block_size, 1) }
+            , _depth{ std::clamp<std::size_t>(c.queue_depth, 1, 4096) }
+            , _read(_block_count(size, _block))
+            , _iovecs(_block_count(size, _block))
+        {
+            io_uring_params params{};
+            _ring = static_cast<int>(::syscall(__NR_io_uring_setup, static_cast<unsigned>(_depth), &params));
+            if (_ring < 0)
+                return;
+
+            _sq_length = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+            _cq_length = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            if (params.features & IORING_FEAT_SINGLE_MMAP)
+                _sq_length = _cq_length = std::max(_sq_length, _cq_length);
+
+            _sq = _map(_sq_length, IORING_OFF_SQ_RING);
+            _cq = (params.features & IORING_FEAT_SINGLE_MMAP) ? _sq : _map(_cq_length, IORING_OFF_CQ_RING);
+            _sqes_length = params.sq_entries * sizeof(io_uring_sqe);
+            _sqes        = static_cast<io_uring_sqe*>(_map(_sqes_length, IORING_OFF_SQES));
+            if (_sq == nullptr || _cq == nullptr || _sqes == nullptr)
+            {
+                _release();
+                return;
+            }
+
+            const auto sq = static_cast<char*>(_sq);
+            const auto cq = static_cast<char*>(_cq);
+            _sq_head      = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+            _sq_tail      = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+            _sq_mask      = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+            _sq_array     = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+            _cq_head      = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+            _cq_tail      = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+            _cq_mask      = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+            _cqes         = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+            // reading starts right away, before the content is first waited for
+            _top_up();
+            if (_enter(0) != 0) // nothing has been submitted
+            {
+                _in_flight = 0;
+                _release();
+            }
+        }
+
+        ~_UringReader() noexcept override
+        {
+            // the kernel may still write to the buffer until the requests in flight are completed
+            _stopping = true;
+            while (valid() && _in_flight > 0)
+            {
+                if (const auto e = _enter(1); e != 0 && e != EAGAIN && e != EBUSY)
+                { // the requests can't be waited for, so their destinations are leaked rather than freed
+                    static_cast<void>(_owner.release());
+                    static_cast<void>(new std::vector<iovec>(std::move(_iovecs)));
+                    break;
+                }
+                _reap();
+            }
+            _release();
+            ::close(_file);
+        }
+
+        // check whether the ring has been set up, otherwise the kernel doesn't support io_uring
+        [[nodiscard]] bool valid() const noexcept { return _ring >= 0; }
+
+        std::size_t wait_for(std::size_t n) override
+        {
+            for (;;)
+            {
+                _reap();
+                if (_error != 0)
+                    throw std::system_error{ _error, std::generic_category(), "Cannot read file" };
+                _top_up();
+
+                const auto available = std::min(_size, _complete * _block);
+                const auto wait      = (available < n);
+                if (const auto e = _enter(wait ? 1 : 0); e != 0)
+                    throw std::system_error{ e, std::generic_category(), "Cannot read file" };
+                if (!wait)
+                    return available;
+            }
+        }
+
+        bool io_uring() const noexcept override { return true; }
+
+    private:
+        int                      _file;
+        int                      _ring = -1;
+        std::unique_ptr<char[]>& _owner; // owner of the buffer, outlives the reader
+        char*                    _buffer;
+        std::size_t              _size;
+        std::size_t              _block;
+        std::size_t              _depth;
+        std::vector<std::size_t> _read;          // characters read of each block
+        std::vector<iovec>       _iovecs;        // destination of the last request of each block
+        std::size_t              _next      = 0; // first block not requested yet
+        std::size_t              _complete  = 0; // blocks read completely, in order from the first one
+        std::size_t              _in_flight = 0;
+        int                      _error     = 0;
+        bool                     _stopping  = false;
+
+        void*         _sq = nullptr;
+        void*         _cq = nullptr;
+        io_uring_sqe* _sqes = nullptr;
+        std::size_t   _sq_length = 0, _cq_length = 0, _sqes_length = 0;
+        unsigned *    _sq_head = nullptr, *_sq_tail = nullptr, *_sq_array = nullptr;
+        unsigned *    _cq_head = nullptr, *_cq_tail = nullptr;
+        unsigned      _sq_mask = 0, _cq_mask = 0;
+        io_uring_cqe* _cqes = nullptr;
+
+        [[nodiscard]] void* _map(std::size_t length, off_t offset) noexcept
+        {
+            const auto p = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ring, offset);
+            return (p != MAP_FAILED) ? p : nullptr;
+        }
+
+        void _release() noexcept
+        {
+            if (_sqes != nullptr)
+                ::munmap(_sqes, _sqes_length);
+            if (_cq != nullptr && _cq != _sq)
+                ::munmap(_cq, _cq_length);
+            if (_sq != nullptr)
+                ::munmap(_sq, _sq_length);
+            if (_ring >= 0)
+                ::close(_ring);
+            _sq = _cq = nullptr;
+            _sqes     = nullptr;
+            _ring     = -1;
+        }
+
+        [[nodiscard]] std::size_t _block_length(std::size_t b) const noexcept
+        {
+            return std::min(_block, _size - b * _block);
+        }
+
+        // queue a request for the characters of a block that haven't been read yet
+        void _queue_read(std::size_t b) noexcept
+        {
+            const auto first = b * _block + _read[b];
+            _iovecs[b]       = { _buffer + first, _block_length(b) - _read[b] };
+
+            const auto tail  = *_sq_tail; // only written by this thread
+            const auto index = tail & _sq_mask;
+            auto&      sqe   = _sqes[index];
+            std::memset(&sqe, 0, sizeof(sqe));
+            sqe.opcode    = IORING_OP_READV;
+            sqe.fd        = _file;
+            sqe.addr      = reinterpret_cast<std::uint64_t>(&_iovecs[b]);
+            sqe.len       = 1;
+            sqe.off       = first;
+            sqe.user_data = b;
+            _sq_array[index] = index;
+            std::atomic_ref{ *_sq_tail }.store(tail + 1, std::memory_order_release);
+            ++_in_flight;
+        }
+
+        // keep up to queue_depth requests in flight
+        void _top_up() noexcept
+        {
+            while (_in_flight < _depth && _next < std::size(_read) && _error == 0)
+                _queue_read(_next++);
+        }
+
+        // submit the queued requests and wait for at least min_complete completions,
+        // returns an error code or 0 on success
+        [[nodiscard]] int _enter(unsigned min_complete) noexcept
+        {
+            for (;;)
+            {
+                const auto queued = *_sq_tail - std::atomic_ref{ *_sq_head }.load(std::memory_order_acquire);
+                if (queued == 0 && min_complete == 0)
+                    return 0;
+                const auto flags = (min_complete > 0) ? IORING_ENTER_GETEVENTS : 0u;
+                if (::syscall(__NR_io_uring_enter, _ring, queued, min_complete, flags, nullptr, 0) >= 0)
+                    return 0;
+                if (errno != EINTR)
+                    return errno;
+            }
+        }
+
+        // process the completed requests, resubmitting the rest of short reads
+        void _reap() noexcept
+        {
+            auto       head = *_cq_head; // only written by this thread
+            const auto tail = std::atomic_ref{ *_cq_tail }.load(std::memory_order_acquire);
+            for (; head != tail; ++head)
+            {
+                const auto& cqe = _cqes[head & _cq_mask];
+                const auto  b   = static_cast<std::size_t>(cqe.user_data);
+                --_in_flight;
+
+                if (cqe.res > 0)
+                    _read[b] += static_cast<std::size_t>(cqe.res);
+                else if (cqe.res == 0) // the file has been truncated in the meantime
+                    _error = EIO;
+                else if (cqe.res != -EINTR && cqe.res != -EAGAIN)
+                    _error = -cqe.res;
+
+                if (_read[b] < _block_length(b) && _error == 0 && !_stopping)
+                    _queue_read(b);
+            }
+            std::atomic_ref{ *_cq_head }.store(head, std::memory_order_release);
+
+            while (_complete < std::size(_read) && _read[_complete] == _block_length(_complete))
+                ++_complete;
+        }
+    };
+
+    [[nodiscard]] std::unique_ptr<_BlockReader> _make_uring_reader(
+        const std::filesystem::path& p, std::unique_ptr<char[]>& buffer, std::size_t size, const AsyncFileConfig& c)
+    {
+        const auto file = ::open(p.c_str(), O_RDONLY | O_CLOEXEC);
+        if (file == -1)
+            throw std::system_error{ errno, std::generic_category(), "Cannot open file" };
+        ::posix_fadvise(file, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+        auto reader = std::make_unique<_UringReader>(file, buffer, size, c);
+        if (!reader->valid())
+            return nullptr;
+        return reader;
+    }
+
+#endif
+
+    AsyncFile::AsyncFile(const std::filesystem::path& p, const AsyncFileConfig& c)
+    {
+        std::error_code ec;
+        const auto      status = std::filesystem::status(p, ec);
+        if (ec)
+            throw std::system_error{ ec, "Cannot open file" };
+
+        if (!std::filesystem::is_regular_file(status))
+        { // pipes and character devices are read until their end
+            const MappedFile file{ p };
+            _size   = file.size();
+            _buffer = std::make_unique<char[]>(_size + 1);
+            std::copy_n(file.data(), _size + 1, _buffer.get());
+            _data = _buffer.get();
+            return;
+        }
+
+        _size = static_cast<std::size_t>(std::filesystem::file_size(p));
+        _buffer.reset(new char[_size + 1]); // left uninitialized, only the characters already read are used
+        _buffer[_size] = '\0';
+        _data          = _buffer.get();
+        if (_size == 0)
+            return;
+
+#if defined(OBJCPP_IO_URING)
+        if (c.io_uring)
+            _reader = _make_uring_reader(p, _buffer, _size, c);
+#endif
+        if (_reader == nullptr)
+            _reader = std::make_unique<_ThreadReader>(p, _buffer.get(), _size, std::max<std::size_t>(c.block_size, 1));
+    }
+
+    AsyncFile::~AsyncFile() noexcept = default;
+
+    std::size_t AsyncFile::wait_for(std::size_t n)
+    {
+        if (_reader == nullptr)
+            return _size;
+        return _reader->wait_for(std::min(n, _size));
+    }
+
+} // namespace obj
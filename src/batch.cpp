@@ -0,0 +1,80 @@
+#include "obj-cpp/batch.hpp"
+
+#include "obj-cpp/mapped_file.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace obj
+{
+    [[nodiscard]] bool _is_material_library(const std::filesystem::path& p)
+    {
+        auto extension = p.extension().string();
+        std::transform(std::cbegin(extension), std::cend(extension), std::begin(extension),
+            [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return extension == ".mtl";
+    }
+
+    template <class Value, class Index>
+    std::vector<BatchResult<Value, Index>> load_batch(
+        std::span<const std::filesystem::path> paths, WorkStealingPool& pool, const BatchConfig& c)
+    {
+        // large files are split in as many chunks as threads, whose tasks are run by the same pool
+        auto obj_config         = c.obj;
+        obj_config.thread_count = std::max<std::size_t>(pool.thread_count(), 1);
+        obj_config.executor     = &pool;
+
+        std::vector<BatchResult<Value, Index>> results(std::size(paths));
+        std::vector<std::function<void()>>     tasks;
+        tasks.reserve(std::size(paths));
+        for (std::size_t i = 0; i < std::size(paths); ++i)
+        {
+            tasks.push_back([&, i] {
+                try
+                {
+                    const MappedFile file{ paths[i] };
+                    if (_is_material_library(paths[i]))
+                        results[i].content = parse_as_mtl(file.view(), c.mtl);
+                    else
+                        results[i].content = parse_as_obj<Value, Index>(file.view(), obj_config);
+                }
+                catch (...)
+                {
+                    results[i].error = std::current_exception();
+                }
+            });
+        }
+        pool.run_all(tasks);
+        return results;
+    }
+
+    template <class Value, class Index>
+    std::vector<BatchResult<Value, Index>> load_batch(
+        std::span<const std::filesystem::path> paths, const BatchConfig& c)
+    {
+        WorkStealingPool pool{ c.thread_count };
+        return load_batch<Value, Index>(paths, pool, c);
+    }
+
+
+    // explicit instantiations for the supported value and index types
+
+#define OBJCPP_INSTANTIATE_BATCH(Value, Index)                                                      \
+    template std::vector<BatchResult<Value, Index>> load_batch(                                     \
+        std::span<const std::filesystem::path>, const BatchConfig&);                                \
+    template std::vector<BatchResult<Value, Index>> load_batch(                                     \
+        std::span<const std::filesystem::path>, WorkStealingPool&, const BatchConfig&);
+
+    OBJCPP_INSTANTIATE_BATCH(float, std::uint16_t)
+    OBJCPP_INSTANTIATE_BATCH(float, std::uint32_t)
+    OBJCPP_INSTANTIATE_BATCH(float, std::uint64_t)
+    OBJCPP_INSTANTIATE_BATCH(double, std::uint16_t)
+    OBJCPP_INSTANTIATE_BATCH(double, std::uint32_t)
+    OBJCPP_INSTANTIATE_BATCH(double, std::uint64_t)
+
+#undef OBJCPP_INSTANTIATE_BATCH
+
+} // namespace obj
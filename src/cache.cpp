@@ -0,0 +1,349 @@
+#include "obj-cpp/cache.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace obj
+{
+    constexpr std::array<char, 8> _cache_magic         = { 'O', 'B', 'J', 'C', 'P', 'P', 'M', 'C' };
+    constexpr std::uint32_t       _cache_version       = 3;
+    constexpr std::uint32_t       _cache_byte_order    = 0x01020304; // reads differently on other endianness
+    constexpr std::size_t         _cache_section_align = 64;
+
+    enum class _CacheSectionId
+    {
+        v,
+        vn,
+        vt,
+        faces,
+        objects,
+        object_faces,
+        names,
+        smoothing_groups,
+        polygon_offsets,
+        polygon_triplets,
+        polygon_faces,
+        count
+    };
+
+    struct _CacheSection
+    {
+        std::uint64_t offset; // from the start of the file, multiple of the section alignment
+        std::uint64_t count;  // number of elements
+    };
+
+    struct _CacheHeader
+    {
+        std::array<char, 8> magic;
+        std::uint32_t       version;
+        std::uint32_t       byte_order;
+        std::uint32_t       value_size;
+        std::uint32_t       index_size;
+        std::uint64_t       parser_options; // see _parser_options()
+        std::uint64_t       file_size;
+
+        std::array<_CacheSection, static_cast<std::size_t>(_CacheSectionId::count)> sections;
+    };
+
+    // parser options that change the result, so that a cache is only used with the ones it has been written with
+    [[nodiscard]] constexpr std::uint64_t _parser_options(const ObjParserConfig& c) noexcept
+    {
+        return static_cast<std::uint64_t>(c.zero_based_indices) | (static_cast<std::uint64_t>(c.keep_polygons) << 1) |
+               (static_cast<std::uint64_t>(c.triangulation) << 8) | (static_cast<std::uint64_t>(c.flags) << 16);
+    }
+
+    [[nodiscard]] constexpr std::size_t _align_up(std::size_t offset) noexcept
+    {
+        return (offset + _cache_section_align - 1) / _cache_section_align * _cache_section_align;
+    }
+
+    [[noreturn]] void _throw_invalid_cache(const char* what)
+    {
+        throw CacheError{ what };
+    }
+
+    // view of a section, checked against the bounds of the file
+    template <class T>
+    [[nodiscard]] std::span<const T> _section(const MappedFile& f, const _CacheHeader& h, _CacheSectionId id)
+    {
+        const auto& s = h.sections[static_cast<std::size_t>(id)];
+        if (s.offset % _cache_section_align != 0 || s.offset > std::size(f) ||
+            s.count > (std::size(f) - s.offset) / sizeof(T))
+            _throw_invalid_cache("Cache section out of bounds");
+
+        const auto first = std::data(f) + s.offset;
+        if (reinterpret_cast<std::uintptr_t>(first) % alignof(T) != 0)
+            _throw_invalid_cache("Cache section is misaligned in memory");
+
+        return { reinterpret_cast<const T*>(first), static_cast<std::size_t>(s.count) };
+    }
+
+    template <class Value, class Index>
+    MeshCache<Value, Index>::MeshCache(const std::filesystem::path& p, const ObjParserConfig& c)
+        : _file{ p }
+    {
+        _CacheHeader h;
+        if (std::size(_file) < sizeof(h))
+            _throw_invalid_cache("Cache file is too short");
+        std::memcpy(&h, std::data(_file), sizeof(h));
+
+        if (h.magic != _cache_magic)
+            _throw_invalid_cache("Not a cache file");
+        if (h.version != _cache_version || h.byte_order != _cache_byte_order ||
+            h.value_size != sizeof(Value) || h.index_size != sizeof(Index))
+            _throw_invalid_cache("Cache file written by an incompatible build");
+        if (h.parser_options != _parser_options(c))
+            _throw_invalid_cache("Cache file written with different parser options");
+        if (h.file_size != std::size(_file))
+            _throw_invalid_cache("Cache file is truncated");
+
+        using _id     = _CacheSectionId;
+        _v            = _section<Vertex<Value>>(_file, h, _id::v);
+        _vn           = _section<Normal<Value>>(_file, h, _id::vn);
+        _vt           = _section<Texcoord<Value>>(_file, h, _id::vt);
+        _faces        = _section<Face<Index>>(_file, h, _id::faces);
+        _objects      = _section<_CacheObject>(_file, h, _id::objects);
+        _object_faces = _section<Index>(_file, h, _id::object_faces);
+
+        const auto names = _section<char>(_file, h, _id::names);
+        _names           = { std::data(names), std::size(names) };
+
+        _smoothing_groups = _section<SmoothingGroup<Index>>(_file, h, _id::smoothing_groups);
+        _polygons         = {
+            _section<Index>(_file, h, _id::polygon_offsets),
+            _section<Triplet<Index>>(_file, h, _id::polygon_triplets),
+            _section<Index>(_file, h, _id::polygon_faces),
+        };
+
+        // checked once here, so that accessing objects is always safe
+        for (const auto& o : _objects)
+            if (o.name_offset > std::size(_names) || o.name_size > std::size(_names) - o.name_offset ||
+                o.faces_offset > std::size(_object_faces) || o.faces_count > std::size(_object_faces) - o.faces_offset)
+                _throw_invalid_cache("Cache object out of bounds");
+    }
+
+    template <class Value, class Index>
+    CachedObject<Index> MeshCache<Value, Index>::object(std::size_t i) const noexcept
+    {
+        const auto& o = _objects[i];
+        return {
+            _names.substr(static_cast<std::size_t>(o.name_offset), static_cast<std::size_t>(o.name_size)),
+            _object_faces.subspan(static_cast<std::size_t>(o.faces_offset), static_cast<std::size_t>(o.faces_count))
+        };
+    }
+
+    template <class Value, class Index>
+    ObjParserResult<Value, Index> MeshCache<Value, Index>::to_result() const
+    {
+        ObjParserResult<Value, Index> r;
+        r.data.v.assign(std::cbegin(_v), std::cend(_v));
+        r.data.vn.assign(std::cbegin(_vn), std::cend(_vn));
+        r.data.vt.assign(std::cbegin(_vt), std::cend(_vt));
+        r.data.faces.assign(std::cbegin(_faces), std::cend(_faces));
+
+        r.objects.reserve(object_count());
+        for (std::size_t i = 0; i < object_count(); ++i)
+        {
+            const auto o = object(i);
+            r.objects.push_back({ std::pmr::string{ o.name }, std::pmr::vector<Index>(std::cbegin(o.faces), std::cend(o.faces)) });
+        }
+
+        r.smoothing_groups.assign(std::cbegin(_smoothing_groups), std::cend(_smoothing_groups));
+        r.polygons.offsets.assign(std::cbegin(_polygons.offsets), std::cend(_polygons.offsets));
+        r.polygons.triplets.assign(std::cbegin(_polygons.triplets), std::cend(_polygons.triplets));
+        r.polygons.faces.assign(std::cbegin(_polygons.faces), std::cend(_polygons.faces));
+        return r;
+    }
+
+
+    // temporary file next to the destination, with a name that no other writer uses
+    [[nodiscard]] std::filesystem::path _temporary_path(const std::filesystem::path& p)
+    {
+        static thread_local std::mt19937_64 random{ std::random_device{}() };
+
+        constexpr char digits[] = "0123456789abcdef";
+        std::string    suffix   = ".tmp-";
+        for (auto r = random(); std::size(suffix) < 21; r >>= 4)
+            suffix += digits[r & 0xf];
+
+        auto temp = p;
+        temp += suffix;
+        return temp;
+    }
+
+    // copy elements into a zero-filled buffer one field at a time, so that the padding
+    // bytes between and after the fields, whose values are indeterminate, are written as zeros
+    template <class T, class... Fields>
+    void _copy_fields(std::span<const T> elements, char* out, Fields T::*... fields) noexcept
+    {
+        for (const auto& e : elements)
+        {
+            const auto base = reinterpret_cast<const char*>(&e);
+            ((std::memcpy(out + (reinterpret_cast<const char*>(&(e.*fields)) - base), &(e.*fields), sizeof(e.*fields))), ...);
+            out += sizeof(T);
+        }
+    }
+
+    template <class Value, class Index>
+    void write_cache(const ObjParserResult<Value, Index>& r, const std::filesystem::path& p, const ObjParserConfig& c)
+    {
+        std::vector<_CacheObject> objects;
+        objects.reserve(std::size(r.objects));
+
+        std::uint64_t names = 0, object_faces = 0;
+        for (const auto& o : r.objects)
+        {
+            objects.push_back({ names, std::size(o.name), object_faces, std::size(o.faces) });
+            names += std::size(o.name);
+            object_faces += std::size(o.faces);
+        }
+
+        // sections in file order, each starting at an aligned offset
+        struct
+        {
+            const void*   data;
+            std::size_t   element_size;
+            std::uint64_t count;
+        } const sections[] = {
+            { std::data(r.data.v), sizeof(Vertex<Value>), std::size(r.data.v) },
+            { nullptr, sizeof(Normal<Value>), std::size(r.data.vn) },     // copied without padding
+            { nullptr, sizeof(Texcoord<Value>), std::size(r.data.vt) }, // copied without padding
+            { std::data(r.data.faces), sizeof(Face<Index>), std::size(r.data.faces) },
+            { std::data(objects), sizeof(_CacheObject), std::size(objects) },
+            { nullptr, sizeof(Index), object_faces }, // gathered from the objects
+            { nullptr, sizeof(char), names },
+            { nullptr, sizeof(SmoothingGroup<Index>), std::size(r.smoothing_groups) }, // copied without padding
+            { std::data(r.polygons.offsets), sizeof(Index), std::size(r.polygons.offsets) },
+            { std::data(r.polygons.triplets), sizeof(Triplet<Index>), std::size(r.polygons.triplets) },
+            { std::data(r.polygons.faces), sizeof(Index), std::size(r.polygons.faces) },
+        };
+        static_assert(std::size(sections) == static_cast<std::size_t>(_CacheSectionId::count));
+        static_assert(sizeof(Vertex<Value>) == 4 * sizeof(Value), "vertices are written as they are, without padding");
+        static_assert(sizeof(Triplet<Index>) == 3 * sizeof(Index), "triplets are written as they are, without padding");
+
+        _CacheHeader h{};
+        h.magic      = _cache_magic;
+        h.version    = _cache_version;
+        h.byte_order = _cache_byte_order;
+        h.value_size = sizeof(Value);
+        h.index_size = sizeof(Index);
+
+        h.parser_options = _parser_options(c);
+
+        auto offset = _align_up(sizeof(h));
+        for (std::size_t i = 0; i < std::size(sections); ++i)
+        {
+            h.sections[i] = { offset, sections[i].count };
+            offset        = _align_up(offset + sections[i].element_size * sections[i].count);
+        }
+        h.file_size = offset;
+
+        const auto temp = _temporary_path(p);
+        try
+        {
+            std::ofstream f{ temp, std::ios::binary | std::ios::trunc };
+            if (!f)
+                throw std::system_error{ std::make_error_code(std::errc::io_error), "Cannot create cache file" };
+
+            std::uint64_t written = 0;
+
+            const auto write = [&](const void* data, std::size_t size) {
+                f.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+                written += size;
+            };
+            const auto pad = [&](std::uint64_t to) {
+                constexpr char zeros[_cache_section_align] = {};
+                write(zeros, static_cast<std::size_t>(to - written));
+            };
+
+            std::vector<char> buffer; // padded elements, copied in batches
+            const auto        write_fields = [&](const auto& elements, auto... fields) {
+                using T                = std::remove_cvref_t<decltype(elements[0])>;
+                constexpr auto batch   = std::size_t{ 4096 };
+                const auto     span    = std::span<const T>{ elements };
+                for (std::size_t first = 0; first < std::size(span); first += batch)
+                {
+                    const auto part = span.subspan(first, std::min(batch, std::size(span) - first));
+                    buffer.assign(std::size(part) * sizeof(T), '\0');
+                    _copy_fields(part, std::data(buffer), fields...);
+                    write(std::data(buffer), std::size(buffer));
+                }
+            };
+
+            write(&h, sizeof(h));
+            for (std::size_t i = 0; i < std::size(sections); ++i)
+            {
+                pad(h.sections[i].offset);
+                switch (static_cast<_CacheSectionId>(i))
+                {
+                    case _CacheSectionId::vn:
+                        write_fields(r.data.vn, &Normal<Value>::x, &Normal<Value>::y, &Normal<Value>::z);
+                        break;
+                    case _CacheSectionId::vt:
+                        write_fields(r.data.vt, &Texcoord<Value>::u, &Texcoord<Value>::v, &Texcoord<Value>::w);
+                        break;
+                    case _CacheSectionId::smoothing_groups:
+                        write_fields(r.smoothing_groups, &SmoothingGroup<Index>::first_face, &SmoothingGroup<Index>::id);
+                        break;
+                    case _CacheSectionId::object_faces:
+                        for (const auto& o : r.objects)
+                            write(std::data(o.faces), sizeof(Index) * std::size(o.faces));
+                        break;
+                    case _CacheSectionId::names:
+                        for (const auto& o : r.objects)
+                            write(std::data(o.name), std::size(o.name));
+                        break;
+                    default: write(sections[i].data, sections[i].element_size * sections[i].count); break;
+                }
+            }
+            pad(h.file_size);
+
+            f.close();
+            if (!f)
+                throw std::system_error{ std::make_error_code(std::errc::io_error), "Cannot write cache file" };
+            std::filesystem::rename(temp, p);
+        }
+        catch (...)
+        {
+            std::error_code ec; // the original error is more relevant than a failed removal
+            std::filesystem::remove(temp, ec);
+            throw;
+        }
+    }
+
+    bool is_cache_fresh(const std::filesystem::path& source, const std::filesystem::path& cache)
+    {
+        std::error_code ec;
+        const auto      cache_time = std::filesystem::last_write_time(cache, ec);
+        if (ec)
+            return false;
+
+        // a source that cannot be checked is assumed to be changed
+        const auto source_time = std::filesystem::last_write_time(source, ec);
+        return !ec && cache_time >= source_time;
+    }
+
+
+    // explicit instantiations for the supported value and index types
+
+#define OBJCPP_INSTANTIATE_CACHE(Value, Index) \
+    template class MeshCache<Value, Index>;    \
+    template void write_cache<Value, Index>(                                                \
+        const ObjParserResult<Value, Index>&, const std::filesystem::path&, const ObjParserConfig&);
+
+    OBJCPP_INSTANTIATE_CACHE(float, std::uint16_t)
+    OBJCPP_INSTANTIATE_CACHE(float, std::uint32_t)
+    OBJCPP_INSTANTIATE_CACHE(float, std::uint64_t)
+    OBJCPP_INSTANTIATE_CACHE(double, std::uint16_t)
+    OBJCPP_INSTANTIATE_CACHE(double, std::uint32_t)
+    OBJCPP_INSTANTIATE_CACHE(double, std::uint64_t)
+
+#undef OBJCPP_INSTANTIATE_CACHE
+
+} // namespace obj
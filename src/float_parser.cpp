@@ -0,0 +1,295 @@
+#include "obj-cpp/float_parser.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace obj
+{
+    /// @brief Parameters of IEEE 754 binary formats.
+    template <class Value>
+    struct _BinaryFormat;
+
+    template <>
+    struct _BinaryFormat<float>
+    {
+        using Bits = std::uint32_t;
+
+        static constexpr int mantissa_explicit_bits = 23;
+        static constexpr int minimum_exponent       = -127;
+        static constexpr int infinite_power         = 0xFF;
+        static constexpr int sign_index             = 31;
+
+        // range of q where w * 10^q can be exactly halfway between two floats
+        static constexpr int min_exponent_round_to_even = -17;
+        static constexpr int max_exponent_round_to_even = 10;
+
+        // outside this range the value is either zero or infinite
+        static constexpr int smallest_power_of_ten = -65;
+        static constexpr int largest_power_of_ten  = 38;
+    };
+
+    template <>
+    struct _BinaryFormat<double>
+    {
+        using Bits = std::uint64_t;
+
+        static constexpr int mantissa_explicit_bits = 52;
+        static constexpr int minimum_exponent       = -1023;
+        static constexpr int infinite_power         = 0x7FF;
+        static constexpr int sign_index             = 63;
+
+        static constexpr int min_exponent_round_to_even = -4;
+        static constexpr int max_exponent_round_to_even = 23;
+
+        static constexpr int smallest_power_of_ten = -342;
+        static constexpr int largest_power_of_ten  = 308;
+    };
+
+
+    constexpr int _smallest_power_of_five = -342;
+    constexpr int _largest_power_of_five  = 308;
+
+    struct _Uint128
+    {
+        std::uint64_t high;
+        std::uint64_t low;
+    };
+
+    // minimal arbitrary precision unsigned integer, only used to build the tables
+    class _BigUint
+    {
+    public:
+        explicit _BigUint(std::uint32_t v)
+            : _limbs{ v } {}
+
+        [[nodiscard]] static _BigUint power_of_two(std::size_t exponent)
+        {
+            _BigUint r{ 0 };
+            r._limbs.assign(exponent / 32 + 1, 0);
+            r._limbs.back() = std::uint32_t{ 1 } << (exponent % 32);
+            return r;
+        }
+
+        void multiply(std::uint32_t m)
+        {
+            std::uint64_t carry = 0;
+            for (auto& l : _limbs)
+            {
+                const auto x = std::uint64_t{ l } * m + carry;
+                l            = static_cast<std::uint32_t>(x);
+                carry        = x >> 32;
+            }
+            if (carry != 0)
+                _limbs.push_back(static_cast<std::uint32_t>(carry));
+        }
+
+        void divide(std::uint32_t d)
+        {
+            std::uint64_t remainder = 0;
+            for (auto l = std::rbegin(_limbs); l != std::rend(_limbs); ++l)
+            {
+                const auto x = (remainder << 32) | *l;
+                *l           = static_cast<std::uint32_t>(x / d);
+                remainder    = x % d;
+            }
+            _trim();
+        }
+
+        void shift_right(std::size_t n)
+        {
+            _BigUint r{ 0 };
+            r._limbs.assign(std::size(_limbs), 0);
+            for (std::size_t i = n; i < bit_length(); ++i)
+                if (bit(i))
+                    r._limbs[(i - n) / 32] |= std::uint32_t{ 1 } << ((i - n) % 32);
+            r._trim();
+            *this = std::move(r);
+        }
+
+        void increment()
+        {
+            for (auto& l : _limbs)
+                if (++l != 0)
+                    return;
+            _limbs.push_back(1);
+        }
+
+        [[nodiscard]] bool bit(std::size_t i) const noexcept
+        {
+            return (i / 32 < std::size(_limbs)) && ((_limbs[i / 32] >> (i % 32)) & 1) != 0;
+        }
+
+        [[nodiscard]] std::size_t bit_length() const noexcept
+        {
+            return 32 * (std::size(_limbs) - 1) + std::bit_width(_limbs.back());
+        }
+
+        // the 128 most significant bits, moved to the top if the value is shorter
+        [[nodiscard]] _Uint128 top_128() const noexcept
+        {
+            const auto first = static_cast<std::ptrdiff_t>(bit_length()) - 128;
+
+            _Uint128 r{ 0, 0 };
+            for (auto i = 0; i < 128; ++i)
+                if (first + i >= 0 && bit(static_cast<std::size_t>(first + i)))
+                    (i < 64 ? r.low : r.high) |= std::uint64_t{ 1 } << (i % 64);
+            return r;
+        }
+
+    private:
+        std::vector<std::uint32_t> _limbs; // little endian
+
+        void _trim()
+        {
+            while (std::size(_limbs) > 1 && _limbs.back() == 0)
+                _limbs.pop_back();
+        }
+    };
+
+    using _PowersOfFive = std::array<_Uint128, _largest_power_of_five - _smallest_power_of_five + 1>;
+
+    // 128 bits approximations of 5^q, normalized so that the most significant bit is set;
+    // truncated for q >= 0, rounded up reciprocals for q < 0
+    [[nodiscard]] _PowersOfFive _make_powers_of_five()
+    {
+        _PowersOfFive table{};
+
+        _BigUint power{ 1 }; // 5^q
+        for (auto q = 0; q <= _largest_power_of_five; ++q, power.multiply(5))
+            table[q - _smallest_power_of_five] = power.top_128();
+
+        // floor(2^b / 5^n) is obtained by dividing 2^scale by 5 n times and dropping (scale - b) bits
+        constexpr std::size_t scale = 1792;
+
+        _BigUint power_of_five{ 1 };             // 5^n
+        auto     reciprocal = _BigUint::power_of_two(scale); // floor(2^scale / 5^n)
+        for (auto n = 1; n <= -_smallest_power_of_five; ++n)
+        {
+            power_of_five.multiply(5);
+            reciprocal.divide(5);
+
+            const auto z = power_of_five.bit_length(); // smallest z such that 2^z > 5^n
+            const auto b = (n <= 27) ? z + 127 : 2 * z + 128;
+            assert(b <= scale);
+
+            auto c = reciprocal;
+            c.shift_right(scale - b);
+            c.increment();
+            table[-n - _smallest_power_of_five] = c.top_128();
+        }
+        return table;
+    }
+
+    [[nodiscard]] const _PowersOfFive& _powers_of_five() noexcept
+    {
+        static const auto table = _make_powers_of_five();
+        return table;
+    }
+
+    [[nodiscard]] inline _Uint128 _full_multiplication(std::uint64_t a, std::uint64_t b) noexcept
+    {
+#if defined(__SIZEOF_INT128__)
+        __extension__ typedef unsigned __int128 _Native; // a compiler extension, silent under -Wpedantic
+        const auto r = static_cast<_Native>(a) * b;
+        return { static_cast<std::uint64_t>(r >> 64), static_cast<std::uint64_t>(r) };
+#elif defined(_MSC_VER) && defined(_M_X64)
+        _Uint128 r;
+        r.low = _umul128(a, b, &r.high);
+        return r;
+#else
+        const auto a_lo = a & 0xFFFFFFFF, a_hi = a >> 32;
+        const auto b_lo = b & 0xFFFFFFFF, b_hi = b >> 32;
+
+        const auto lo_lo = a_lo * b_lo, hi_lo = a_hi * b_lo;
+        const auto lo_hi = a_lo * b_hi, hi_hi = a_hi * b_hi;
+
+        const auto cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + lo_hi;
+        return { (hi_lo >> 32) + (cross >> 32) + hi_hi, (cross << 32) | (lo_lo & 0xFFFFFFFF) };
+#endif
+    }
+
+    // floor(log2(10^q)) + 63, valid for q in [-1500, 1500]
+    [[nodiscard]] constexpr int _binary_power(int q) noexcept
+    {
+        return (((152170 + 65536) * q) >> 16) + 63;
+    }
+
+    template <class Value>
+    [[nodiscard]] bool _eisel_lemire(std::uint64_t w, std::int64_t q, bool negative, Value& value) noexcept
+    {
+        using _bf = _BinaryFormat<Value>;
+
+        if (w == 0 || q < _bf::smallest_power_of_ten || q > _bf::largest_power_of_ten)
+            return false;
+
+        const auto lz = std::countl_zero(w);
+        w <<= lz;
+
+        // approximate w * 5^q with enough precision to decide the rounding,
+        // the second product is needed only when the truncated bits may carry
+        const auto& power = _powers_of_five()[static_cast<std::size_t>(q - _smallest_power_of_five)];
+
+        auto product = _full_multiplication(w, power.high);
+
+        constexpr auto precision_mask = ~std::uint64_t{ 0 } >> (_bf::mantissa_explicit_bits + 3);
+        if ((product.high & precision_mask) == precision_mask)
+        {
+            const auto second = _full_multiplication(w, power.low);
+            product.low += second.high;
+            if (second.high > product.low)
+                ++product.high;
+        }
+
+        // the approximation may be off by one unit in rare cases,
+        // exact only when 5^q fits in 128 bits or its reciprocal is exact enough
+        if (product.low == ~std::uint64_t{ 0 } && (q < -27 || q > 55))
+            return false;
+
+        const auto upper_bit = static_cast<int>(product.high >> 63);
+        const auto shift     = upper_bit + 64 - _bf::mantissa_explicit_bits - 3;
+
+        auto mantissa = product.high >> shift;
+        auto power2   = _binary_power(static_cast<int>(q)) + upper_bit - lz - _bf::minimum_exponent;
+        if (power2 <= 0) // subnormal values
+            return false;
+
+        // round half to even when the value falls exactly in between
+        if (product.low <= 1 && q >= _bf::min_exponent_round_to_even && q <= _bf::max_exponent_round_to_even &&
+            (mantissa & 3) == 1 && (mantissa << shift) == product.high)
+            mantissa &= ~std::uint64_t{ 1 };
+
+        mantissa += (mantissa & 1);
+        mantissa >>= 1;
+        if (mantissa >= (std::uint64_t{ 2 } << _bf::mantissa_explicit_bits))
+        {
+            mantissa = std::uint64_t{ 1 } << _bf::mantissa_explicit_bits;
+            ++power2;
+        }
+        mantissa &= ~(std::uint64_t{ 1 } << _bf::mantissa_explicit_bits);
+
+        if (power2 >= _bf::infinite_power) // overflow
+            return false;
+
+        using _bits = typename _bf::Bits;
+
+        auto bits = static_cast<_bits>(mantissa) |
+                    (static_cast<_bits>(power2) << _bf::mantissa_explicit_bits);
+        if (negative)
+            bits |= _bits{ 1 } << _bf::sign_index;
+
+        value = std::bit_cast<Value>(bits);
+        return true;
+    }
+
+    template bool _eisel_lemire<float>(std::uint64_t, std::int64_t, bool, float&) noexcept;
+    template bool _eisel_lemire<double>(std::uint64_t, std::int64_t, bool, double&) noexcept;
+
+} // namespace obj
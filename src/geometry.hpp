@@ -0,0 +1,40 @@
+#pragma once
+#ifndef OBJCPP_GEOMETRY_HPP
+#define OBJCPP_GEOMETRY_HPP
+
+#include "obj-cpp/core.hpp"
+
+#include <array>
+#include <cstddef>
+
+// helpers shared by the mesh processing translation units, not part of the public interface
+namespace obj
+{
+    // number of face corners, three for each triangle
+    template <class Value, class Index>
+    [[nodiscard]] inline std::size_t _corner_count(const MeshData<Value, Index>& d) noexcept
+    {
+        return 3 * std::size(d.faces);
+    }
+
+    template <class Value, class Index>
+    [[nodiscard]] inline std::size_t _corner_count(const SoaMeshData<Value, Index>& d) noexcept
+    {
+        return std::size(d.v_indices);
+    }
+
+    template <class Value>
+    [[nodiscard]] inline std::array<Value, 3> _sub(const std::array<Value, 3>& a, const std::array<Value, 3>& b) noexcept
+    {
+        return { a[0] - b[0], a[1] - b[1], a[2] - b[2] };
+    }
+
+    template <class Value>
+    [[nodiscard]] inline Value _dot(const std::array<Value, 3>& a, const std::array<Value, 3>& b) noexcept
+    {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    }
+
+} // namespace obj
+
+#endif // !OBJCPP_GEOMETRY_HPP
\ No newline at end of file
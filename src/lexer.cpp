@@ -1,13 +1,33 @@
 #include "obj-cpp/lexer.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
 #include <span>
 #include <stdexcept>
 #include <vector>
 
+#if defined(__x86_64__) || defined(_M_X64)
+#define OBJCPP_LEXER_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(OBJCPP_LEXER_X86) && (defined(__GNUC__) || defined(__clang__))
+#define OBJCPP_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define OBJCPP_TARGET_AVX2
+#endif
+
 namespace obj
 {
+#if !defined(_drako_disable_exceptions)
     [[nodiscard]] std::vector<Token> lex(std::span<const char> s)
     {
         using _fsa   = FiniteStateAutomata;
@@ -113,26 +133,29 @@ namespace obj
 
         return tokens;
     }
+#endif
 
-    [[nodiscard]] const char* lex_until_linefeed(const char* pos, std::vector<Token>& tokens)
+    template <class Tokens>
+    [[nodiscard]] const char* _lex_until_linefeed_scalar(
+        const char* pos, const char* end, Tokens& tokens, const char*& invalid)
     {
         using _state = FiniteStateAutomata::State;
 
-        assert(nullptr != pos);
-        assert('\0' != *pos);
-
         static const FiniteStateAutomata fsa{};
+
+        // characters at or past the end of the source read as the string terminator
+        const auto at = [end](const char* p) noexcept { return static_cast<unsigned char>((p < end) ? *p : '\0'); };
         for (;;)
         {
             auto state = fsa.start_state();
             // skip whitespace and comments
             for (; fsa.skip_state(state); ++pos)
-                state = fsa.advance(state, static_cast<unsigned char>(*pos));
+                state = fsa.advance(state, at(pos));
 
             // save the starting position of the token
             auto begin = pos - 1;
             for (; !fsa.final_state(state); ++pos)
-                state = fsa.advance(state, static_cast<unsigned char>(*pos));
+                state = fsa.advance(state, at(pos));
 
             if (_state::final_alphanum == state)
             {
@@ -151,14 +174,344 @@ namespace obj
                 break;
             }
 
-            if (_state::final_error == state)
-                throw std::runtime_error{ "Unexpected character while in state " + to_string(state) };
-
-            throw std::logic_error{ "Unexpected lexer state " + to_string(state) };
+            assert(_state::final_error == state);
+            invalid = pos - 1; // the rest of the line is skipped
+            for (--pos; '\n' != at(pos) && '\0' != at(pos); ++pos)
+                ;
+            return ('\n' == at(pos)) ? pos + 1 : pos;
         }
 
-        assert('\0' == pos[0] || '\n' == pos[-1]);
+        assert('\0' == at(pos) || '\n' == pos[-1]);
         return pos;
     }
 
+
+    constexpr std::size_t _window_size = 64;
+
+#if defined(OBJCPP_LEXER_X86)
+
+    // classify 16 characters as a group of 16 bits masks
+    [[nodiscard]] inline _LexerWindow _classify_16(const __m128i c) noexcept
+    {
+        // identifiers are in the range ['!', '}'], checked as unsigned (c - '!') <= ('}' - '!')
+        const auto offset = _mm_sub_epi8(c, _mm_set1_epi8('!'));
+        const auto range  = _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8('}' - '!')), offset);
+
+        const auto space = _mm_cmpeq_epi8(c, _mm_set1_epi8(' '));
+        const auto hash  = _mm_cmpeq_epi8(c, _mm_set1_epi8('#'));
+        const auto eol   = _mm_or_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(c, _mm_setzero_si128()));
+
+        const auto token = _mm_andnot_si128(hash, range);
+        const auto valid = _mm_or_si128(_mm_or_si128(range, space), eol);
+        return {
+            .token   = static_cast<std::uint16_t>(_mm_movemask_epi8(token)),
+            .hash    = static_cast<std::uint16_t>(_mm_movemask_epi8(hash)),
+            .eol     = static_cast<std::uint16_t>(_mm_movemask_epi8(eol)),
+            .invalid = static_cast<std::uint16_t>(~_mm_movemask_epi8(valid)),
+        };
+    }
+
+    [[nodiscard]] inline _LexerWindow _classify_window_sse2(const char* window) noexcept
+    {
+        _LexerWindow r{};
+        for (auto i = 0; i < 4; ++i)
+        {
+            const auto m = _classify_16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(window) + i));
+            r.token |= m.token << (16 * i);
+            r.hash |= m.hash << (16 * i);
+            r.eol |= m.eol << (16 * i);
+            r.invalid |= m.invalid << (16 * i);
+        }
+        return r;
+    }
+
+    // classify 32 characters as a group of 32 bits masks
+    [[nodiscard]] OBJCPP_TARGET_AVX2 inline _LexerWindow _classify_32(const __m256i c) noexcept
+    {
+        const auto offset = _mm256_sub_epi8(c, _mm256_set1_epi8('!'));
+        const auto range  = _mm256_cmpeq_epi8(_mm256_min_epu8(offset, _mm256_set1_epi8('}' - '!')), offset);
+
+        const auto space = _mm256_cmpeq_epi8(c, _mm256_set1_epi8(' '));
+        const auto hash  = _mm256_cmpeq_epi8(c, _mm256_set1_epi8('#'));
+        const auto eol   = _mm256_or_si256(_mm256_cmpeq_epi8(c, _mm256_set1_epi8('\n')), _mm256_cmpeq_epi8(c, _mm256_setzero_si256()));
+
+        const auto token = _mm256_andnot_si256(hash, range);
+        const auto valid = _mm256_or_si256(_mm256_or_si256(range, space), eol);
+        return {
+            .token   = static_cast<std::uint32_t>(_mm256_movemask_epi8(token)),
+            .hash    = static_cast<std::uint32_t>(_mm256_movemask_epi8(hash)),
+            .eol     = static_cast<std::uint32_t>(_mm256_movemask_epi8(eol)),
+            .invalid = static_cast<std::uint32_t>(~_mm256_movemask_epi8(valid)),
+        };
+    }
+
+    [[nodiscard]] OBJCPP_TARGET_AVX2 _LexerWindow _classify_window_avx2(const char* window) noexcept
+    {
+        const auto lo = _classify_32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(window)));
+        const auto hi = _classify_32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(window) + 1));
+        return {
+            .token   = lo.token | (hi.token << 32),
+            .hash    = lo.hash | (hi.hash << 32),
+            .eol     = lo.eol | (hi.eol << 32),
+            .invalid = lo.invalid | (hi.invalid << 32),
+        };
+    }
+
+#endif
+
+    // Walks a line one window at a time, producing the same tokens as the FSA.
+    //
+    // Since the first '#' of a line always starts a comment, the line content ends at the
+    // first '#' or at the end of line, whichever comes first, and the tokens are the
+    // runs of identifier characters inside the content. Only the characters before end
+    // are loaded: a window that would cross it is copied to a buffer padded with string
+    // terminators, and isn't kept for the next line.
+    template <_LexerWindow (*Classify)(const char*) noexcept, class Tokens>
+    [[nodiscard]] const char* _lex_until_linefeed_windows(
+        const char* pos, const char* end, Tokens& tokens, _LexerWindow& m, const char*& invalid)
+    {
+        constexpr auto all = ~std::uint64_t{ 0 };
+
+        // the window of the previous line is reused if it covers the start of this one
+        auto window = (nullptr != m.position && m.position <= pos && pos < m.position + _window_size) ? m.position : pos;
+        auto lanes  = all << (pos - window);
+
+        const char* token_begin = nullptr;
+        bool        in_comment  = false;
+        for (;; window += _window_size, lanes = all)
+        {
+            if (m.position != window)
+            {
+                if (end - window >= static_cast<std::ptrdiff_t>(_window_size))
+                {
+                    m          = Classify(window);
+                    m.position = window;
+                }
+                else
+                {
+                    alignas(_window_size) char tail[_window_size] = {};
+                    std::copy(window, end, tail);
+                    m = Classify(tail);
+                }
+            }
+
+            const auto eol  = m.eol & lanes;
+            const auto line = (eol != 0) ? lanes & ((eol & (~eol + 1)) - 1) : lanes;
+            if (const auto bad = m.invalid & line; bad != 0 && nullptr == invalid)
+                invalid = window + std::countr_zero(bad);
+
+            if (!in_comment)
+            {
+                const auto hash    = m.hash & line;
+                const auto content = (hash != 0) ? line & ((hash & (~hash + 1)) - 1) : line;
+                const auto token   = m.token & content;
+
+                // a token starts where the previous character isn't part of a token,
+                // and ends on the first character that isn't part of it
+                const auto previous = (token << 1) | (nullptr != token_begin ? 1 : 0);
+                auto       starts   = token & ~previous;
+                auto       ends     = ~token & previous;
+
+                if (nullptr != token_begin && ends != 0) // close the token from the previous window
+                {
+                    const auto end = window + std::countr_zero(ends);
+                    tokens.emplace_back(token_begin, static_cast<std::size_t>(end - token_begin));
+                    token_begin = nullptr;
+                    ends &= ends - 1;
+                }
+                for (; starts != 0; starts &= starts - 1)
+                {
+                    const auto begin = window + std::countr_zero(starts);
+                    if (ends == 0) // the token continues in the next window
+                    {
+                        token_begin = begin;
+                        break;
+                    }
+                    const auto end = window + std::countr_zero(ends);
+                    assert(end > begin); // at least one char in the token
+                    tokens.emplace_back(begin, static_cast<std::size_t>(end - begin));
+                    ends &= ends - 1;
+                }
+                in_comment = (hash != 0);
+            }
+
+            if (eol != 0)
+            {
+                const auto last = window + std::countr_zero(eol);
+                return (last < end && '\n' == *last) ? last + 1 : last;
+            }
+        }
+    }
+
+    // count the statement starting at the first character of a line
+    inline void _count_statement(const char* line, StatementCounts& counts) noexcept
+    {
+        if (line[0] == 'v')
+        {
+            counts.v += (line[1] == ' ');
+            counts.vn += (line[1] == 'n');
+            counts.vt += (line[1] == 't');
+        }
+        else if (line[1] == ' ')
+        {
+            counts.f += (line[0] == 'f');
+            counts.o += (line[0] == 'o');
+        }
+    }
+
+    [[nodiscard]] StatementCounts count_statements(const char* data, std::size_t size) noexcept
+    {
+        StatementCounts counts;
+        if (size < 2) // too short for any statement
+            return counts;
+
+        _count_statement(data, counts);
+
+        std::size_t i = 1; // lines are recognized by the line feed at position i - 1
+#if defined(OBJCPP_LEXER_X86)
+        // each block compares the previous, the current and the next character of 16 positions at once
+        for (; i + 17 <= size; i += 16)
+        {
+            const auto prev = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i - 1));
+            const auto curr = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            const auto next = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 1));
+
+            const auto start = _mm_cmpeq_epi8(prev, _mm_set1_epi8('\n'));
+            if (_mm_movemask_epi8(start) == 0)
+                continue;
+
+            const auto is_v     = _mm_and_si128(start, _mm_cmpeq_epi8(curr, _mm_set1_epi8('v')));
+            const auto is_f     = _mm_and_si128(start, _mm_cmpeq_epi8(curr, _mm_set1_epi8('f')));
+            const auto is_o     = _mm_and_si128(start, _mm_cmpeq_epi8(curr, _mm_set1_epi8('o')));
+            const auto space    = _mm_cmpeq_epi8(next, _mm_set1_epi8(' '));
+            const auto normal   = _mm_cmpeq_epi8(next, _mm_set1_epi8('n'));
+            const auto texcoord = _mm_cmpeq_epi8(next, _mm_set1_epi8('t'));
+
+            const auto count = [](const __m128i m) {
+                return static_cast<std::size_t>(std::popcount(static_cast<unsigned>(_mm_movemask_epi8(m))));
+            };
+            counts.v += count(_mm_and_si128(is_v, space));
+            counts.vn += count(_mm_and_si128(is_v, normal));
+            counts.vt += count(_mm_and_si128(is_v, texcoord));
+            counts.f += count(_mm_and_si128(is_f, space));
+            counts.o += count(_mm_and_si128(is_o, space));
+        }
+#endif
+        for (; i + 1 < size; ++i)
+            if (data[i - 1] == '\n')
+                _count_statement(data + i, counts);
+
+        return counts;
+    }
+
+    [[nodiscard]] bool _cpu_supports_avx2() noexcept
+    {
+#if defined(OBJCPP_LEXER_X86) && (defined(__GNUC__) || defined(__clang__))
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+#elif defined(OBJCPP_LEXER_X86) && defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7)
+            return false;
+
+        __cpuid(info, 1);
+        const auto osxsave = (info[2] & (1 << 27)) != 0;
+        const auto avx     = (info[2] & (1 << 28)) != 0;
+        if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) // OS must save ymm registers
+            return false;
+
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#else
+        return false;
+#endif
+    }
+
+    [[nodiscard]] LexerIsa detect_lexer_isa() noexcept
+    {
+#if defined(OBJCPP_LEXER_X86)
+        return _cpu_supports_avx2() ? LexerIsa::avx2 : LexerIsa::sse2;
+#else
+        return LexerIsa::scalar;
+#endif
+    }
+
+    // end of the line starting at pos, past its line feed, for a source text of unknown size
+    [[nodiscard]] inline const char* _line_end(const char* pos) noexcept
+    {
+        const auto lf = pos + std::strcspn(pos, "\n");
+        return ('\n' == *lf) ? lf + 1 : lf;
+    }
+
+    template <class Tokens>
+    [[nodiscard]] const char* LineLexer::_try_lex_until_linefeed(const char* pos, Tokens& tokens, const char*& invalid)
+    {
+        assert(nullptr != pos);
+        assert((nullptr != _end) ? pos < _end : '\0' != *pos);
+
+        const auto end = (nullptr != _end) ? _end : _line_end(pos);
+        invalid        = nullptr;
+        switch (_isa)
+        {
+#if defined(OBJCPP_LEXER_X86)
+            case LexerIsa::sse2:
+                return _lex_until_linefeed_windows<_classify_window_sse2>(pos, end, tokens, _window, invalid);
+            case LexerIsa::avx2:
+                return _lex_until_linefeed_windows<_classify_window_avx2>(pos, end, tokens, _window, invalid);
+#endif
+            default: return _lex_until_linefeed_scalar(pos, end, tokens, invalid);
+        }
+    }
+
+    [[nodiscard]] const char* LineLexer::try_lex_until_linefeed(
+        const char* pos, std::vector<Token>& tokens, const char*& invalid)
+    {
+        return _try_lex_until_linefeed(pos, tokens, invalid);
+    }
+
+    [[nodiscard]] const char* LineLexer::try_lex_until_linefeed(
+        const char* pos, std::pmr::vector<Token>& tokens, const char*& invalid)
+    {
+        return _try_lex_until_linefeed(pos, tokens, invalid);
+    }
+
+#if !defined(_drako_disable_exceptions)
+    template <class Tokens>
+    [[nodiscard]] const char* LineLexer::_lex_until_linefeed(const char* pos, Tokens& tokens)
+    {
+        const char* invalid = nullptr;
+        const auto  next    = _try_lex_until_linefeed(pos, tokens, invalid);
+        if (nullptr != invalid)
+            throw std::runtime_error{ "Unexpected character while in state " +
+                                      to_string(FiniteStateAutomata::State::final_error) };
+        return next;
+    }
+
+    [[nodiscard]] const char* LineLexer::lex_until_linefeed(const char* pos, std::vector<Token>& tokens)
+    {
+        return _lex_until_linefeed(pos, tokens);
+    }
+
+    [[nodiscard]] const char* LineLexer::lex_until_linefeed(const char* pos, std::pmr::vector<Token>& tokens)
+    {
+        return _lex_until_linefeed(pos, tokens);
+    }
+
+    [[nodiscard]] const char* lex_until_linefeed(const char* pos, std::vector<Token>& tokens, LexerIsa isa)
+    {
+        assert(nullptr != pos);
+        assert('\0' != *pos);
+
+        LineLexer lexer{ isa };
+        return lexer.lex_until_linefeed(pos, tokens);
+    }
+
+    [[nodiscard]] const char* lex_until_linefeed(const char* pos, std::vector<Token>& tokens)
+    {
+        static const auto isa = detect_lexer_isa(); // resolved once on first use
+        return lex_until_linefeed(pos, tokens, isa);
+    }
+#endif
+
 } // namespace obj
\ No newline at end of file
@@ -0,0 +1,223 @@
+#include "obj-cpp/mapped_file.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace obj
+{
+    // terminator used as content of empty files
+    constexpr const char _empty_content[] = "";
+
+#if defined(_WIN32)
+
+    [[nodiscard]] std::system_error _last_system_error(const char* what)
+    {
+        return { static_cast<int>(::GetLastError()), std::system_category(), what };
+    }
+
+    MappedFile::MappedFile(const std::filesystem::path& p)
+    {
+        const auto file = ::CreateFileW(p.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            throw _last_system_error("Cannot open file");
+
+        LARGE_INTEGER size;
+        if (!::GetFileSizeEx(file, &size))
+        {
+            const auto e = _last_system_error("Cannot query file size");
+            ::CloseHandle(file);
+            throw e;
+        }
+        _size = static_cast<std::size_t>(size.QuadPart);
+
+        SYSTEM_INFO info;
+        ::GetSystemInfo(&info);
+
+        if (_size == 0)
+            _data = _empty_content;
+        else if (_size % info.dwPageSize != 0)
+        { // the tail of the last page is filled with zeros and acts as terminator
+            const auto mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping != nullptr)
+            {
+                _mapping = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                ::CloseHandle(mapping); // the view keeps the mapping alive
+            }
+            if (_mapping != nullptr)
+            {
+                _data        = static_cast<const char*>(_mapping);
+                _mapping_len = _size;
+            }
+        }
+
+        if (_data == nullptr)
+        { // no room for the terminator in the mapping, fallback to a plain read
+            _buffer.resize(_size);
+            for (std::size_t read = 0; read < _size;)
+            {
+                DWORD chunk = 0;
+                const auto request = static_cast<DWORD>(std::min<std::size_t>(_size - read, 1 << 30));
+                if (!::ReadFile(file, std::data(_buffer) + read, request, &chunk, nullptr) || chunk == 0)
+                {
+                    const auto e = _last_system_error("Cannot read file");
+                    ::CloseHandle(file);
+                    throw e;
+                }
+                read += chunk;
+            }
+            _data = std::data(_buffer);
+        }
+        ::CloseHandle(file);
+
+        assert(_data[_size] == '\0');
+    }
+
+    void MappedFile::_release() noexcept
+    {
+        if (_mapping != nullptr)
+            ::UnmapViewOfFile(_mapping);
+    }
+
+#else
+
+    [[nodiscard]] std::system_error _last_system_error(const char* what)
+    {
+        return { errno, std::generic_category(), what };
+    }
+
+    MappedFile::MappedFile(const std::filesystem::path& p)
+    {
+        const auto fd = ::open(p.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1)
+            throw _last_system_error("Cannot open file");
+
+        struct stat info;
+        if (::fstat(fd, &info) == -1)
+        {
+            const auto e = _last_system_error("Cannot query file size");
+            ::close(fd);
+            throw e;
+        }
+
+        if (S_ISREG(info.st_mode) && info.st_size == 0)
+            _data = _empty_content;
+        else if (S_ISREG(info.st_mode))
+        {
+            _size = static_cast<std::size_t>(info.st_size);
+
+            const auto page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+            if (_size % page_size != 0)
+            { // the tail of the last page is filled with zeros and acts as terminator
+                _mapping_len = _size;
+                _mapping     = ::mmap(nullptr, _mapping_len, PROT_READ, MAP_PRIVATE, fd, 0);
+            }
+            else
+            { // reserve an extra zero page after the content for the terminator
+                _mapping_len = _size + page_size;
+                _mapping     = ::mmap(nullptr, _mapping_len, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (_mapping != MAP_FAILED &&
+                    ::mmap(_mapping, _size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED)
+                {
+                    ::munmap(_mapping, _mapping_len);
+                    _mapping = MAP_FAILED;
+                }
+            }
+
+            if (_mapping == MAP_FAILED)
+            {
+                const auto e = _last_system_error("Cannot map file");
+                _mapping     = nullptr;
+                ::close(fd);
+                throw e;
+            }
+
+            ::madvise(_mapping, _size, MADV_SEQUENTIAL);
+            ::madvise(_mapping, _size, MADV_WILLNEED);
+            _data = static_cast<const char*>(_mapping);
+        }
+        else
+        { // pipes and character devices cannot be mapped
+            char chunk[1 << 16];
+            for (;;)
+            {
+                const auto n = ::read(fd, chunk, sizeof(chunk));
+                if (n == 0)
+                    break;
+                if (n == -1 && errno == EINTR)
+                    continue;
+                if (n == -1)
+                {
+                    const auto e = _last_system_error("Cannot read file");
+                    ::close(fd);
+                    throw e;
+                }
+                _buffer.append(chunk, static_cast<std::size_t>(n));
+            }
+            _data = std::data(_buffer);
+            _size = std::size(_buffer);
+        }
+        ::close(fd); // the mapping keeps the file alive
+
+        assert(_data[_size] == '\0');
+    }
+
+    void MappedFile::_release() noexcept
+    {
+        if (_mapping != nullptr)
+            ::munmap(_mapping, _mapping_len);
+    }
+
+#endif
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : _data{ std::exchange(other._data, nullptr) }
+        , _size{ std::exchange(other._size, 0) }
+        , _mapping{ std::exchange(other._mapping, nullptr) }
+        , _mapping_len{ std::exchange(other._mapping_len, 0) }
+        , _buffer{ std::move(other._buffer) }
+    {
+        if (_mapping == nullptr && _data != _empty_content)
+            _data = std::data(_buffer); // small buffers don't keep their address when moved
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            _release();
+            _data        = std::exchange(other._data, nullptr);
+            _size        = std::exchange(other._size, 0);
+            _mapping     = std::exchange(other._mapping, nullptr);
+            _mapping_len = std::exchange(other._mapping_len, 0);
+            _buffer      = std::move(other._buffer);
+            if (_mapping == nullptr && _data != _empty_content)
+                _data = std::data(_buffer);
+        }
+        return *this;
+    }
+
+    MappedFile::~MappedFile() noexcept
+    {
+        _release();
+    }
+
+} // namespace obj
@@ -2,10 +2,14 @@
 
 #include "obj-cpp/lexer.hpp"
 #include "obj-cpp/parser.hpp"
+#include "obj-cpp/tag_table.hpp"
 
+#include <array>
 #include <cassert>
-#include <map>
+#include <memory_resource>
 #include <span>
+#include <string_view>
+#include <vector>
 
 namespace obj
 {
@@ -15,7 +19,12 @@ namespace obj
         if (std::size(args) != 1)
             throw ParserError{ ParserErrorCode::invalid_arg_count };
 
-        r.materials.push_back({ .name = std::string{ args[0] } });
+        const auto m = r.materials.get_allocator().resource();
+        r.materials.push_back({ .name               = std::pmr::string{ args[0], m },
+                                .illumination_model = 0,
+                                .map_ka             = std::pmr::string(m),
+                                .map_kd             = std::pmr::string(m),
+                                .map_ks             = std::pmr::string(m) });
     }
 
     //template <class V>
@@ -51,33 +60,45 @@ namespace obj
         r.materials.back().ks[2] = parse_value(args[2]);
     }
 
+    // statement tags recognized by the parser, in the same order of _mtl_tags
+    enum class _MtlTag
+    {
+        newmtl,
+        ka,
+        kd,
+        ks,
+    };
+
+    constexpr TagTable _mtl_tags{ std::array<std::string_view, 4>{ "newmtl", "Ka", "Kd", "Ks" } };
+
     MtlParserResult _parse_as_mtl_impl(
         const char* data, const std::size_t size, const MtlParserConfig& c)
     {
-        using Handler = void (*)(const std::span<const Token>, MtlParserResult&);
+        const auto m = (nullptr != c.memory_resource) ? c.memory_resource : std::pmr::get_default_resource();
 
-        static const std::map<Token, Handler> tag_to_fun = {
-            { "newmtl", handle_newmtl },
-            { "Ka", handle_ka },
-            { "Kd", handle_kd },
-            { "Ks", handle_ks },
-        };
-
-        MtlParserResult result;
+        MtlParserResult         result{ .materials = std::pmr::vector<Material>(m) };
+        LineLexer               lexer;
+        std::pmr::vector<Token> tokens{ m };
+        lexer.reset(data + size);
         for (auto pos = data; pos != data + size;)
         {
-            std::vector<Token> tokens;
-            pos = lex_until_linefeed(pos, tokens);
+            tokens.clear();
+            pos = lexer.lex_until_linefeed(pos, tokens);
+            if (pos != data + size && *pos == '\0') // the lexer stops at a string terminator as at the end of input
+                throw ParserError{ ParserErrorCode::invalid_character };
 
             if (std::empty(tokens))
                 continue;
 
-            const auto& tag  = tokens[0];
-            const auto& args = std::span{ tokens }.last(std::size(tokens) - 1);
-            if (const auto fun = tag_to_fun.find(tag); fun != std::cend(tag_to_fun))
-                std::invoke((*fun).second, args, result);
-            else
-                throw ParserError{ ParserErrorCode::unknown_tag };
+            const auto args = std::span{ tokens }.last(std::size(tokens) - 1);
+            switch (const auto tag = _mtl_tags.find(tokens[0]); static_cast<_MtlTag>(tag))
+            {
+                case _MtlTag::newmtl: handle_newmtl(args, result); break;
+                case _MtlTag::ka: handle_ka(args, result); break;
+                case _MtlTag::kd: handle_kd(args, result); break;
+                case _MtlTag::ks: handle_ks(args, result); break;
+                default: throw ParserError{ ParserErrorCode::unknown_tag };
+            }
         }
 
         return result;
@@ -102,7 +123,7 @@ namespace obj
         const std::span<const char> s, const MtlParserConfig& c)
     {
         assert(s.back() == '\0'); // the buffer must be null-terminated like C strings
-        return _parse_as_mtl_impl(std::data(s), std::size(s), c);
+        return _parse_as_mtl_impl(std::data(s), std::size(s) - 1, c);
     }
 #endif
 
@@ -0,0 +1,320 @@
+#include "obj-cpp/normals.hpp"
+
+#include "obj-cpp/parallel.hpp"
+
+#include "geometry.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace obj
+{
+    template <class Value, class Index>
+    [[nodiscard]] Index _corner_vertex(const MeshData<Value, Index>& d, std::size_t i) noexcept
+    {
+        return d.faces[i / 3].triplets[i % 3].v;
+    }
+
+    template <class Value, class Index>
+    [[nodiscard]] Index _corner_vertex(const SoaMeshData<Value, Index>& d, std::size_t i) noexcept
+    {
+        return d.v_indices[i];
+    }
+
+    template <class Value, class Index>
+    [[nodiscard]] Index _corner_normal(const MeshData<Value, Index>& d, std::size_t i) noexcept
+    {
+        return d.faces[i / 3].triplets[i % 3].vn;
+    }
+
+    template <class Value, class Index>
+    [[nodiscard]] Index _corner_normal(const SoaMeshData<Value, Index>& d, std::size_t i) noexcept
+    {
+        return d.vn_indices[i];
+    }
+
+    template <class Value, class Index>
+    [[nodiscard]] std::size_t _vertex_count(const MeshData<Value, Index>& d) noexcept
+    {
+        return std::size(d.v);
+    }
+
+    template <class Value, class Index>
+    [[nodiscard]] std::size_t _vertex_count(const SoaMeshData<Value, Index>& d) noexcept
+    {
+        return std::size(d.x);
+    }
+
+    template <class Value, class Index>
+    [[nodiscard]] std::array<Value, 3> _vertex_at(const MeshData<Value, Index>& d, std::size_t e) noexcept
+    {
+        return { d.v[e].x, d.v[e].y, d.v[e].z };
+    }
+
+    template <class Value, class Index>
+    [[nodiscard]] std::array<Value, 3> _vertex_at(const SoaMeshData<Value, Index>& d, std::size_t e) noexcept
+    {
+        return { d.x[e], d.y[e], d.z[e] };
+    }
+
+    // position in the vertex list of the geometric vertex of a face corner
+    template <class Data>
+    [[nodiscard]] std::size_t _vertex_position(const Data& d, std::size_t i, bool zero_based)
+    {
+        const auto v = static_cast<std::size_t>(_corner_vertex(d, i));
+        const auto e = zero_based ? v : v - 1; // missing vertices wrap around
+        if (e >= _vertex_count(d))
+            throw std::out_of_range{ "Face vertex index out of range" };
+        return e;
+    }
+
+    // normal of each face, with length twice its area, and weight of its contribution to each corner
+    template <class Value>
+    struct _FaceNormals
+    {
+        std::vector<Value> x, y, z;
+        std::vector<Value> weights; // empty when all weights are one
+    };
+
+    template <class Value, class Data>
+    [[nodiscard]] _FaceNormals<Value> _face_normals(const Data& d, const NormalConfig& c)
+    {
+        const auto faces = _corner_count(d) / 3;
+        const auto angle = (c.weighting == NormalConfig::Weighting::angle);
+
+        _FaceNormals<Value> n{ std::vector<Value>(faces), std::vector<Value>(faces), std::vector<Value>(faces),
+            std::vector<Value>(angle ? 3 * faces : 0) };
+        (void)_map_ranges(faces, c.thread_count, [&](std::size_t first, std::size_t last) {
+            for (auto f = first; f < last; ++f)
+            {
+                std::array<std::array<Value, 3>, 3> p;
+                for (std::size_t k = 0; k < 3; ++k)
+                    p[k] = _vertex_at(d, _vertex_position(d, 3 * f + k, c.zero_based_indices));
+
+                const auto a = _sub(p[1], p[0]), b = _sub(p[2], p[0]);
+                n.x[f] = a[1] * b[2] - a[2] * b[1];
+                n.y[f] = a[2] * b[0] - a[0] * b[2];
+                n.z[f] = a[0] * b[1] - a[1] * b[0];
+                if (!angle)
+                    continue;
+
+                // the cross product of the edges at each corner is the face normal,
+                // so the angle follows from its length and the dot product of the edges
+                const auto length = std::sqrt(n.x[f] * n.x[f] + n.y[f] * n.y[f] + n.z[f] * n.z[f]);
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    const auto dot       = _dot(_sub(p[(k + 1) % 3], p[k]), _sub(p[(k + 2) % 3], p[k]));
+                    n.weights[3 * f + k] = (length > 0) ? std::atan2(length, dot) / length : 0;
+                }
+            }
+            return true;
+        });
+        return n;
+    }
+
+    // normal shared by the corners of a smoothing group around a vertex,
+    // listed for each vertex as in most meshes vertices belong to a single group
+    struct _SharedNormal
+    {
+        std::uint32_t group;
+        std::size_t   id;
+        std::size_t   next;
+    };
+
+    template <class Value, class Index, class Data>
+    void _generate_normals(Data& d, std::span<const SmoothingGroup<Index>> groups, const NormalConfig& c)
+    {
+        const auto corners = _corner_count(d);
+        const auto n       = _face_normals<Value>(d, c); // throws before data is changed
+
+        // normals in order of first use, as the weighted sum of the face normals until normalized
+        std::vector<Value> x, y, z;
+
+        const auto base       = c.zero_based_indices ? std::size_t{ 0 } : std::size_t{ 1 };
+        const auto add_normal = [&](Value nx, Value ny, Value nz) {
+            if (std::size(x) + base > std::numeric_limits<Index>::max())
+                throw std::length_error{ "Too many normals for the index type" };
+            x.push_back(nx);
+            y.push_back(ny);
+            z.push_back(nz);
+            return std::size(x) - 1;
+        };
+
+        // the corners of a shared normal have the same vertex, so the vertices are split in ranges
+        // and the normals of each range are accumulated by a thread, in face order as a serial loop
+        const auto vertex_bounds = _split_range(_vertex_count(d), c.thread_count, 1 << 14);
+        const auto vertex_range  = [&](std::size_t e) {
+            return static_cast<std::size_t>(std::upper_bound(std::cbegin(vertex_bounds) + 1, std::cend(vertex_bounds) - 1, e) -
+                                            std::cbegin(vertex_bounds) - 1);
+        };
+
+        constexpr auto                        none = std::numeric_limits<std::size_t>::max();
+        std::vector<Index>                    ids(corners);
+        std::vector<std::size_t>              heads(_vertex_count(d), none);
+        std::vector<_SharedNormal>            shared;
+        std::vector<std::vector<std::size_t>> smoothed(std::size(vertex_bounds) - 1); // corners of each range
+
+        // normals are numbered in order of first use, which is inherently sequential,
+        // while their sums are accumulated afterwards
+        auto          run   = std::cbegin(groups);
+        std::uint32_t group = 0;
+        for (std::size_t f = 0; f < corners / 3; ++f)
+        {
+            for (; run != std::cend(groups) && static_cast<std::size_t>(run->first_face) <= f; ++run)
+                group = run->id;
+
+            if (group == 0) // flat face
+            {
+                const auto id = add_normal(n.x[f], n.y[f], n.z[f]);
+                for (std::size_t k = 0; k < 3; ++k)
+                    ids[3 * f + k] = static_cast<Index>(id + base);
+                continue;
+            }
+
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                const auto e = _vertex_position(d, 3 * f + k, c.zero_based_indices);
+
+                auto s = heads[e];
+                while (s != none && shared[s].group != group)
+                    s = shared[s].next;
+                if (s == none)
+                {
+                    const auto id = add_normal(0, 0, 0);
+                    shared.push_back({ group, id, heads[e] });
+                    s = heads[e] = std::size(shared) - 1;
+                }
+
+                ids[3 * f + k] = static_cast<Index>(shared[s].id + base);
+                smoothed[vertex_range(e)].push_back(3 * f + k);
+            }
+        }
+
+        (void)_map_ranges(vertex_bounds, [&](std::size_t first, std::size_t) {
+            for (const auto i : smoothed[vertex_range(first)])
+            {
+                const auto f  = i / 3;
+                const auto id = static_cast<std::size_t>(ids[i]) - base;
+                const auto w  = std::empty(n.weights) ? Value{ 1 } : n.weights[i];
+                x[id] += w * n.x[f];
+                y[id] += w * n.y[f];
+                z[id] += w * n.z[f];
+            }
+            return true;
+        });
+
+        (void)_map_ranges(std::size(x), c.thread_count, [&](std::size_t first, std::size_t last) {
+            for (auto i = first; i < last; ++i)
+            {
+                const auto length = std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+                const auto scale  = (length > 0) ? 1 / length : 0;
+                x[i] *= scale;
+                y[i] *= scale;
+                z[i] *= scale;
+            }
+            return true;
+        });
+
+        if constexpr (std::is_same_v<Data, MeshData<Value, Index>>)
+        {
+            d.vn.resize(std::size(x));
+            for (std::size_t i = 0; i < std::size(x); ++i)
+                d.vn[i] = { x[i], y[i], z[i] };
+            for (std::size_t i = 0; i < corners; ++i)
+                d.faces[i / 3].triplets[i % 3].vn = ids[i];
+        }
+        else
+        {
+            // copied, so that the data keeps allocating from its own memory resource
+            d.nx.assign(std::cbegin(x), std::cend(x));
+            d.ny.assign(std::cbegin(y), std::cend(y));
+            d.nz.assign(std::cbegin(z), std::cend(z));
+            d.vn_indices.assign(std::cbegin(ids), std::cend(ids));
+        }
+    }
+
+    // normals of the polygon triplets, taken from a triangle of the polygon at the same vertex
+    template <class Data, class Index>
+    void _update_polygons(const Data& d, PolygonData<Index>& polygons, const NormalConfig& c)
+    {
+        (void)_map_ranges(std::size(polygons), c.thread_count, [&](std::size_t first, std::size_t last) {
+            for (auto i = first; i < last; ++i)
+            {
+                // a polygon of n vertices is split in n - 2 consecutive triangles
+                const auto begin = 3 * static_cast<std::size_t>(polygons.faces[i]);
+                const auto end   = std::min(begin + 3 * (polygons.last(i) - polygons.first(i) - 2), _corner_count(d));
+                for (auto j = polygons.first(i); j < polygons.last(i); ++j)
+                {
+                    auto& t = polygons.triplets[j];
+                    for (auto k = begin; k < end; ++k)
+                        if (_corner_vertex(d, k) == t.v)
+                        {
+                            t.vn = _corner_normal(d, k);
+                            break;
+                        }
+                }
+            }
+            return true;
+        });
+    }
+
+    template <class Value, class Index, class Result>
+    void _generate_result_normals(Result& r, const NormalConfig& c)
+    {
+        _generate_normals<Value, Index>(r.data, std::span{ r.smoothing_groups }, c);
+        _update_polygons(r.data, r.polygons, c);
+    }
+
+    template <class Value, class Index>
+    void generate_normals(MeshData<Value, Index>& d, std::type_identity_t<std::span<const SmoothingGroup<Index>>> groups,
+        const NormalConfig& c)
+    {
+        _generate_normals<Value, Index>(d, groups, c);
+    }
+
+    template <class Value, class Index>
+    void generate_normals(SoaMeshData<Value, Index>& d, std::type_identity_t<std::span<const SmoothingGroup<Index>>> groups,
+        const NormalConfig& c)
+    {
+        _generate_normals<Value, Index>(d, groups, c);
+    }
+
+    template <class Value, class Index>
+    void generate_normals(ObjParserResult<Value, Index>& r, const NormalConfig& c)
+    {
+        _generate_result_normals<Value, Index>(r, c);
+    }
+
+    template <class Value, class Index>
+    void generate_normals(ObjParserSoaResult<Value, Index>& r, const NormalConfig& c)
+    {
+        _generate_result_normals<Value, Index>(r, c);
+    }
+
+
+    // explicit instantiations for the supported value and index types
+
+#define OBJCPP_INSTANTIATE_NORMALS(Value, Index)                                                                \
+    template void generate_normals(MeshData<Value, Index>&, std::span<const SmoothingGroup<Index>>, const NormalConfig&); \
+    template void generate_normals(SoaMeshData<Value, Index>&, std::span<const SmoothingGroup<Index>>, const NormalConfig&); \
+    template void generate_normals(ObjParserResult<Value, Index>&, const NormalConfig&);                                      \
+    template void generate_normals(ObjParserSoaResult<Value, Index>&, const NormalConfig&);
+
+    OBJCPP_INSTANTIATE_NORMALS(float, std::uint16_t)
+    OBJCPP_INSTANTIATE_NORMALS(float, std::uint32_t)
+    OBJCPP_INSTANTIATE_NORMALS(float, std::uint64_t)
+    OBJCPP_INSTANTIATE_NORMALS(double, std::uint16_t)
+    OBJCPP_INSTANTIATE_NORMALS(double, std::uint32_t)
+    OBJCPP_INSTANTIATE_NORMALS(double, std::uint64_t)
+
+#undef OBJCPP_INSTANTIATE_NORMALS
+
+} // namespace obj
\ No newline at end of file
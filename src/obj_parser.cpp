@@ -1,17 +1,30 @@
 #include "obj-cpp/obj_parser.hpp"
 
 #include "obj-cpp/lexer.hpp"
+#include "obj-cpp/mapped_file.hpp"
+#include "obj-cpp/parallel.hpp"
 #include "obj-cpp/parser.hpp"
+#include "obj-cpp/tag_table.hpp"
 
 #include <algorithm>
 #include <array>
 #include <cassert>
 #include <charconv>
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <future>
+#include <limits>
+#include <memory_resource>
+#include <mutex>
+#include <numeric>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <variant>
 #include <vector>
 
@@ -46,16 +59,25 @@ namespace obj
     //constexpr const std::string_view OBJ_TAG_NORMAL          = "vn";
     //constexpr const std::string_view OBJ_TAG_TEXCOORDS       = "vt"
 
-    constexpr const std::string_view ignored_keywords[] = {
-        "call",   // file import command
-        "csh",    // UNIX shell command
-        "g",      // group statement
-        "mtllib", // material attribute
-        "o",      // object name statement
-        "s",      // smoothing group statement
-        "usemtl"  // material reference statement
+    // statement tags recognized by the parser, in the same order of _obj_tags
+    enum class _ObjTag
+    {
+        v,
+        vn,
+        vt,
+        f,
+        o,
+        g,
+        s,
+        mtllib,
+        usemtl,
+        call, // file import command, ignored
+        csh,  // UNIX shell command, ignored
     };
 
+    constexpr TagTable _obj_tags{ std::array<std::string_view, 11>{
+        "v", "vn", "vt", "f", "o", "g", "s", "mtllib", "usemtl", "call", "csh" } };
+
     /*
     struct _token // single token info
     {
@@ -104,225 +126,2052 @@ namespace obj
     // check if a keyword is ignored by current implementation
     [[nodiscard]] bool _is_ignored_keyword(const std::string_view keyword) noexcept
     {
-        return std::find(std::cbegin(ignored_keywords), std::cend(ignored_keywords),
-                   keyword) != std::cend(ignored_keywords);
+        const auto tag = _obj_tags.find(keyword);
+        return tag == static_cast<std::size_t>(_ObjTag::call) || tag == static_cast<std::size_t>(_ObjTag::csh);
     }
 
 
-#if !defined(_drako_disable_exception) /*vvv exceptions vvv*/
+    // check if a position or a count fits in the index type of the result
+    template <class Index>
+    [[nodiscard]] constexpr bool _fits_index(const std::size_t i) noexcept
+    {
+        return i <= std::numeric_limits<Index>::max();
+    }
+
+    // check if the positions [offset, offset + count) fit in the index type of the result
+    template <class Index>
+    [[nodiscard]] constexpr bool _fits_index(const std::size_t offset, const std::size_t count) noexcept
+    {
+        return count == 0 || _fits_index<Index>(offset + count - 1);
+    }
 
-    //template <class Value, class Index>
-    void handle_v_line(std::span<const Token> args, ObjParserResult& pr)
+
+    // error of a statement, located at the character that caused it
+    struct _StatementError
+    {
+        _pec        ec;
+        const char* where;
+    };
+
+    // outcome of the parsing of a statement, or of one of its arguments
+    using _Status = std::optional<_StatementError>;
+
+
+    // errors of a source text, located only when reported
+    class _ErrorLog
+    {
+    public:
+        // with recover set, parsing resumes at the line after each error
+        explicit _ErrorLog(const char* source, bool recover) noexcept
+            : _source{ source }, _counted{ source }, _line_start{ source }, _recover{ recover } {}
+
+        // record an error at a position of the source text,
+        // returns true if parsing goes on with the next line
+        bool report(const char* where, _pec ec)
+        {
+            if (where < _counted) // errors come in source order, except for the ones of pending lines
+                _counted = _line_start = _source, _line = 1;
+            for (; _counted != where; ++_counted)
+                if (*_counted == '\n')
+                    ++_line, _line_start = _counted + 1;
+
+            _reports.emplace_back(_line, static_cast<std::size_t>(where - _line_start) + 1,
+                static_cast<std::size_t>(where - _source), ec);
+            return _recover;
+        }
+
+        // record the 'o' statements of the objects added from now on, to locate the errors
+        // about them that are only found once the chunks of the source are merged
+        void track_objects(std::vector<const char*>& statements) noexcept { _objects = &statements; }
+
+        // an object has been added by the statement at the given position
+        void add_object(const char* where)
+        {
+            if (nullptr != _objects)
+                _objects->push_back(where);
+        }
+
+        [[nodiscard]] bool recovering() const noexcept { return _recover; }
+
+        [[nodiscard]] const char* source() const noexcept { return _source; }
+
+        [[nodiscard]] bool empty() const noexcept { return std::empty(_reports); }
+
+        [[nodiscard]] std::vector<ParserErrorReport>& reports() noexcept { return _reports; }
+
+    private:
+        const char*                    _source;
+        const char*                    _counted;    // line feeds are counted up to here
+        const char*                    _line_start; // of the line that contains _counted
+        std::size_t                    _line = 1;
+        bool                           _recover;
+        std::vector<ParserErrorReport> _reports;
+        std::vector<const char*>*      _objects = nullptr;
+    };
+
+
+
+    // parse an index integer according to specs
+    template <class Index>
+    [[nodiscard]] _Status _parse_index(std::string_view s, Index& i) noexcept
+    {
+        const auto last = std::data(s) + std::size(s);
+        if (const auto r = std::from_chars(std::data(s), last, i); r.ec == std::errc::result_out_of_range)
+            return _StatementError{ _pec::index_out_of_range, std::data(s) };
+        else if (r.ec != std::errc{} || r.ptr != last)
+            return _StatementError{ _pec::invalid_arg_format, std::data(s) };
+        return std::nullopt;
+    }
+
+    // parse a floating point value according to specs
+    template <class Value>
+    [[nodiscard]] _Status _parse_value(const Token& t, Value& v) noexcept
+    {
+        const auto last = std::data(t) + std::size(t);
+        if (const auto r = parse_float(std::data(t), last, v); r.ec != std::errc{} || r.ptr != last)
+            return _StatementError{ _pec::invalid_arg_format, std::data(t) };
+        return std::nullopt;
+    }
+
+    // true for the characters accepted by the lexer, as part of a line
+    [[nodiscard]] constexpr bool _is_lexer_character(const char c) noexcept
+    {
+        return c == ' ' || (c >= '!' && c <= '}');
+    }
+
+    // number of 'v', 'vn' and 'vt' statements in the range [first, last), counted as the parser
+    // declares them: with tags recognized as the lexer does, and lines with invalid characters
+    // skipped, since they aren't declared even when errors are recovered
+    [[nodiscard]] StatementCounts _count_elements(const char* first, const char* last) noexcept
+    {
+        StatementCounts n;
+        for (auto p = first; p != last;)
+        {
+            while (p != last && *p == ' ')
+                ++p;
+            const auto tag = p;
+            while (p != last && *p != ' ' && *p != '#' && *p != '\n')
+                ++p;
+            const std::string_view t{ tag, static_cast<std::size_t>(p - tag) };
+
+            auto valid = true;
+            for (; p != last && *p != '\n'; ++p)
+                valid &= _is_lexer_character(*p);
+            if (valid && std::ranges::all_of(t, _is_lexer_character))
+            {
+                n.v += (t == "v");
+                n.vn += (t == "vn");
+                n.vt += (t == "vt");
+            }
+            if (p != last)
+                ++p;
+        }
+        return n;
+    }
+
+    // resolves relative indices against the elements declared before each statement
+    class _IndexResolver
+    {
+    public:
+        using Kind = std::size_t StatementCounts::*;
+
+        // elements declared before the first line are computed on demand,
+        // as chunks parsed in parallel rarely need them
+        explicit _IndexResolver(StatementCounts& declared, std::function<StatementCounts()> preceding = {})
+            : _declared{ declared }, _preceding{ std::move(preceding) } {}
+
+        // a new element has been declared
+        void add(Kind k) noexcept { ++(_declared.*k); }
+
+        // absolute one-based index of the element at the given distance, 1 being the last one;
+        // returns 0 if there aren't enough elements before the statement
+        [[nodiscard]] std::size_t resolve(Kind k, std::uint64_t distance)
+        {
+            if (_preceding)
+            {
+                _base      = _preceding();
+                _preceding = nullptr;
+            }
+            const auto declared = _declared.*k + _base.*k;
+            return (distance <= declared) ? declared - distance + 1 : 0;
+        }
+
+    private:
+        StatementCounts&                 _declared; // by the lines parsed so far
+        std::function<StatementCounts()> _preceding;
+        StatementCounts                  _base;
+    };
+
+    // parse an index of a face, with relative ones resolved to absolute
+    template <class Index>
+    [[nodiscard]] _Status _parse_face_index(std::string_view s, Index& i, _IndexResolver& r, _IndexResolver::Kind k)
+    {
+        if (std::empty(s) || s.front() != '-')
+            return _parse_index(s, i);
+
+        std::uint64_t distance = 0;
+        if (const auto e = _parse_index(s.substr(1), distance))
+            return e;
+        if (distance == 0)
+            return _StatementError{ _pec::tag_f_invalid_args_format, std::data(s) };
+        if (const auto a = r.resolve(k, distance); a != 0 && _fits_index<Index>(a))
+        {
+            i = static_cast<Index>(a);
+            return std::nullopt;
+        }
+        return _StatementError{ _pec::index_out_of_range, std::data(s) };
+    }
+
+    // parse a v/vt/vn triplet, with relative indices resolved to absolute
+    template <class Index>
+    [[nodiscard]] _Status _parse_face_triplet(const Token& t, Triplet<Index>& triplet, _IndexResolver& r)
+    {
+        const auto end_1 = t.find('/');
+        const auto end_2 = t.find('/', end_1 + 1);
+        if (std::count(std::cbegin(t), std::cend(t), '/') != 2 || end_1 == 0) // there must be the vertex index at least
+            return _StatementError{ _pec::invalid_arg_format, std::data(t) };
+
+        triplet = {};
+        if (const auto e = _parse_face_index(t.substr(0, end_1), triplet.v, r, &StatementCounts::v))
+            return e;
+        if (end_2 - end_1 > 1)
+            if (const auto e = _parse_face_index(t.substr(end_1 + 1, end_2 - end_1 - 1), triplet.vt, r, &StatementCounts::vt))
+                return e;
+        if (std::size(t) - end_2 > 1)
+            if (const auto e = _parse_face_index(t.substr(end_2 + 1), triplet.vn, r, &StatementCounts::vn))
+                return e;
+        if (triplet.v == 0)
+            return _StatementError{ _pec::tag_f_invalid_args_format, std::data(t) };
+        return std::nullopt;
+    }
+
+    // parse up to N values of a statement
+    template <std::size_t N, class Value>
+    [[nodiscard]] _Status _parse_values(std::span<const Token> args, Value (&values)[N]) noexcept
+    {
+        for (std::size_t i = 0; i < std::size(args); ++i)
+            if (const auto e = _parse_value(args[i], values[i]))
+                return e;
+        return std::nullopt;
+    }
+
+    template <class Visitor>
+    [[nodiscard]] _Status handle_v_line(const Token& tag, std::span<const Token> args, Visitor& visitor)
     {
+        using Value = typename Visitor::value_type;
+
         if (const auto s = std::size(args); s != 3 && s != 4)
-            throw ParserError{ _pec::tag_v_invalid_args_count };
+            return _StatementError{ _pec::tag_v_invalid_args_count, std::data(tag) };
 
         Value v[4] = { 0, 0, 0, Defaults<Value>::vertex_weight };
-        for (auto i = 0; i < std::size(args); ++i)
-            v[i] = parse_value(args[i]);
+        if (const auto e = _parse_values(args, v))
+            return e;
 
-        pr.data.v.emplace_back(v[0], v[1], v[2], v[3]);
+        visitor.on_vertex({ v[0], v[1], v[2], v[3] });
+        return std::nullopt;
     }
 
     //template <class Value, class Index>
     //void handle_v_line_ext(std::span<const Token> args, ParserResult<Value, Index>& pr);
 
-    //template <class Value, class Index>
-    void handle_vn_line(std::span<const Token> args, ObjParserResult& pr)
+    template <class Visitor>
+    [[nodiscard]] _Status handle_vn_line(const Token& tag, std::span<const Token> args, Visitor& visitor)
     {
+        using Value = typename Visitor::value_type;
+
         if (std::size(args) != 3)
-            throw ParserError{ ParserErrorCode::tag_vn_invalid_args_count };
+            return _StatementError{ _pec::tag_vn_invalid_args_count, std::data(tag) };
 
         Value vn[3] = { 0, 0, 0 };
-        for (auto i = 0; i < 3; ++i)
-            vn[i] = parse_value(args[i]);
+        if (const auto e = _parse_values(args, vn))
+            return e;
 
-        pr.data.vn.emplace_back(vn[0], vn[1], vn[2]);
+        visitor.on_normal({ vn[0], vn[1], vn[2] });
+        return std::nullopt;
     }
 
-    //template <class V, class I>
-    void handle_vt_line(std::span<const Token> args, ObjParserResult& pr)
+    template <class Visitor>
+    [[nodiscard]] _Status handle_vt_line(const Token& tag, std::span<const Token> args, Visitor& visitor)
     {
+        using Value = typename Visitor::value_type;
+
         if (const auto s = std::size(args); s < 1 || s > 3)
-            throw ParserError{ _pec::tag_vt_invalid_args_count };
+            return _StatementError{ _pec::tag_vt_invalid_args_count, std::data(tag) };
 
         Value vt[3] = {
             Defaults<Value>::texcoord_value,
             Defaults<Value>::texcoord_value,
             Defaults<Value>::texcoord_value
         };
-        for (auto i = 0; i < std::size(args); ++i)
-            vt[i] = parse_value(args[i]);
+        if (const auto e = _parse_values(args, vt))
+            return e;
 
-        pr.data.vt.emplace_back(vt[0], vt[1], vt[2]);
+        visitor.on_texcoord({ vt[0], vt[1], vt[2] });
+        return std::nullopt;
     }
 
-    //template <class V, class I>
-    void handle_f_line(std::span<const Token> args, ObjParserResult& pr)
+    template <class Visitor>
+    [[nodiscard]] _Status handle_f_line(const Token& tag, std::span<const Token> args, Visitor& visitor,
+        _IndexResolver& r, std::pmr::memory_resource* scratch)
     {
-        if (std::size(args) != 3) // NOTE: currently we only support triangular faces
-            throw ParserError{ _pec::tag_f_invalid_args_count };
+        using Index = typename Visitor::index_type;
 
-        Face f{
-            parse_triplet(args[0]),
-            parse_triplet(args[1]),
-            parse_triplet(args[2])
-        };
-        //const auto v1, vt1, vn1 = _parse_triplette(args[0]);
+        if (std::size(args) < 3)
+            return _StatementError{ _pec::tag_f_invalid_args_count, std::data(tag) };
+
+        if (std::size(args) == 3)
+        {
+            Face<Index> f;
+            for (std::size_t i = 0; i < 3; ++i)
+                if (const auto e = _parse_face_triplet(args[i], f.triplets[i], r))
+                    return e;
+            visitor.on_face(f);
+        }
+        else
+        {
+            // polygons with a few vertices are collected on the stack
+            alignas(Triplet<Index>) std::byte   storage[1024];
+            std::pmr::monotonic_buffer_resource arena{ storage, sizeof(storage), scratch };
+            std::pmr::vector<Triplet<Index>>    polygon(std::size(args), &arena);
+            for (std::size_t i = 0; i < std::size(args); ++i)
+                if (const auto e = _parse_face_triplet(args[i], polygon[i], r))
+                    return e;
+            visitor.on_polygon(polygon);
+        }
+        return std::nullopt;
+    }
+
+    template <class Visitor>
+    [[nodiscard]] _Status handle_o_line(const Token& tag, std::span<const Token> args, Visitor& visitor)
+    {
+        if (std::size(args) != 1)
+            return _StatementError{ _pec::tag_o_invalid_args_count, std::data(tag) };
 
-        if (std::any_of(f.triplets.cbegin(), f.triplets.cend(),
-                [](auto x) { return x.v == 0; }))
-            throw ParserError{ _pec::tag_f_invalid_args_format };
+        visitor.on_object(args[0]);
+        return std::nullopt;
+    }
 
-        /*
-        // check if some triple is missing a vertex
-        if (const auto c = std::count(vt.begin(), vt.end(), 0); c != 0 && c != 3)
-            throw ParserError{ _pec::tag_f_invalid_args_format };
+    template <class Visitor>
+    void handle_g_line(std::span<const Token> args, Visitor& visitor)
+    {
+        visitor.on_group(args);
+    }
 
-        // check if some triple is missing a vertex
-        if (const auto c = std::count(vn.begin(), vn.end(), 0); c != 0 && c != 3)
-            throw ParserError{ _pec::tag_f_invalid_args_format };
-            */
+    template <class Visitor>
+    void handle_mtllib_line(std::span<const Token> args, Visitor& visitor)
+    {
+        visitor.on_material_library(args);
+    }
 
-        pr.data.faces.emplace_back(f);
+    template <class Visitor>
+    void handle_usemtl_line(std::span<const Token> args, Visitor& visitor)
+    {
+        visitor.on_use_material(args);
     }
 
-    //template <class V, class I>
-    void handle_o_line(std::span<const Token> args, ObjParserResult& pr)
+    template <class Visitor>
+    void handle_s_line(std::span<const Token> args, Visitor& visitor)
     {
-        if (std::size(args) != 1)
-            throw ParserError{ _pec::tag_o_invalid_args_count };
+        visitor.on_smoothing_group(args);
+    }
 
-        const auto& name = args[0];
-        if (std::any_of(std::cbegin(pr.objects), std::cend(pr.objects),
+
+    // object that allocates from the same memory resource as the list it's added to
+    template <class Index>
+    [[nodiscard]] Object<Index> _make_object(const std::pmr::vector<Object<Index>>& objects, std::string_view name)
+    {
+        const auto m = objects.get_allocator().resource();
+        return { std::pmr::string{ name, m }, std::pmr::vector<Index>(m) };
+    }
+
+    // append a new object, names must be unique
+    template <class Index>
+    [[nodiscard]] bool _add_object(std::pmr::vector<Object<Index>>& objects, std::string_view name)
+    {
+        if (std::any_of(std::cbegin(objects), std::cend(objects),
                 [&](const auto& x) { return x.name == name; }))
-            throw ParserError{ _pec::duplicate_object_name };
+            return false;
+
+        objects.push_back(_make_object(objects, name));
+        return true;
+    }
+
+    // group number of a 's' statement, either 'off' or an unsigned integer
+    [[nodiscard]] std::variant<std::uint32_t, _pec> _parse_smoothing_group(std::span<const Token> args) noexcept
+    {
+        if (std::size(args) != 1)
+            return _pec::invalid_arg_count;
+
+        const auto    arg = args[0];
+        std::uint32_t id  = 0;
+        if (arg == "off")
+            return id;
+        if (const auto [last, ec] = std::from_chars(std::data(arg), std::data(arg) + std::size(arg), id);
+            ec != std::errc{} || last != std::data(arg) + std::size(arg))
+            return _pec::invalid_arg_format;
+        return id;
+    }
+
+    // start a run of faces in a smoothing group, merged with the last run if it's the same group;
+    // the first run is always stored as the group of the preceding faces may be unknown
+    template <class Index>
+    void _push_smoothing_group(std::pmr::vector<SmoothingGroup<Index>>& groups, std::size_t face, std::uint32_t id)
+    {
+        if (!std::empty(groups) && groups.back().first_face == face) // the last run has no faces
+            groups.pop_back();
+        if (std::empty(groups) || groups.back().id != id)
+            groups.push_back({ static_cast<Index>(face), id });
+    }
+
+    template <class Index>
+    [[nodiscard]] std::optional<_pec> _add_smoothing_group(
+        std::pmr::vector<SmoothingGroup<Index>>& groups, std::size_t face, std::span<const Token> args)
+    {
+        const auto group = _parse_smoothing_group(args);
+        if (const auto ec = std::get_if<_pec>(&group))
+            return *ec;
+        if (!_fits_index<Index>(face))
+            return _pec::index_out_of_range;
 
-        pr.objects.push_back({ std::string{ name }, {} });
+        _push_smoothing_group(groups, face, std::get<std::uint32_t>(group));
+        return std::nullopt;
     }
 
-    /* void _handle_g_line(std::span<const Token> args, _context& state)
+    template <class Value, class Index>
+    void ObjResultBuilder<Value, Index>::on_vertex(const Vertex<Value>& v)
     {
-        if (std::size(args) == 0)
-            throw ParserError{ _pec::invalid_arg_count };
+        _result.data.v.push_back(v);
+    }
 
-        assert(state.last_face_index_checkpoint <= std::size(state.faces));
+    template <class Value, class Index>
+    void ObjResultBuilder<Value, Index>::on_normal(const Normal<Value>& vn)
+    {
+        _result.data.vn.push_back(vn);
+    }
 
-        auto& data = state.groups.data;
-        for (auto g = 0; g < std::size(state.active_groups_ids); ++g)
-            for (auto i = state.last_face_index_checkpoint; i < std::size(state.faces); ++i)
-                data[g].faces.emplace_back(i);
+    template <class Value, class Index>
+    void ObjResultBuilder<Value, Index>::on_texcoord(const Texcoord<Value>& vt)
+    {
+        _result.data.vt.push_back(vt);
+    }
 
+    // check if the triangles of a face, and the face itself if recorded, fit in the index type
+    template <class Index>
+    [[nodiscard]] bool _fits_face(const PolygonData<Index>& p, std::size_t triplets, std::size_t first_face,
+        bool recorded) noexcept
+    {
+        return _fits_index<Index>(first_face, triplets - 2) &&
+               (!recorded || _fits_index<Index>(std::size(p.triplets), 1));
+    }
 
-        state.active_groups_ids.clear();
-        state.last_face_index_checkpoint = std::size(state.faces);
+    // store a face as written in the source, along with the position of its first triangle
+    template <class Index>
+    void _record_polygon(PolygonData<Index>& p, std::span<const Triplet<Index>> triplets, std::size_t first_face)
+    {
+        p.offsets.push_back(static_cast<Index>(std::size(p.triplets)));
+        p.faces.push_back(static_cast<Index>(first_face));
+        p.triplets.insert(std::end(p.triplets), std::cbegin(triplets), std::cend(triplets));
+    }
 
-        auto& names = state.groups.names;
-        for (const auto& name : args)
+    template <class Value, class Index>
+    void ObjResultBuilder<Value, Index>::on_face(const Face<Index>& f)
+    {
+        const auto recorded = (_polygons == _RecordedPolygons::all);
+        if (!_fits_face(_result.polygons, 3, std::size(_result.data.faces), recorded))
         {
-            const auto it = std::find(std::cbegin(names), std::cend(names), name.view());
-            if (it == std::cend(names))
-            { // create a new group with provided name
-                names.emplace_back(name.view());
-                state.groups.data.emplace_back();
-            }
-            const auto index = static_cast<std::size_t>(std::distance(std::cbegin(names), it));
-            state.active_groups_ids.emplace_back(index);
+            _error = _pec::index_out_of_range;
+            return;
+        }
+
+        if (recorded)
+            _record_polygon<Index>(_result.polygons, f.triplets, std::size(_result.data.faces));
+        _push_face(f);
+    }
+
+    template <class Value, class Index>
+    void ObjResultBuilder<Value, Index>::on_polygon(std::span<const Triplet<Index>> triplets)
+    {
+        const auto recorded = (_polygons != _RecordedPolygons::none);
+        if (!_fits_face(_result.polygons, std::size(triplets), std::size(_result.data.faces), recorded))
+        {
+            _error = _pec::index_out_of_range;
+            return;
         }
-    }*/
 
-    //template <class V, class I>
-    ObjParserResult _parse_as_obj_impl(
-        const char* data, const std::size_t size, const ObjParserConfig& c)
+        if (recorded)
+            _record_polygon(_result.polygons, triplets, std::size(_result.data.faces));
+        for (std::size_t i = 1; i + 1 < std::size(triplets); ++i) // fan, fixed later if needed
+            _push_face({ { triplets[0], triplets[i], triplets[i + 1] } });
+    }
+
+    template <class Value, class Index>
+    void ObjResultBuilder<Value, Index>::_push_face(const Face<Index>& f)
     {
-        using Handler = void (*)(std::span<const Token>, ObjParserResult&);
+        if (!std::empty(_result.objects)) // faces belong to the last declared object
+            _result.objects.back().faces.push_back(static_cast<Index>(std::size(_result.data.faces)));
+        _result.data.faces.push_back(f);
+    }
 
-        // matched tags and specialized grammar parsing functions
-        const std::vector<std::pair<Token, Handler>> tag_fun_pairs = {
-            { "v", handle_v_line },
-            { "vn", handle_vn_line },
-            { "vt", handle_vt_line },
-            { "f", handle_f_line },
-            { "o", handle_o_line },
-            //{ "mtllib", nullptr },
-        };
+    template <class Value, class Index>
+    void ObjResultBuilder<Value, Index>::on_object(std::string_view name)
+    {
+        if (!_add_object(_result.objects, name))
+            _error = _pec::duplicate_object_name;
+    }
 
-        ObjParserResult result;
+    template <class Value, class Index>
+    void ObjResultBuilder<Value, Index>::on_smoothing_group(std::span<const Token> args)
+    {
+        _error = _add_smoothing_group(_result.smoothing_groups, std::size(_result.data.faces), args);
+    }
 
-        std::vector<Token> tokens;
-        tokens.reserve(64);
-        for (auto lexer_position = data; lexer_position != data + size;)
+
+    template <class Value, class Index>
+    void SoaResultBuilder<Value, Index>::on_vertex(const Vertex<Value>& v)
+    {
+        _result.data.x.push_back(v.x);
+        _result.data.y.push_back(v.y);
+        _result.data.z.push_back(v.z);
+    }
+
+    template <class Value, class Index>
+    void SoaResultBuilder<Value, Index>::on_normal(const Normal<Value>& vn)
+    {
+        _result.data.nx.push_back(vn.x);
+        _result.data.ny.push_back(vn.y);
+        _result.data.nz.push_back(vn.z);
+    }
+
+    template <class Value, class Index>
+    void SoaResultBuilder<Value, Index>::on_texcoord(const Texcoord<Value>& vt)
+    {
+        _result.data.uv.push_back(vt.u);
+        _result.data.uv.push_back(vt.v);
+    }
+
+    template <class Value, class Index>
+    void SoaResultBuilder<Value, Index>::on_face(const Face<Index>& f)
+    {
+        const auto recorded = (_polygons == _RecordedPolygons::all);
+        if (!_fits_face(_result.polygons, 3, std::size(_result.data.v_indices) / 3, recorded))
         {
-            // extract tokens from the next line
-            lexer_position = lex_until_linefeed(lexer_position, tokens);
-            if (std::empty(tokens))
-                continue;
+            _error = _pec::index_out_of_range;
+            return;
+        }
 
-            const auto& tag = tokens[0];
-            if (const auto it = std::find_if(std::cbegin(tag_fun_pairs), std::cend(tag_fun_pairs),
-                    [&](const auto& x) { return x.first == tag; });
-                it != std::cend(tag_fun_pairs))
-            {
-                const auto args = std::span{ tokens }.last(std::size(tokens) - 1);
-                std::invoke((*it).second, args, result);
-            }
-            else
-            {
-                if (std::none_of(std::cbegin(ignored_keywords), std::cend(ignored_keywords),
-                        [&](const auto& x) { return x == tag; }))
-                    throw ParserError{ ParserErrorCode::unknown_tag };
-            }
-            tokens.clear();
+        if (recorded)
+            _record_polygon<Index>(_result.polygons, f.triplets, std::size(_result.data.v_indices) / 3);
+        _push_face(f);
+    }
+
+    template <class Value, class Index>
+    void SoaResultBuilder<Value, Index>::on_polygon(std::span<const Triplet<Index>> triplets)
+    {
+        const auto recorded = (_polygons != _RecordedPolygons::none);
+        if (!_fits_face(_result.polygons, std::size(triplets), std::size(_result.data.v_indices) / 3, recorded))
+        {
+            _error = _pec::index_out_of_range;
+            return;
         }
-        return result;
+
+        if (recorded)
+            _record_polygon(_result.polygons, triplets, std::size(_result.data.v_indices) / 3);
+        for (std::size_t i = 1; i + 1 < std::size(triplets); ++i) // fan, fixed later if needed
+            _push_face({ { triplets[0], triplets[i], triplets[i + 1] } });
     }
 
-    ObjParserResult parse_as_obj(
-        const std::string& s, const ObjParserConfig& c)
+    template <class Value, class Index>
+    void SoaResultBuilder<Value, Index>::_push_face(const Face<Index>& f)
     {
-        return _parse_as_obj_impl(std::data(s), std::size(s), c);
+        if (!std::empty(_result.objects)) // faces belong to the last declared object
+            _result.objects.back().faces.push_back(static_cast<Index>(std::size(_result.data.v_indices) / 3));
+        for (const auto& t : f.triplets)
+        {
+            _result.data.v_indices.push_back(t.v);
+            _result.data.vt_indices.push_back(t.vt);
+            _result.data.vn_indices.push_back(t.vn);
+        }
     }
 
-#if __cpp_lib_string_view
-    ObjParserResult parse_as_obj(
-        const std::string_view s, const ObjParserConfig& c)
+    template <class Value, class Index>
+    void SoaResultBuilder<Value, Index>::on_object(std::string_view name)
     {
-        return _parse_as_obj_impl(std::data(s), std::size(s), c);
+        if (!_add_object(_result.objects, name))
+            _error = _pec::duplicate_object_name;
     }
-#endif
 
-#if __cpp_lib_span
-    ObjParserResult parse_as_obj(
-        const std::span<const char> s, const ObjParserConfig& c)
+    template <class Value, class Index>
+    void SoaResultBuilder<Value, Index>::on_smoothing_group(std::span<const Token> args)
     {
-        assert(s.back() == '\0'); // the buffer must be null-terminated like C strings
-        return _parse_as_obj_impl(std::data(s), std::size(s), c);
+        _error = _add_smoothing_group(_result.smoothing_groups, std::size(_result.data.v_indices) / 3, args);
+    }
+
+
+    // number of stored elements of each kind
+    template <class Value, class Index>
+    [[nodiscard]] StatementCounts _data_counts(const MeshData<Value, Index>& d) noexcept
+    {
+        return { .v = std::size(d.v), .vn = std::size(d.vn), .vt = std::size(d.vt), .f = std::size(d.faces) };
+    }
+
+    template <class Value, class Index>
+    [[nodiscard]] StatementCounts _data_counts(const SoaMeshData<Value, Index>& d) noexcept
+    {
+        return { .v = std::size(d.x), .vn = std::size(d.nx), .vt = std::size(d.uv) / 2, .f = std::size(d.v_indices) / 3 };
+    }
+
+    template <class Value, class Index>
+    void _reserve_data(MeshData<Value, Index>& d, const StatementCounts& n)
+    {
+        d.v.reserve(n.v);
+        d.vn.reserve(n.vn);
+        d.vt.reserve(n.vt);
+        d.faces.reserve(n.f);
+    }
+
+    template <class Value, class Index>
+    void _reserve_data(SoaMeshData<Value, Index>& d, const StatementCounts& n)
+    {
+        for (auto c : { &d.x, &d.y, &d.z })
+            c->reserve(n.v);
+        for (auto c : { &d.nx, &d.ny, &d.nz })
+            c->reserve(n.vn);
+        d.uv.reserve(2 * n.vt);
+        for (auto c : { &d.v_indices, &d.vt_indices, &d.vn_indices })
+            c->reserve(3 * n.f);
+    }
+
+    // move the elements of src at the end of dst
+    template <class Container>
+    void _append(Container& dst, Container& src)
+    {
+        dst.insert(std::end(dst), std::make_move_iterator(std::begin(src)), std::make_move_iterator(std::end(src)));
+    }
+
+    template <class Value, class Index>
+    void _append_data(MeshData<Value, Index>& dst, MeshData<Value, Index>& src)
+    {
+        _append(dst.v, src.v);
+        _append(dst.vn, src.vn);
+        _append(dst.vt, src.vt);
+        _append(dst.faces, src.faces);
+    }
+
+    template <class Value, class Index>
+    void _append_data(SoaMeshData<Value, Index>& dst, SoaMeshData<Value, Index>& src)
+    {
+        _append(dst.x, src.x);
+        _append(dst.y, src.y);
+        _append(dst.z, src.z);
+        _append(dst.nx, src.nx);
+        _append(dst.ny, src.ny);
+        _append(dst.nz, src.nz);
+        _append(dst.uv, src.uv);
+        _append(dst.v_indices, src.v_indices);
+        _append(dst.vt_indices, src.vt_indices);
+        _append(dst.vn_indices, src.vn_indices);
+    }
+
+    // characters that can follow an argument in the fast paths,
+    // anything else is left to the generic path, including comments
+    [[nodiscard]] constexpr bool _is_fast_separator(const char c) noexcept
+    {
+        return c == ' ' || c == '\n';
+    }
+
+    // skip the spaces and the line feed at the end of a line,
+    // returns the start of the next line or nullptr if the line continues
+    [[nodiscard]] inline const char* _end_fast_line(const char* p, const char* last) noexcept
+    {
+        while (p != last && *p == ' ')
+            ++p;
+        if (p == last)
+            return p;
+        return (*p == '\n') ? p + 1 : nullptr;
+    }
+
+    // parse up to N values until the end of the line,
+    // returns the start of the next line or nullptr if the line needs the generic path
+    template <std::size_t N, class Value>
+    [[nodiscard]] const char* _parse_values_fast(
+        const char* p, const char* last, Value (&values)[N], std::size_t& count) noexcept
+    {
+        for (count = 0;; ++count)
+        {
+            while (p != last && *p == ' ')
+                ++p;
+            if (const auto next = _end_fast_line(p, last); next != nullptr)
+                return next;
+            if (count == N)
+                return nullptr;
+
+            const auto r = parse_float(p, last, values[count]);
+            if (r.ec != std::errc{} || (r.ptr != last && !_is_fast_separator(*r.ptr)))
+                return nullptr;
+            p = r.ptr;
+        }
+    }
+
+    // parse an optional index, with relative ones resolved to absolute;
+    // returns nullptr on errors
+    template <class Index>
+    [[nodiscard]] const char* _parse_index_fast(
+        const char* p, const char* last, Index& i, _IndexResolver& r, _IndexResolver::Kind k)
+    {
+        i = 0;
+        if (p != last && *p == '-')
+        {
+            std::uint64_t distance = 0;
+            const auto    d        = std::from_chars(p + 1, last, distance);
+            if (d.ec != std::errc{})
+                return nullptr;
+            const auto a = r.resolve(k, distance);
+            if (distance == 0 || a == 0 || a > std::numeric_limits<Index>::max())
+                return nullptr;
+            i = static_cast<Index>(a);
+            return d.ptr;
+        }
+        if (p == last || !_is_digit(*p))
+            return p; // missing
+        const auto d = std::from_chars(p, last, i);
+        return (d.ec == std::errc{}) ? d.ptr : nullptr;
     }
-#endif
 
+    // parse at least three and up to N v/vt/vn triplets of a face until the end of the line,
+    // returns the start of the next line or nullptr if the line needs the generic path
+    template <std::size_t N, class Index>
+    [[nodiscard]] const char* _parse_face_fast(
+        const char* p, const char* last, Triplet<Index> (&triplets)[N], std::size_t& count, _IndexResolver& r)
+    {
+        for (count = 0;; ++count)
+        {
+            while (p != last && *p == ' ')
+                ++p;
+            if (const auto next = _end_fast_line(p, last); next != nullptr)
+                return (count >= 3) ? next : nullptr;
+            if (count == N)
+                return nullptr;
 
-#else /*^^^ exceptions ^^^/vvv error codes vvv*/
+            auto& t = triplets[count];
+            p       = _parse_index_fast(p, last, t.v, r, &StatementCounts::v);
+            if (p == nullptr || t.v == 0 || p == last || *p != '/')
+                return nullptr;
+            p = _parse_index_fast(p + 1, last, t.vt, r, &StatementCounts::vt);
+            if (p == nullptr || p == last || *p != '/')
+                return nullptr;
+            p = _parse_index_fast(p + 1, last, t.vn, r, &StatementCounts::vn);
+            if (p == nullptr || (p != last && !_is_fast_separator(*p)))
+                return nullptr;
+        }
+    }
 
-    // construct report for line wide errors
-    [[nodiscard]] parser_error_report _make_line_error(const _line& l, _pec ec) noexcept
+    // parse a 'v', 'vn', 'vt' or 'f' line in a single pass over its characters,
+    // without materializing tokens; returns the start of the next line
+    // or nullptr if the line must go through the generic path, that also reports errors
+    template <class Visitor>
+    [[nodiscard]] const char* _parse_geometry_line(
+        const char* p, const char* last, Visitor& visitor, _IndexResolver& r)
     {
-        return { l.row, 0, 0, ec };
+        using Value = typename Visitor::value_type;
+        using Index = typename Visitor::index_type;
+
+        if (last - p < 4)
+            return nullptr;
+
+        std::size_t count = 0;
+        if (p[0] == 'v' && p[1] == ' ')
+        {
+            Value v[4] = { 0, 0, 0, Defaults<Value>::vertex_weight };
+            if (const auto next = _parse_values_fast(p + 2, last, v, count); next != nullptr && count >= 3)
+            {
+                visitor.on_vertex({ v[0], v[1], v[2], v[3] });
+                r.add(&StatementCounts::v);
+                return next;
+            }
+        }
+        else if (p[0] == 'v' && p[1] == 'n' && p[2] == ' ')
+        {
+            Value vn[3] = { 0, 0, 0 };
+            if (const auto next = _parse_values_fast(p + 3, last, vn, count); next != nullptr && count == 3)
+            {
+                visitor.on_normal({ vn[0], vn[1], vn[2] });
+                r.add(&StatementCounts::vn);
+                return next;
+            }
+        }
+        else if (p[0] == 'v' && p[1] == 't' && p[2] == ' ')
+        {
+            Value vt[3] = {
+                Defaults<Value>::texcoord_value,
+                Defaults<Value>::texcoord_value,
+                Defaults<Value>::texcoord_value
+            };
+            if (const auto next = _parse_values_fast(p + 3, last, vt, count); next != nullptr && count >= 1)
+            {
+                visitor.on_texcoord({ vt[0], vt[1], vt[2] });
+                r.add(&StatementCounts::vt);
+                return next;
+            }
+        }
+        else if (p[0] == 'f' && p[1] == ' ')
+        {
+            Triplet<Index> t[8]; // larger polygons are rare enough for the generic path
+            if (const auto next = _parse_face_fast(p + 2, last, t, count, r); next != nullptr)
+            {
+                if (count == 3)
+                    visitor.on_face({ { t[0], t[1], t[2] } });
+                else
+                    visitor.on_polygon(std::span{ t, count });
+                return next;
+            }
+        }
+        return nullptr;
     }
 
-    // construct report for token related errors
-    [[nodiscard]] parser_error_report _make_token_error(const _token& t, _pec ec) noexcept
+    // declare an element with default values in place of an invalid statement,
+    // so that the indices of the following faces still refer to the elements of the source
+    template <class Visitor>
+    void _declare_default_element(_ObjTag tag, Visitor& visitor, _IndexResolver& r)
     {
-        return { t.row, t.col, 0, ec };
+        using Value = typename Visitor::value_type;
+
+        constexpr auto w  = Defaults<Value>::vertex_weight;
+        constexpr auto tc = Defaults<Value>::texcoord_value;
+        switch (tag)
+        {
+            case _ObjTag::v:
+                visitor.on_vertex({ 0, 0, 0, w });
+                r.add(&StatementCounts::v);
+                break;
+            case _ObjTag::vn:
+                visitor.on_normal({ 0, 0, 0 });
+                r.add(&StatementCounts::vn);
+                break;
+            case _ObjTag::vt:
+                visitor.on_texcoord({ tc, tc, tc });
+                r.add(&StatementCounts::vt);
+                break;
+            default: break;
+        }
     }
 
-    // construct report for token related errors
-    [[nodiscard]] parser_error_report
-    _make_token_error(const _line& l, const _token& t, _pec ec) noexcept
+    // extract the tokens of the line that starts at pos, returns the start of the next line;
+    // the lexer stops at a string terminator as at the end of input, so one found before
+    // the end of the source is an invalid character, and the rest of its line is skipped
+    template <class Tokens>
+    [[nodiscard]] const char* _lex_line(LineLexer& lexer, const char* pos, const char* last, Tokens& tokens, const char*& invalid)
     {
-        const auto col = static_cast<size_t>(std::distance(l.begin, t.begin));
-        return parser_error_report{ l.row, col, 0, ec };
+        auto next = lexer.try_lex_until_linefeed(pos, tokens, invalid);
+        if (next != last && *next == '\0' && (next == pos || next[-1] != '\n'))
+        {
+            if (invalid == nullptr)
+                invalid = next;
+            next = std::find(next, last, '\n');
+            if (next != last)
+                ++next;
+        }
+        return next;
     }
 
-#endif /*^^^ error codes ^^^*/
+    // parse a sequence of whole lines in the range [first, last),
+    // stops at the first error unless the log is recovering
+    template <class Visitor>
+    void _parse_lines(const char* first, const char* last, Visitor& visitor, _IndexResolver& r, _ErrorLog& log,
+        LineLexer& lexer, std::pmr::vector<Token>& tokens, std::pmr::memory_resource* scratch)
+    {
+        lexer.reset(last);
+        for (auto lexer_position = first; lexer_position != last;)
+        {
+            const auto line = lexer_position;
+            if (const auto next = _parse_geometry_line(line, last, visitor, r); next != nullptr)
+            {
+                lexer_position = next;
+                if (const auto rejected = visitor.take_error(); rejected && !log.report(line, *rejected))
+                    return;
+                continue;
+            }
+
+            // extract tokens from the next line
+            tokens.clear();
+            const char* invalid = nullptr;
+            lexer_position      = _lex_line(lexer, line, last, tokens, invalid);
+            if (invalid != nullptr)
+            {
+                if (!log.report(invalid, _pec::invalid_character))
+                    return;
+                continue;
+            }
+            if (std::empty(tokens))
+                continue;
+
+            _Status    status;
+            const auto args = std::span{ tokens }.last(std::size(tokens) - 1);
+            const auto tag  = static_cast<_ObjTag>(_obj_tags.find(tokens[0]));
+            switch (tag)
+            {
+                case _ObjTag::v:
+                    if (status = handle_v_line(tokens[0], args, visitor); !status)
+                        r.add(&StatementCounts::v);
+                    break;
+                case _ObjTag::vn:
+                    if (status = handle_vn_line(tokens[0], args, visitor); !status)
+                        r.add(&StatementCounts::vn);
+                    break;
+                case _ObjTag::vt:
+                    if (status = handle_vt_line(tokens[0], args, visitor); !status)
+                        r.add(&StatementCounts::vt);
+                    break;
+                case _ObjTag::f: status = handle_f_line(tokens[0], args, visitor, r, scratch); break;
+                case _ObjTag::o: status = handle_o_line(tokens[0], args, visitor); break;
+                case _ObjTag::g: handle_g_line(args, visitor); break;
+                case _ObjTag::s: handle_s_line(args, visitor); break;
+                case _ObjTag::mtllib: handle_mtllib_line(args, visitor); break;
+                case _ObjTag::usemtl: handle_usemtl_line(args, visitor); break;
+                case _ObjTag::call:
+                case _ObjTag::csh: break;
+                default: status = _StatementError{ _pec::unknown_tag, std::data(tokens[0]) }; break;
+            }
+
+            if (const auto rejected = visitor.take_error(); status)
+            {
+                if (!log.report(status->where, status->ec))
+                    return;
+                _declare_default_element(tag, visitor, r);
+            }
+            else if (rejected)
+            {
+                if (!log.report(std::data(tokens[0]), *rejected))
+                    return;
+            }
+            else if (tag == _ObjTag::o)
+                log.add_object(std::data(tokens[0]));
+        }
+    }
+
+    template <class Visitor>
+    void _parse_lines(const char* first, const char* last, Visitor& visitor, _IndexResolver& r, _ErrorLog& log,
+        std::pmr::memory_resource* scratch = std::pmr::get_default_resource())
+    {
+        // tokens of a line are collected on the stack, unless the line is unusually long
+        alignas(Token) std::byte            storage[64 * sizeof(Token)];
+        std::pmr::monotonic_buffer_resource arena{ storage, sizeof(storage), scratch };
+        LineLexer                           lexer;
+        std::pmr::vector<Token>             tokens{ &arena };
+        tokens.reserve(64);
+        _parse_lines(first, last, visitor, r, log, lexer, tokens, scratch);
+    }
+
+    // position of the 'f' statement in [first, last) that produces the given triangle, counting the triangles
+    // of the statements parsed without errors; returns first if there are fewer triangles
+    [[nodiscard]] const char* _find_face_statement(const char* source, const char* first, const char* last,
+        std::size_t triangle, std::span<const ParserErrorReport> errors)
+    {
+        auto error = std::find_if(std::cbegin(errors), std::cend(errors),
+            [&](const auto& e) { return source + e.char_index() >= first; });
+
+        LineLexer          lexer;
+        std::vector<Token> tokens;
+        lexer.reset(last);
+        for (auto line = first; line != last;)
+        {
+            tokens.clear();
+            const char* invalid = nullptr;
+            const auto  next    = _lex_line(lexer, line, last, tokens, invalid);
+
+            auto rejected = false; // statements with an error don't produce faces
+            for (; error != std::cend(errors) && source + error->char_index() < next; ++error)
+                rejected = true;
+            if (!rejected && nullptr == invalid && std::size(tokens) > 3 && tokens[0] == "f")
+            {
+                if (triangle < std::size(tokens) - 3)
+                    return std::data(tokens[0]);
+                triangle -= std::size(tokens) - 3;
+            }
+            line = next;
+        }
+        return first;
+    }
+
+    // split the source text in chunks of whole lines,
+    // returns the boundaries of the chunks as [b0, b1, ..., bn]
+    [[nodiscard]] std::vector<const char*> _split_at_linefeeds(
+        const char* data, const std::size_t size, const std::size_t max_chunks, const std::size_t min_chunk_size)
+    {
+        const auto chunks = std::clamp<std::size_t>(size / std::max<std::size_t>(min_chunk_size, 1), 1, max_chunks);
+        const auto end    = data + size;
+
+        std::vector<const char*> bounds{ data };
+        for (std::size_t i = 1; i < chunks; ++i)
+        {
+            const auto guess = std::max(bounds.back(), data + i * (size / chunks));
+            const auto lf    = std::find(guess, end, '\n');
+            if (lf == end)
+                break;
+            bounds.push_back(lf + 1);
+        }
+        bounds.push_back(end);
+        return bounds;
+    }
+
+    // allocate storage for the statements of the range [first, last)
+    template <class Result>
+    void _reserve_storage(Result& r, const char* first, const char* last, const ObjParserConfig& c)
+    {
+        if (c.prescan)
+        {
+            const auto counts = count_statements(first, static_cast<std::size_t>(last - first));
+            _reserve_data(r.data, counts);
+            r.objects.reserve(counts.o + 1); // room for the continuation of the previous chunk
+        }
+        else
+        {
+            _reserve_data(r.data, { .v = c.expected_vertex_count, .f = c.expected_triangle_count });
+            r.objects.reserve(c.expected_object_count);
+        }
+    }
+
+    // memory resource set by the configuration, or the default one
+    template <class Config>
+    [[nodiscard]] std::pmr::memory_resource* _memory_resource(const Config& c) noexcept
+    {
+        return (nullptr != c.memory_resource) ? c.memory_resource : std::pmr::get_default_resource();
+    }
+
+    // empty containers that allocate from the memory resource m; members are built in place
+    // since assigning a container keeps its allocator, so the resource can't be replaced later
+    template <class Index>
+    [[nodiscard]] PolygonData<Index> _make_empty(std::type_identity<PolygonData<Index>>, std::pmr::memory_resource* m)
+    {
+        using D = PolygonData<Index>;
+        return { decltype(D::offsets)(m), decltype(D::triplets)(m), decltype(D::faces)(m) };
+    }
+
+    template <class Value, class Index>
+    [[nodiscard]] MeshData<Value, Index> _make_empty(
+        std::type_identity<MeshData<Value, Index>>, std::pmr::memory_resource* m)
+    {
+        using D = MeshData<Value, Index>;
+        return { decltype(D::v)(m), decltype(D::vn)(m), decltype(D::vt)(m), decltype(D::faces)(m) };
+    }
+
+    template <class Value, class Index>
+    [[nodiscard]] SoaMeshData<Value, Index> _make_empty(
+        std::type_identity<SoaMeshData<Value, Index>>, std::pmr::memory_resource* m)
+    {
+        using D = SoaMeshData<Value, Index>;
+        return { decltype(D::x)(m), decltype(D::y)(m), decltype(D::z)(m), decltype(D::nx)(m), decltype(D::ny)(m),
+            decltype(D::nz)(m), decltype(D::uv)(m), decltype(D::v_indices)(m), decltype(D::vt_indices)(m),
+            decltype(D::vn_indices)(m) };
+    }
+
+    template <class Result>
+    [[nodiscard]] Result _make_result(std::pmr::memory_resource* m)
+    {
+        return { .data             = _make_empty(std::type_identity<decltype(Result::data)>{}, m),
+            .objects               = decltype(Result::objects)(m),
+            .polygons              = _make_empty(std::type_identity<decltype(Result::polygons)>{}, m),
+            .smoothing_groups      = decltype(Result::smoothing_groups)(m) };
+    }
+
+    // content parsed from a source text, along with its errors in source order
+    template <class Result>
+    struct _Parsed
+    {
+        Result                         result;
+        std::vector<ParserErrorReport> errors;
+    };
+
+    // result of a chunk of the source text, parsed by a thread of its own
+    template <class Result>
+    struct _ParsedChunk
+    {
+        Result                         result;
+        std::vector<ParserErrorReport> errors;
+        std::vector<const char*>       objects; // 'o' statements of the objects added to the result
+    };
+
+    // parse a chunk of lines that doesn't start at the beginning of the source text
+    template <class Result, class Builder>
+    [[nodiscard]] _ParsedChunk<Result> _parse_chunk(const char* source, const char* first, const char* last,
+        const ObjParserConfig& c, bool recover, std::function<StatementCounts()> preceding)
+    {
+        _ParsedChunk<Result> parsed; // the memory resource of the result may not be safe to share among threads
+        auto&                result = parsed.result;
+        if (c.prescan) // expected counts refer to the whole source text
+            _reserve_storage(result, first, last, c);
+
+        // faces that precede the first 'o' statement of the chunk are collected
+        // by an unnamed placeholder and handed to the last object of the previous chunks
+        result.objects.push_back({});
+
+        StatementCounts declared;
+        _IndexResolver  resolver{ declared, std::move(preceding) };
+        _ErrorLog       log{ source, recover }; // lines are counted from the start of the source
+        log.track_objects(parsed.objects);
+
+        Builder builder{ result, c };
+        _parse_lines(first, last, builder, resolver, log);
+        parsed.errors = std::move(log.reports());
+        return parsed;
+    }
+
+    // report the objects of the chunks named as an object of the previous ones, at their 'o' statement
+    template <class Result>
+    void _report_duplicate_objects(const Result& first, const std::vector<_ParsedChunk<Result>>& chunks, _ErrorLog& log)
+    {
+        std::unordered_set<std::string_view> names;
+        for (const auto& o : first.objects)
+            names.insert(o.name);
+        for (const auto& p : chunks) // the first object of a chunk is the unnamed placeholder
+            for (std::size_t i = 1; i < std::size(p.result.objects); ++i)
+                if (!names.insert(p.result.objects[i].name).second)
+                    log.report(p.objects[i - 1], _pec::duplicate_object_name);
+    }
+
+    // append the result of the chunk [first, last) to the accumulated result of the previous ones,
+    // objects with the name of a previous one are merged into the last object
+    template <template <class, class> class Result, class Value, class Index>
+    void _merge_chunk(Result<Value, Index>& dst, _ParsedChunk<Result<Value, Index>>& chunk, const char* first,
+        const char* last, _ErrorLog& log)
+    {
+        auto&      src            = chunk.result;
+        const auto face_offset    = _data_counts(dst.data).f;
+        const auto triplet_offset = std::size(dst.polygons.triplets);
+        if (!_fits_index<Index>(face_offset, _data_counts(src.data).f) ||
+            !_fits_index<Index>(triplet_offset, std::size(src.polygons.triplets)))
+        {
+            // first triangle past the largest index, or first one of a polygon whose triplets are past it
+            constexpr std::size_t max      = std::numeric_limits<Index>::max();
+
+            const auto    faces    = _data_counts(src.data).f;
+            auto          triangle = _fits_index<Index>(face_offset, faces) ? faces : max - face_offset + 1;
+            for (std::size_t i = 0; i < std::size(src.polygons.offsets); ++i)
+                if (triplet_offset + src.polygons.offsets[i] > max)
+                {
+                    triangle = std::min<std::size_t>(triangle, src.polygons.faces[i]);
+                    break;
+                }
+            log.report(_find_face_statement(log.source(), first, last, triangle, chunk.errors), _pec::index_out_of_range);
+            return;
+        }
+
+        _append_data(dst.data, src.data);
+
+        for (const auto o : src.polygons.offsets)
+            dst.polygons.offsets.push_back(static_cast<Index>(o + triplet_offset));
+        for (const auto f : src.polygons.faces)
+            dst.polygons.faces.push_back(static_cast<Index>(f + face_offset));
+        _append(dst.polygons.triplets, src.polygons.triplets);
+
+        // faces before the first 's' statement of the chunk continue the last run of the previous chunks
+        for (const auto& g : src.smoothing_groups)
+            _push_smoothing_group(dst.smoothing_groups, g.first_face + face_offset, g.id);
+
+        // the first object is the unnamed placeholder, that continues the last object of the previous chunks;
+        // duplicate names have been reported by _report_duplicate_objects()
+        assert(std::empty(src.objects.front().name));
+        for (auto o = std::begin(src.objects); o != std::end(src.objects); ++o)
+        {
+            if (o != std::begin(src.objects) && std::none_of(std::cbegin(dst.objects), std::cend(dst.objects),
+                                                    [&](const auto& x) { return x.name == o->name; }))
+                dst.objects.push_back(_make_object(dst.objects, o->name));
+
+            if (!std::empty(dst.objects))
+                for (const auto f : o->faces)
+                    dst.objects.back().faces.push_back(static_cast<Index>(f + face_offset));
+        }
+    }
+
+    // errors of the chunks and of their merge, in source order as the serial parser reports them;
+    // the serial parser stops at the first one unless errors are recovered
+    void _sort_errors(std::vector<ParserErrorReport>& errors, bool recover)
+    {
+        std::stable_sort(std::begin(errors), std::end(errors),
+            [](const auto& a, const auto& b) { return a.char_index() < b.char_index(); });
+        if (!recover && std::size(errors) > 1)
+            errors.erase(std::begin(errors) + 1, std::end(errors));
+    }
+
+    // parse the chunks of a source text into an empty result, whose storage is reused
+    template <class Result, class Builder>
+    void _parse_as_obj_parallel_into(Result& result, std::vector<ParserErrorReport>& errors,
+        const std::vector<const char*>& bounds, const ObjParserConfig& c, bool recover)
+    {
+        assert(std::size(bounds) > 2);
+
+        // elements declared before each chunk, counted only when a chunk has relative indices;
+        // the first one to need them counts the elements of every chunk at once, in parallel
+        std::once_flag               counted;
+        std::vector<StatementCounts> declared;
+        const auto                   count_declared = [&] {
+            std::vector<std::size_t> chunk(std::size(bounds));
+            std::iota(std::begin(chunk), std::end(chunk), std::size_t{ 0 });
+            declared = _map_ranges(chunk, [&](std::size_t i, std::size_t) { return _count_elements(bounds[i], bounds[i + 1]); });
+            std::exclusive_scan(std::cbegin(declared), std::cend(declared), std::begin(declared), StatementCounts{},
+                [](StatementCounts a, const StatementCounts& b) {
+                    a.v += b.v;
+                    a.vn += b.vn;
+                    a.vt += b.vt;
+                    return a;
+                });
+        };
+
+        // the first chunk is parsed by the calling thread, the only one allowed to use the memory resource
+        std::vector<_ParsedChunk<Result>>  chunks(std::size(bounds) - 2);
+        std::vector<std::function<void()>> tasks;
+        tasks.reserve(std::size(bounds) - 1);
+        tasks.push_back([&] {
+            if (c.prescan)
+                _reserve_storage(result, bounds[0], bounds[1], c);
+
+            StatementCounts counts;
+            _IndexResolver  resolver{ counts };
+            _ErrorLog       log{ bounds[0], recover };
+
+            Builder builder{ result, c };
+            _parse_lines(bounds[0], bounds[1], builder, resolver, log, _memory_resource(c));
+            errors = std::move(log.reports());
+        });
+        for (std::size_t i = 1; i < std::size(bounds) - 1; ++i)
+        {
+            auto preceding = [&, i] {
+                std::call_once(counted, count_declared);
+                return declared[i];
+            };
+            tasks.push_back([&, i, preceding] {
+                chunks[i - 1] = _parse_chunk<Result, Builder>(bounds[0], bounds[i], bounds[i + 1], c, recover, preceding);
+            });
+        }
+        if (nullptr != c.executor)
+            c.executor->run_all(tasks);
+        else
+            _run_all_async(tasks);
+
+        // errors found while merging are located like the ones of the chunks
+        _ErrorLog merged{ bounds[0], true };
+        _report_duplicate_objects(result, chunks, merged);
+
+        auto total = _data_counts(result.data);
+        for (auto& p : chunks)
+        {
+            _append(errors, p.errors);
+
+            const auto n = _data_counts(p.result.data);
+            total.v += n.v;
+            total.vn += n.vn;
+            total.vt += n.vt;
+            total.f += n.f;
+        }
+        if (recover || (std::empty(errors) && merged.empty()))
+        {
+            _reserve_data(result.data, total);
+            for (std::size_t i = 0; i < std::size(chunks); ++i)
+                _merge_chunk(result, chunks[i], bounds[i + 1], bounds[i + 2], merged);
+        }
+        _append(errors, merged.reports());
+        _sort_errors(errors, recover);
+    }
+
+    // vertex of a polygon, projected on a plane
+    struct _Point2
+    {
+        double x, y;
+    };
+
+    // twice the signed area of the triangle (a, b, c), positive if counter-clockwise
+    [[nodiscard]] constexpr double _cross(const _Point2& a, const _Point2& b, const _Point2& c) noexcept
+    {
+        return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    }
+
+    // check if the polygon turns the same way at every vertex, so that a fan covers it exactly
+    [[nodiscard]] bool _is_convex(std::span<const _Point2> p) noexcept
+    {
+        bool left = false, right = false;
+        for (std::size_t i = 0, n = std::size(p); i < n; ++i)
+        {
+            const auto c = _cross(p[i], p[(i + 1) % n], p[(i + 2) % n]);
+            left |= (c > 0);
+            right |= (c < 0);
+        }
+        return !(left && right);
+    }
+
+    // split a simple polygon in n - 2 triangles of vertex positions by ear clipping;
+    // degenerate and self-intersecting polygons still produce n - 2 triangles
+    void _ear_clip(std::span<const _Point2> p, std::vector<std::array<std::size_t, 3>>& triangles)
+    {
+        std::vector<std::size_t> ring(std::size(p));
+        std::iota(std::begin(ring), std::end(ring), std::size_t{ 0 });
+
+        double area = 0; // orientation of the polygon
+        for (std::size_t i = 0, n = std::size(p); i < n; ++i)
+            area += p[i].x * p[(i + 1) % n].y - p[(i + 1) % n].x * p[i].y;
+        const double sign = (area < 0) ? -1 : 1;
+
+        const auto is_ear = [&](std::size_t prev, std::size_t curr, std::size_t next) {
+            const auto &a = p[ring[prev]], &b = p[ring[curr]], &c = p[ring[next]];
+            if (sign * _cross(a, b, c) <= 0) // reflex or degenerate corner
+                return false;
+            for (const auto k : ring) // no other vertex can lie inside the ear
+                if (k != ring[prev] && k != ring[curr] && k != ring[next] &&
+                    sign * _cross(a, b, p[k]) > 0 && sign * _cross(b, c, p[k]) > 0 && sign * _cross(c, a, p[k]) > 0)
+                    return false;
+            return true;
+        };
+
+        for (std::size_t curr = 0, misses = 0; std::size(ring) > 3;)
+        {
+            const auto n    = std::size(ring);
+            const auto prev = (curr + n - 1) % n;
+            const auto next = (curr + 1) % n;
+            if (misses < n && !is_ear(prev, curr, next))
+            {
+                curr = next;
+                ++misses;
+                continue;
+            }
+            // after a full turn without ears the polygon isn't simple, clip anyway to make progress
+            triangles.push_back({ ring[prev], ring[curr], ring[next] });
+            ring.erase(std::next(std::begin(ring), static_cast<std::ptrdiff_t>(curr)));
+            curr   = (curr == 0) ? 0 : curr - 1;
+            misses = 0;
+        }
+        triangles.push_back({ ring[0], ring[1], ring[2] });
+    }
+
+    // position of a vertex referenced by a face, if declared in the source
+    template <class Value, class Index>
+    [[nodiscard]] std::optional<std::array<double, 3>> _position(const MeshData<Value, Index>& d, Index v) noexcept
+    {
+        if (v == 0 || v > std::size(d.v))
+            return std::nullopt;
+        const auto& p = d.v[static_cast<std::size_t>(v) - 1];
+        return std::array<double, 3>{ p.x, p.y, p.z };
+    }
+
+    template <class Value, class Index>
+    [[nodiscard]] std::optional<std::array<double, 3>> _position(const SoaMeshData<Value, Index>& d, Index v) noexcept
+    {
+        if (v == 0 || v > std::size(d.x))
+            return std::nullopt;
+        const auto i = static_cast<std::size_t>(v) - 1;
+        return std::array<double, 3>{ d.x[i], d.y[i], d.z[i] };
+    }
+
+    template <class Value, class Index>
+    void _set_face(MeshData<Value, Index>& d, std::size_t i, const Face<Index>& f) noexcept
+    {
+        d.faces[i] = f;
+    }
+
+    template <class Value, class Index>
+    void _set_face(SoaMeshData<Value, Index>& d, std::size_t i, const Face<Index>& f) noexcept
+    {
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+            d.v_indices[3 * i + k]  = f.triplets[k].v;
+            d.vt_indices[3 * i + k] = f.triplets[k].vt;
+            d.vn_indices[3 * i + k] = f.triplets[k].vn;
+        }
+    }
+
+    // project the vertices of a polygon on the plane orthogonal to its normal,
+    // returns false if some vertex is missing or the polygon has no area
+    template <class Data, class Index>
+    [[nodiscard]] bool _project_polygon(const Data& d, std::span<const Triplet<Index>> polygon, std::vector<_Point2>& points)
+    {
+        std::vector<std::array<double, 3>> positions;
+        positions.reserve(std::size(polygon));
+        for (const auto& t : polygon)
+        {
+            const auto p = _position(d, t.v);
+            if (!p)
+                return false;
+            positions.push_back(*p);
+        }
+
+        std::array<double, 3> normal{}; // Newell's method, robust for non-planar polygons
+        for (std::size_t i = 0, n = std::size(positions); i < n; ++i)
+        {
+            const auto &a = positions[i], &b = positions[(i + 1) % n];
+            normal[0] += (a[1] - b[1]) * (a[2] + b[2]);
+            normal[1] += (a[2] - b[2]) * (a[0] + b[0]);
+            normal[2] += (a[0] - b[0]) * (a[1] + b[1]);
+        }
+
+        // drop the dominant axis of the normal, that keeps the largest projected area
+        const auto axis = static_cast<std::size_t>(std::distance(std::cbegin(normal),
+            std::max_element(std::cbegin(normal), std::cend(normal),
+                [](double a, double b) { return std::abs(a) < std::abs(b); })));
+        if (normal[axis] == 0)
+            return false;
+
+        points.clear();
+        for (const auto& p : positions)
+            points.push_back({ p[(axis + 1) % 3], p[(axis + 2) % 3] });
+        return true;
+    }
+
+    // replace the fans of concave polygons with an ear clipping triangulation;
+    // both produce the same number of triangles, so face positions don't change
+    template <class Result>
+    void _clip_concave_polygons(Result& r)
+    {
+        using Index = typename decltype(r.polygons.faces)::value_type;
+
+        const auto&                             polygons = r.polygons;
+        std::vector<_Point2>                    points;
+        std::vector<std::array<std::size_t, 3>> triangles;
+        for (std::size_t i = 0; i < std::size(polygons); ++i)
+        {
+            const auto polygon = std::span{ polygons.triplets }.subspan(
+                polygons.first(i), polygons.last(i) - polygons.first(i));
+            if (std::size(polygon) <= 3 || !_project_polygon<decltype(r.data), Index>(r.data, polygon, points) ||
+                _is_convex(points))
+                continue;
+
+            triangles.clear();
+            _ear_clip(points, triangles);
+            for (std::size_t k = 0; k < std::size(triangles); ++k)
+            {
+                const auto& t = triangles[k];
+                _set_face(r.data, static_cast<std::size_t>(polygons.faces[i]) + k,
+                    Face<Index>{ { polygon[t[0]], polygon[t[1]], polygon[t[2]] } });
+            }
+        }
+    }
+
+    // upper bounds of one-based indices, shifted so that a single unsigned comparison checks
+    // both ends of the range: v in [1, n] and the optional vt, vn in [0, n]
+    struct _IndexLimits
+    {
+        std::uint64_t v, vt, vn;
+    };
+
+    template <class Index>
+    [[nodiscard]] constexpr bool _is_out_of_range(Index i, std::uint64_t bias, std::uint64_t limit) noexcept
+    {
+        return static_cast<std::uint64_t>(i) - bias >= limit;
+    }
+
+    // position of the first face in [first, last) with an invalid index, or last
+    template <class Value, class Index>
+    [[nodiscard]] std::size_t _find_invalid_face(
+        const MeshData<Value, Index>& d, const _IndexLimits& l, std::size_t first, std::size_t last) noexcept
+    {
+        constexpr std::size_t block = 256; // checked without branches, then searched if needed
+        for (auto b = first; b < last; b += block)
+        {
+            const auto e       = std::min(last, b + block);
+            bool       invalid = false;
+            for (auto i = b; i < e; ++i)
+                for (const auto& t : d.faces[i].triplets)
+                    invalid |= _is_out_of_range(t.v, 1, l.v) | _is_out_of_range(t.vt, 0, l.vt) |
+                               _is_out_of_range(t.vn, 0, l.vn);
+            if (invalid)
+                for (auto i = b; i < e; ++i)
+                    for (const auto& t : d.faces[i].triplets)
+                        if (_is_out_of_range(t.v, 1, l.v) || _is_out_of_range(t.vt, 0, l.vt) ||
+                            _is_out_of_range(t.vn, 0, l.vn))
+                            return i;
+        }
+        return last;
+    }
+
+    template <class Value, class Index>
+    [[nodiscard]] std::size_t _find_invalid_face(
+        const SoaMeshData<Value, Index>& d, const _IndexLimits& l, std::size_t first, std::size_t last) noexcept
+    {
+        constexpr std::size_t block = 256;
+        for (auto b = 3 * first; b < 3 * last; b += block)
+        {
+            const auto e       = std::min(3 * last, b + block);
+            bool       invalid = false;
+            for (auto i = b; i < e; ++i)
+                invalid |= _is_out_of_range(d.v_indices[i], 1, l.v) | _is_out_of_range(d.vt_indices[i], 0, l.vt) |
+                           _is_out_of_range(d.vn_indices[i], 0, l.vn);
+            if (invalid)
+                for (auto i = b; i < e; ++i)
+                    if (_is_out_of_range(d.v_indices[i], 1, l.v) || _is_out_of_range(d.vt_indices[i], 0, l.vt) ||
+                        _is_out_of_range(d.vn_indices[i], 0, l.vn))
+                        return i / 3;
+        }
+        return last;
+    }
+
+    // position of the first face with an invalid index, if any
+    template <class Data>
+    [[nodiscard]] std::optional<std::size_t> _first_invalid_face(const Data& d, std::size_t threads)
+    {
+        const auto       n = _data_counts(d);
+        const _IndexLimits l{ n.v, n.vt + 1, n.vn + 1 };
+
+        const auto found = _map_ranges(n.f, threads, [&](std::size_t first, std::size_t last) {
+            const auto i = _find_invalid_face(d, l, first, last);
+            return (i != last) ? std::optional{ i } : std::nullopt;
+        });
+        for (const auto& i : found) // first in face order
+            if (i)
+                return i;
+        return std::nullopt;
+    }
+
+    // zero-based indices, where the missing ones wrap around to the largest value
+    template <class Index>
+    [[nodiscard]] constexpr Index _zero_based(Index i) noexcept
+    {
+        return static_cast<Index>(i - 1);
+    }
+
+    // convert the indices of all faces to zero-based, without checking them
+    template <class Value, class Index>
+    void _make_zero_based(MeshData<Value, Index>& d, std::size_t thread_count)
+    {
+        (void)_map_ranges(std::size(d.faces), thread_count, [&](std::size_t first, std::size_t last) {
+            for (auto i = first; i < last; ++i)
+                for (auto& t : d.faces[i].triplets)
+                    t = { _zero_based(t.v), _zero_based(t.vt), _zero_based(t.vn) };
+            return true;
+        });
+    }
+
+    template <class Value, class Index>
+    void _make_zero_based(SoaMeshData<Value, Index>& d, std::size_t thread_count)
+    {
+        (void)_map_ranges(std::size(d.v_indices), thread_count, [&](std::size_t first, std::size_t last) {
+            for (auto c : { &d.v_indices, &d.vt_indices, &d.vn_indices })
+                std::transform(std::begin(*c) + first, std::begin(*c) + last, std::begin(*c) + first,
+                    _zero_based<Index>);
+            return true;
+        });
+    }
+
+    template <class Value, class Index>
+    void _clear_data(MeshData<Value, Index>& d) noexcept
+    {
+        d.v.clear();
+        d.vn.clear();
+        d.vt.clear();
+        d.faces.clear();
+    }
+
+    template <class Value, class Index>
+    void _clear_data(SoaMeshData<Value, Index>& d) noexcept
+    {
+        for (auto c : { &d.x, &d.y, &d.z, &d.nx, &d.ny, &d.nz, &d.uv })
+            c->clear();
+        for (auto c : { &d.v_indices, &d.vt_indices, &d.vn_indices })
+            c->clear();
+    }
+
+    // empty the containers of a result, keeping their storage
+    template <class Result>
+    void _clear_result(Result& r) noexcept
+    {
+        _clear_data(r.data);
+        r.objects.clear();
+        r.polygons.offsets.clear();
+        r.polygons.triplets.clear();
+        r.polygons.faces.clear();
+        r.smoothing_groups.clear();
+    }
+
+    // post-process the statements of a whole source text, once they have all been parsed
+    template <class Result>
+    void _finish_result(Result& result, std::vector<ParserErrorReport>& errors, const char* data,
+        const std::size_t size, const ObjParserConfig& c, bool recover)
+    {
+        if (!recover && !std::empty(errors))
+            return;
+
+        const auto threads = _thread_count(c.thread_count);
+
+        // vertices of the whole source are needed to split concave polygons
+        if (c.triangulation == ObjParserConfig::Triangulation::ear_clipping)
+            _clip_concave_polygons(result);
+        if (!c.keep_polygons)
+        {
+            result.polygons.offsets.clear();
+            result.polygons.triplets.clear();
+            result.polygons.faces.clear();
+        }
+        if (c.zero_based_indices)
+        {
+            if (const auto i = _first_invalid_face(result.data, threads))
+            {
+                _ErrorLog log{ data, true };
+                log.report(_find_face_statement(data, data, data + size, *i, errors), _pec::index_out_of_range);
+                _append(errors, log.reports());
+                return;
+            }
+            _make_zero_based(result.data, threads);
+            for (auto& t : result.polygons.triplets) // same indices of the triangles, already checked
+                t = { _zero_based(t.v), _zero_based(t.vt), _zero_based(t.vn) };
+        }
+    }
+
+    // parse a source text into an empty result, whose storage is reused;
+    // the lexer and the tokens are only used by the serial parser
+    template <class Result, class Builder>
+    void _parse_as_obj_into(Result& result, std::vector<ParserErrorReport>& errors, const char* data,
+        const std::size_t size, const ObjParserConfig& c, bool recover, LineLexer& lexer, std::pmr::vector<Token>& tokens)
+    {
+        const auto threads = _thread_count(c.thread_count);
+
+        if (const auto bounds = (threads > 1) ? _split_at_linefeeds(data, size, threads, c.min_chunk_size)
+                                              : std::vector<const char*>{};
+            std::size(bounds) > 2)
+        {
+            _parse_as_obj_parallel_into<Result, Builder>(result, errors, bounds, c, recover);
+        }
+        else
+        {
+            _reserve_storage(result, data, data + size, c);
+
+            StatementCounts declared;
+            _IndexResolver  resolver{ declared };
+            _ErrorLog       log{ data, recover };
+
+            Builder builder{ result, c };
+            _parse_lines(data, data + size, builder, resolver, log, lexer, tokens, _memory_resource(c));
+            errors = std::move(log.reports());
+        }
+        _finish_result(result, errors, data, size, c, recover);
+    }
+
+    template <class Result, class Builder>
+    [[nodiscard]] _Parsed<Result> _parse_as_obj_impl(
+        const char* data, const std::size_t size, const ObjParserConfig& c, bool recover)
+    {
+        alignas(Token) std::byte            storage[64 * sizeof(Token)];
+        std::pmr::monotonic_buffer_resource arena{ storage, sizeof(storage), _memory_resource(c) };
+        LineLexer                           lexer;
+        std::pmr::vector<Token>             tokens{ &arena };
+        tokens.reserve(64);
+
+        _Parsed<Result> parsed{ _make_result<Result>(_memory_resource(c)), {} };
+        _parse_as_obj_into<Result, Builder>(parsed.result, parsed.errors, data, size, c, recover, lexer, tokens);
+        if (!c.keep_polygons) // release the storage of the polygons recorded for ear clipping
+            parsed.result.polygons = _make_empty(std::type_identity<decltype(parsed.result.polygons)>{}, _memory_resource(c));
+        return parsed;
+    }
+
+    // parse a file while it is being read, each run of whole lines as soon as it is available
+    template <class Result, class Builder>
+    [[nodiscard]] _Parsed<Result> _parse_as_obj_streamed_impl(AsyncFile& f, const ObjParserConfig& c, bool recover)
+    {
+        if (_thread_count(c.thread_count) > 1) // the source is split in chunks once it has been read
+        {
+            const auto s = f.view();
+            return _parse_as_obj_impl<Result, Builder>(std::data(s), std::size(s), c, recover);
+        }
+
+        alignas(Token) std::byte            storage[64 * sizeof(Token)];
+        std::pmr::monotonic_buffer_resource arena{ storage, sizeof(storage), _memory_resource(c) };
+        LineLexer                           lexer;
+        std::pmr::vector<Token>             tokens{ &arena };
+        tokens.reserve(64);
+
+        _Parsed<Result> parsed{ _make_result<Result>(_memory_resource(c)), {} };
+        auto&           result = parsed.result;
+
+        // statements can't be counted in advance, as the source isn't available yet
+        auto expected    = c;
+        expected.prescan = false;
+        _reserve_storage(result, f.data(), f.data(), expected);
+
+        const auto      data = f.data();
+        StatementCounts declared;
+        _IndexResolver  resolver{ declared };
+        _ErrorLog       log{ data, recover };
+        Builder         builder{ result, c };
+        for (std::size_t first = 0, wanted = 1; first < f.size();)
+        {
+            const auto available = f.wait_for(wanted);
+            wanted               = available + 1; // the rest of the last line, if incomplete
+
+            // the last line of the source may end without a line feed, the other ones are parsed once complete
+            auto last = data + available;
+            if (available < f.size())
+            {
+                const auto lf = std::find(std::make_reverse_iterator(last), std::make_reverse_iterator(data + first), '\n');
+                if (lf == std::make_reverse_iterator(data + first))
+                    continue;
+                last = lf.base();
+            }
+
+            // nothing is read from last onwards, where the reads may still be writing
+            _parse_lines(data + first, last, builder, resolver, log, lexer, tokens, _memory_resource(c));
+            if (!recover && !log.empty())
+                break;
+            first = static_cast<std::size_t>(last - data);
+        }
+        parsed.errors = std::move(log.reports());
+
+        _finish_result(result, parsed.errors, data, f.size(), c, recover);
+        if (!c.keep_polygons)
+            result.polygons = _make_empty(std::type_identity<decltype(result.polygons)>{}, _memory_resource(c));
+        return parsed;
+    }
+
+    template <class Value, class Index>
+    std::variant<ObjParserResult<Value, Index>, ParserErrorReport> try_parse(
+        const std::string_view s, const ObjParserConfig& c)
+    {
+        auto [result, errors] = _parse_as_obj_impl<ObjParserResult<Value, Index>, ObjResultBuilder<Value, Index>>(
+            std::data(s), std::size(s), c, false);
+        if (!std::empty(errors))
+            return errors.front();
+        return std::move(result);
+    }
+
+    template <class Value, class Index>
+    std::tuple<ObjParserResult<Value, Index>, std::vector<ParserErrorReport>> try_force_parse(
+        const std::string_view s, const ObjParserConfig& c)
+    {
+        auto [result, errors] = _parse_as_obj_impl<ObjParserResult<Value, Index>, ObjResultBuilder<Value, Index>>(
+            std::data(s), std::size(s), c, true);
+        return { std::move(result), std::move(errors) };
+    }
+
+    template <class Value, class Index>
+    std::variant<ObjParserSoaResult<Value, Index>, ParserErrorReport> try_parse_soa(
+        const std::string_view s, const ObjParserConfig& c)
+    {
+        auto [result, errors] = _parse_as_obj_impl<ObjParserSoaResult<Value, Index>, SoaResultBuilder<Value, Index>>(
+            std::data(s), std::size(s), c, false);
+        if (!std::empty(errors))
+            return errors.front();
+        return std::move(result);
+    }
+
+    template <class Value, class Index>
+    std::tuple<ObjParserSoaResult<Value, Index>, std::vector<ParserErrorReport>> try_force_parse_soa(
+        const std::string_view s, const ObjParserConfig& c)
+    {
+        auto [result, errors] = _parse_as_obj_impl<ObjParserSoaResult<Value, Index>, SoaResultBuilder<Value, Index>>(
+            std::data(s), std::size(s), c, true);
+        return { std::move(result), std::move(errors) };
+    }
+
+    template <class Value, class Index>
+    std::optional<ParserErrorReport> try_parse(
+        const std::string_view s, ObjVisitor<Value, Index>& v, const ObjVisitorConfig& c)
+    {
+        StatementCounts declared;
+        _IndexResolver  resolver{ declared };
+        _ErrorLog       log{ std::data(s), false };
+        _parse_lines(std::data(s), std::data(s) + std::size(s), v, resolver, log, _memory_resource(c));
+        if (log.empty())
+            return std::nullopt;
+        return log.reports().front();
+    }
+
+
+    // the largest pooled blocks fit the face lists of most objects
+    constexpr std::pmr::pool_options _parser_pool_options{ .largest_required_pool_block = 1 << 20 };
+
+    template <class Value, class Index>
+    ObjParser<Value, Index>::ObjParser(const ObjParserConfig& c)
+        : _config{ c }
+        , _pool{ _parser_pool_options, _memory_resource(c) }
+        , _result{ _make_result<ObjParserResult<Value, Index>>(&_pool) }
+        , _tokens{ &_pool }
+    {
+        _config.memory_resource = &_pool;
+        _tokens.reserve(64);
+    }
+
+    template <class Value, class Index>
+    std::optional<ParserErrorReport> ObjParser<Value, Index>::try_parse(const std::string_view s)
+    {
+        _clear_result(_result);
+        _errors.clear();
+        _parse_as_obj_into<ObjParserResult<Value, Index>, ObjResultBuilder<Value, Index>>(
+            _result, _errors, std::data(s), std::size(s), _config, false, _lexer, _tokens);
+        if (std::empty(_errors))
+            return std::nullopt;
+        return _errors.front();
+    }
+
+
+#if !defined(_drako_disable_exceptions) /*vvv exceptions vvv*/
+
+    template <class Value, class Index>
+    const ObjParserResult<Value, Index>& ObjParser<Value, Index>::parse(const std::string_view s)
+    {
+        if (const auto e = try_parse(s))
+            throw ParserError{ *e };
+        return _result;
+    }
+
+    template <class Value, class Index>
+    const ObjParserResult<Value, Index>& ObjParser<Value, Index>::load(const std::filesystem::path& p)
+    {
+        const MappedFile file{ p };
+        return parse(file.view());
+    }
+
+    // parsed content, or the error reported by try_parse() thrown as exception
+    template <class Result>
+    [[nodiscard]] Result _value_or_throw(std::variant<Result, ParserErrorReport>&& r)
+    {
+        if (const auto e = std::get_if<ParserErrorReport>(&r))
+            throw ParserError{ *e };
+        return std::get<Result>(std::move(r));
+    }
+
+    template <class Data>
+    void _validate_indices(const Data& d, std::size_t threads)
+    {
+        if (const auto i = _first_invalid_face(d, threads))
+            throw ParserError{ to_string(_pec::index_out_of_range) + " Face " + std::to_string(*i) };
+    }
+
+    template <class Value, class Index>
+    void validate_indices(const MeshData<Value, Index>& d, std::size_t thread_count)
+    {
+        _validate_indices(d, thread_count);
+    }
+
+    template <class Value, class Index>
+    void validate_indices(const SoaMeshData<Value, Index>& d, std::size_t thread_count)
+    {
+        _validate_indices(d, thread_count);
+    }
+
+    template <class Value, class Index>
+    void normalize_indices(MeshData<Value, Index>& d, std::size_t thread_count)
+    {
+        _validate_indices(d, thread_count);
+        _make_zero_based(d, thread_count);
+    }
+
+    template <class Value, class Index>
+    void normalize_indices(SoaMeshData<Value, Index>& d, std::size_t thread_count)
+    {
+        _validate_indices(d, thread_count);
+        _make_zero_based(d, thread_count);
+    }
+
+    template <class Value, class Index>
+    void parse_as_obj(const std::string& s, ObjVisitor<Value, Index>& v, const ObjVisitorConfig& c)
+    {
+        if (const auto e = try_parse(std::string_view{ s }, v, c))
+            throw ParserError{ *e };
+    }
+
+#if __cpp_lib_string_view
+    template <class Value, class Index>
+    void parse_as_obj(const std::string_view s, ObjVisitor<Value, Index>& v, const ObjVisitorConfig& c)
+    {
+        if (const auto e = try_parse(s, v, c))
+            throw ParserError{ *e };
+    }
+#endif
+
+#if __cpp_lib_span
+    template <class Value, class Index>
+    void parse_as_obj(const std::span<const char> s, ObjVisitor<Value, Index>& v, const ObjVisitorConfig& c)
+    {
+        assert(s.back() == '\0'); // the buffer must be null-terminated like C strings
+        if (const auto e = try_parse(std::string_view{ std::data(s), std::size(s) - 1 }, v, c))
+            throw ParserError{ *e };
+    }
+#endif
+
+    template <class Value, class Index>
+    ObjParserResult<Value, Index> parse_as_obj(AsyncFile& f, const ObjParserConfig& c)
+    {
+        auto [result, errors] = _parse_as_obj_streamed_impl<ObjParserResult<Value, Index>, ObjResultBuilder<Value, Index>>(
+            f, c, false);
+        if (!std::empty(errors))
+            throw ParserError{ errors.front() };
+        return std::move(result);
+    }
+
+    template <class Value, class Index>
+    ObjStreamParser<Value, Index>::ObjStreamParser(ObjVisitor<Value, Index>& v, const ObjVisitorConfig& c)
+        : _visitor{ v }
+        , _config{ c }
+        , _tokens{ _memory_resource(c) }
+        , _pending{ _memory_resource(c) }
+    {
+        _tokens.reserve(64);
+    }
+
+    // errors are located relative to the block, then moved past the lines parsed before it
+    template <class Value, class Index>
+    void ObjStreamParser<Value, Index>::_parse_block(const char* first, const char* last)
+    {
+        _IndexResolver resolver{ _declared };
+        _ErrorLog      log{ first, false };
+        _parse_lines(first, last, _visitor, resolver, log, _lexer, _tokens, _memory_resource(_config));
+        if (!log.empty())
+        {
+            const auto& e = log.reports().front();
+            throw ParserError{ ParserErrorReport{ _lines + e.line(), e.column(), _offset + e.char_index(), e.code() } };
+        }
+        _lines += static_cast<std::size_t>(std::count(first, last, '\n'));
+        _offset += static_cast<std::size_t>(last - first);
+    }
+
+    template <class Value, class Index>
+    void ObjStreamParser<Value, Index>::feed(const char* data, std::size_t size)
+    {
+        const auto end = data + size;
+
+        const auto rlast = std::find(std::make_reverse_iterator(end), std::make_reverse_iterator(data), '\n');
+        if (rlast == std::make_reverse_iterator(data))
+        { // no line is completed by this block
+            _pending.append(data, size);
+            return;
+        }
+        const auto complete_end = rlast.base(); // one past the last line feed
+
+        auto first = data;
+        if (!std::empty(_pending))
+        { // complete the pending line, kept in its own null-terminated buffer
+            const auto lf = std::find(data, complete_end, '\n');
+            _pending.append(data, lf + 1);
+            _parse_block(std::data(_pending), std::data(_pending) + std::size(_pending));
+            first = lf + 1;
+        }
+
+        // lines ending with a line feed never need the string terminator
+        _parse_block(first, complete_end);
+        _pending.assign(complete_end, end);
+    }
+
+    template <class Value, class Index>
+    void ObjStreamParser<Value, Index>::finish()
+    {
+        if (!std::empty(_pending))
+            _parse_block(std::data(_pending), std::data(_pending) + std::size(_pending));
+        _pending.clear();
+    }
+
+    template <class Value, class Index>
+    ObjParserResult<Value, Index> parse_as_obj(
+        const std::string& s, const ObjParserConfig& c)
+    {
+        return _value_or_throw(try_parse<Value, Index>(std::string_view{ s }, c));
+    }
+
+#if __cpp_lib_string_view
+    template <class Value, class Index>
+    ObjParserResult<Value, Index> parse_as_obj(
+        const std::string_view s, const ObjParserConfig& c)
+    {
+        return _value_or_throw(try_parse<Value, Index>(s, c));
+    }
+#endif
+
+#if __cpp_lib_span
+    template <class Value, class Index>
+    ObjParserResult<Value, Index> parse_as_obj(
+        const std::span<const char> s, const ObjParserConfig& c)
+    {
+        assert(s.back() == '\0'); // the buffer must be null-terminated like C strings
+        return _value_or_throw(try_parse<Value, Index>(std::string_view{ std::data(s), std::size(s) - 1 }, c));
+    }
+#endif
+
+    template <class Value, class Index>
+    ObjParserSoaResult<Value, Index> parse_as_obj_soa(
+        const std::string& s, const ObjParserConfig& c)
+    {
+        return _value_or_throw(try_parse_soa<Value, Index>(std::string_view{ s }, c));
+    }
+
+#if __cpp_lib_string_view
+    template <class Value, class Index>
+    ObjParserSoaResult<Value, Index> parse_as_obj_soa(
+        const std::string_view s, const ObjParserConfig& c)
+    {
+        return _value_or_throw(try_parse_soa<Value, Index>(s, c));
+    }
+#endif
+
+#if __cpp_lib_span
+    template <class Value, class Index>
+    ObjParserSoaResult<Value, Index> parse_as_obj_soa(
+        const std::span<const char> s, const ObjParserConfig& c)
+    {
+        assert(s.back() == '\0'); // the buffer must be null-terminated like C strings
+        return _value_or_throw(try_parse_soa<Value, Index>(std::string_view{ std::data(s), std::size(s) - 1 }, c));
+    }
+#endif
+
+#endif /*^^^ exceptions ^^^*/
+
+
+    // explicit instantiations for the supported value and index types
+
+#if !defined(_drako_disable_exceptions)
+
+#define OBJCPP_INSTANTIATE_PARSER_FOR(Source, Value, Index)                                          \
+    template ObjParserResult<Value, Index>    parse_as_obj<Value, Index>(Source, const ObjParserConfig&); \
+    template ObjParserSoaResult<Value, Index> parse_as_obj_soa<Value, Index>(Source, const ObjParserConfig&); \
+    template void parse_as_obj<Value, Index>(Source, ObjVisitor<Value, Index>&, const ObjVisitorConfig&);
+
+#if __cpp_lib_string_view
+#define OBJCPP_INSTANTIATE_PARSER_FOR_STRING_VIEW(Value, Index) \
+    OBJCPP_INSTANTIATE_PARSER_FOR(const std::string_view, Value, Index)
+#else
+#define OBJCPP_INSTANTIATE_PARSER_FOR_STRING_VIEW(Value, Index)
+#endif
+
+#if __cpp_lib_span
+#define OBJCPP_INSTANTIATE_PARSER_FOR_SPAN(Value, Index) \
+    OBJCPP_INSTANTIATE_PARSER_FOR(const std::span<const char>, Value, Index)
+#else
+#define OBJCPP_INSTANTIATE_PARSER_FOR_SPAN(Value, Index)
+#endif
+
+#define OBJCPP_INSTANTIATE_THROWING_PARSER(Value, Index)                           \
+    template class ObjStreamParser<Value, Index>;                                  \
+    template ObjParserResult<Value, Index> parse_as_obj(AsyncFile&, const ObjParserConfig&); \
+    template void validate_indices(const MeshData<Value, Index>&, std::size_t);    \
+    template void validate_indices(const SoaMeshData<Value, Index>&, std::size_t); \
+    template void normalize_indices(MeshData<Value, Index>&, std::size_t);         \
+    template void normalize_indices(SoaMeshData<Value, Index>&, std::size_t);      \
+    OBJCPP_INSTANTIATE_PARSER_FOR(const std::string&, Value, Index)                \
+    OBJCPP_INSTANTIATE_PARSER_FOR_STRING_VIEW(Value, Index)                        \
+    OBJCPP_INSTANTIATE_PARSER_FOR_SPAN(Value, Index)
+
+#else
+#define OBJCPP_INSTANTIATE_THROWING_PARSER(Value, Index)
+#endif
+
+#define OBJCPP_INSTANTIATE_PARSER(Value, Index)                                                                    \
+    template class ObjResultBuilder<Value, Index>;                                                                 \
+    template class SoaResultBuilder<Value, Index>;                                                                 \
+    template class ObjParser<Value, Index>;                                                                        \
+    template std::variant<ObjParserResult<Value, Index>, ParserErrorReport> try_parse<Value, Index>(               \
+        const std::string_view, const ObjParserConfig&);                                                           \
+    template std::tuple<ObjParserResult<Value, Index>, std::vector<ParserErrorReport>> try_force_parse<Value, Index>( \
+        const std::string_view, const ObjParserConfig&);                                                           \
+    template std::variant<ObjParserSoaResult<Value, Index>, ParserErrorReport> try_parse_soa<Value, Index>(        \
+        const std::string_view, const ObjParserConfig&);                                                           \
+    template std::tuple<ObjParserSoaResult<Value, Index>, std::vector<ParserErrorReport>>                          \
+    try_force_parse_soa<Value, Index>(const std::string_view, const ObjParserConfig&);                             \
+    template std::optional<ParserErrorReport> try_parse<Value, Index>(                                             \
+        const std::string_view, ObjVisitor<Value, Index>&, const ObjVisitorConfig&);                                \
+    OBJCPP_INSTANTIATE_THROWING_PARSER(Value, Index)
+
+    OBJCPP_INSTANTIATE_PARSER(float, std::uint16_t)
+    OBJCPP_INSTANTIATE_PARSER(float, std::uint32_t)
+    OBJCPP_INSTANTIATE_PARSER(float, std::uint64_t)
+    OBJCPP_INSTANTIATE_PARSER(double, std::uint16_t)
+    OBJCPP_INSTANTIATE_PARSER(double, std::uint32_t)
+    OBJCPP_INSTANTIATE_PARSER(double, std::uint64_t)
+
+#undef OBJCPP_INSTANTIATE_PARSER
+#undef OBJCPP_INSTANTIATE_THROWING_PARSER
+#undef OBJCPP_INSTANTIATE_PARSER_FOR_SPAN
+#undef OBJCPP_INSTANTIATE_PARSER_FOR_STRING_VIEW
+#undef OBJCPP_INSTANTIATE_PARSER_FOR
 
 } // namespace obj
\ No newline at end of file
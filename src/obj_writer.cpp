@@ -0,0 +1,413 @@
+#include "obj-cpp/obj_writer.hpp"
+
+#include "obj-cpp/parallel.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace obj
+{
+    // text written through a cursor into a string that grows in large steps,
+    // so that each statement only checks once for room
+    class _TextBuffer
+    {
+    public:
+        // room for at least n more characters, to be committed once written
+        [[nodiscard]] char* reserve(std::size_t n)
+        {
+            if (std::size(_text) - _size < n)
+                _text.resize(std::max(2 * std::size(_text), _size + std::max<std::size_t>(n, 1 << 16)));
+            return std::data(_text) + _size;
+        }
+
+        void commit(const char* end) noexcept { _size = static_cast<std::size_t>(end - std::data(_text)); }
+
+        void append(std::string_view s)
+        {
+            const auto p = reserve(std::size(s));
+            commit(std::copy(std::cbegin(s), std::cend(s), p));
+        }
+
+        [[nodiscard]] std::string take() &&
+        {
+            _text.resize(_size);
+            return std::move(_text);
+        }
+
+    private:
+        std::string _text;
+        std::size_t _size = 0;
+    };
+
+    // longest text of a value in the shortest round-trip form, such as -1.2345678901234567e-308
+    constexpr std::size_t _max_value_length = 32;
+
+    // longest text of a v/vt/vn triplet, preceded by a space
+    constexpr std::size_t _max_triplet_length = 3 * (std::numeric_limits<std::uint64_t>::digits10 + 1) + 3;
+
+    // nan and infinity have no text the parser accepts
+    template <class Value>
+    void _check_values(std::span<const Value> values)
+    {
+        if (!std::ranges::all_of(values, [](Value v) { return std::isfinite(v); }))
+            throw std::invalid_argument{ "Value is not finite" };
+    }
+
+    // names are read back as a single token, before any comment
+    void _write_name(_TextBuffer& out, std::string_view tag, std::string_view name)
+    {
+        if (std::empty(name) || !std::ranges::all_of(name, [](char c) { return c >= '!' && c <= '}' && c != '#'; }))
+            throw std::invalid_argument{ "Name cannot be written as a single token" };
+
+        out.append(tag);
+        out.append(name);
+        out.append("\n");
+    }
+
+    template <class Value>
+    [[nodiscard]] char* _write_value(char* p, Value v) noexcept
+    {
+        *p++ = ' ';
+        return std::to_chars(p, p + _max_value_length, v).ptr;
+    }
+
+    template <class Value>
+    [[nodiscard]] char* _write_statement(char* p, std::string_view tag, std::span<const Value> values)
+    {
+        _check_values(values);
+        p = std::copy(std::cbegin(tag), std::cend(tag), p);
+        for (const auto v : values)
+            p = _write_value(p, v);
+        *p++ = '\n';
+        return p;
+    }
+
+    // one-based index, nothing for a missing one
+    template <class Index>
+    [[nodiscard]] char* _write_index(char* p, Index i, bool zero_based) noexcept
+    {
+        if (zero_based) // missing ones wrap around to zero
+            i = static_cast<Index>(i + 1);
+        return (i != 0) ? std::to_chars(p, p + std::numeric_limits<std::uint64_t>::digits10 + 1, i).ptr : p;
+    }
+
+    // both slashes are always written, as the parser expects
+    template <class Index>
+    [[nodiscard]] char* _write_triplet(char* p, const Triplet<Index>& t, bool zero_based) noexcept
+    {
+        *p++ = ' ';
+        p    = _write_index(p, t.v, zero_based);
+        *p++ = '/';
+        p    = _write_index(p, t.vt, zero_based);
+        *p++ = '/';
+        return _write_index(p, t.vn, zero_based);
+    }
+
+    template <class Index>
+    void _write_face(_TextBuffer& out, std::span<const Triplet<Index>> triplets, bool zero_based)
+    {
+        auto p = out.reserve(std::size(triplets) * _max_triplet_length + 2);
+        *p++   = 'f';
+        for (const auto& t : triplets)
+            p = _write_triplet(p, t, zero_based);
+        *p++ = '\n';
+        out.commit(p);
+    }
+
+    void _write_smoothing_group(_TextBuffer& out, std::uint32_t id)
+    {
+        if (id == 0)
+            return out.append("s off\n");
+
+        auto p = out.reserve(16);
+        p      = std::copy_n("s ", 2, p);
+        p      = std::to_chars(p, p + 10, id).ptr;
+        *p++   = '\n';
+        out.commit(p);
+    }
+
+    // statements of a .obj file as a sequence of items: vertices, normals, texture vertices and
+    // faces in writing order, each one possibly preceded by 'o' and 's' statements
+    template <class Value, class Index>
+    class _ObjLayout
+    {
+    public:
+        _ObjLayout(const MeshData<Value, Index>& d, std::span<const Object<Index>> objects,
+            std::span<const SmoothingGroup<Index>> groups, const PolygonData<Index>& polygons)
+            : _data{ d }, _objects{ objects }, _groups{ groups }
+        {
+            const auto faces = std::size(d.faces);
+
+            // faces without an object come first, then the faces of each object
+            if (!std::empty(objects))
+            {
+                std::vector<bool> owned(faces);
+                for (const auto& o : objects)
+                    for (const auto f : o.faces)
+                        owned.at(static_cast<std::size_t>(f)) = true;
+
+                _order.reserve(faces);
+                for (std::size_t f = 0; f < faces; ++f)
+                    if (!owned[f])
+                        _order.push_back(f);
+                for (std::size_t k = 0; k < std::size(objects); ++k)
+                {
+                    _opens.emplace_back(std::size(_order), k);
+                    for (const auto f : objects[k].faces)
+                        _order.push_back(static_cast<std::size_t>(f));
+                }
+            }
+
+            // first triangle of each polygon, the other ones are covered by it
+            if (std::size(polygons) > 0)
+            {
+                _polygons = &polygons;
+                _polygon_of.assign(faces, _none);
+                for (std::size_t i = 0; i < std::size(polygons); ++i)
+                {
+                    const auto first = static_cast<std::size_t>(polygons.faces[i]);
+                    const auto count = polygons.last(i) - polygons.first(i);
+                    if (count < 3 || first + count - 2 > faces)
+                        throw std::out_of_range{ "Polygon out of range" };
+
+                    _polygon_of[first] = i;
+                    std::fill_n(std::begin(_polygon_of) + static_cast<std::ptrdiff_t>(first) + 1, count - 3, _covered);
+                }
+            }
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept { return _face_items() + _face_positions(); }
+
+        // format the items of the range [first, last)
+        [[nodiscard]] std::string format(std::size_t first, std::size_t last, bool zero_based) const
+        {
+            _TextBuffer out;
+            (void)out.reserve((last - first) * 40);
+
+            const auto v_end  = std::size(_data.v);
+            const auto vn_end = v_end + std::size(_data.vn);
+            const auto vt_end = vn_end + std::size(_data.vt);
+            for (auto i = first; i < std::min(last, v_end); ++i)
+            {
+                const auto& v = _data.v[i];
+                const Value values[] = { v.x, v.y, v.z, v.w };
+                out.commit(_write_statement<Value>(out.reserve(4 * _max_value_length + 4), "v",
+                    std::span{ values }.first((v.w != 1) ? 4 : 3)));
+            }
+            for (auto i = std::max(first, v_end); i < std::min(last, vn_end); ++i)
+            {
+                const auto& vn = _data.vn[i - v_end];
+                const Value values[] = { vn.x, vn.y, vn.z };
+                out.commit(_write_statement<Value>(out.reserve(3 * _max_value_length + 4), "vn", std::span{ values }));
+            }
+            for (auto i = std::max(first, vn_end); i < std::min(last, vt_end); ++i)
+            {
+                const auto& vt = _data.vt[i - vn_end];
+                const Value values[] = { vt.u, vt.v, vt.w };
+                out.commit(_write_statement<Value>(out.reserve(3 * _max_value_length + 4), "vt",
+                    std::span{ values }.first((vt.w != 0) ? 3 : 2)));
+            }
+            if (last > vt_end || last == size()) // the last chunk also ends the statements
+                _format_faces(out, std::max(first, vt_end) - vt_end, last - vt_end, zero_based);
+            return std::move(out).take();
+        }
+
+    private:
+        static constexpr std::size_t _none    = std::numeric_limits<std::size_t>::max();
+        static constexpr std::size_t _covered = _none - 1;
+
+        const MeshData<Value, Index>&                    _data;
+        std::span<const Object<Index>>                   _objects;
+        std::span<const SmoothingGroup<Index>>           _groups;
+        std::vector<std::size_t>                         _order;      // faces in writing order, unless sorted
+        std::vector<std::pair<std::size_t, std::size_t>> _opens;      // position in the order where each object starts
+        const PolygonData<Index>*                        _polygons = nullptr;
+        std::vector<std::size_t>                         _polygon_of; // polygon that starts at each face
+
+        [[nodiscard]] std::size_t _face_items() const noexcept
+        {
+            return std::size(_data.v) + std::size(_data.vn) + std::size(_data.vt);
+        }
+
+        // number of faces in writing order, where objects may list a face more than once
+        [[nodiscard]] std::size_t _face_positions() const noexcept
+        {
+            return std::empty(_order) ? std::size(_data.faces) : std::size(_order);
+        }
+
+        [[nodiscard]] std::size_t _face_at(std::size_t position) const noexcept
+        {
+            return std::empty(_order) ? position : _order[position];
+        }
+
+        // smoothing run of a face, or _none if it precedes the first 's' statement
+        [[nodiscard]] std::size_t _run_of(std::size_t face) const noexcept
+        {
+            const auto r = std::upper_bound(std::cbegin(_groups), std::cend(_groups), face,
+                [](std::size_t f, const auto& g) { return f < static_cast<std::size_t>(g.first_face); });
+            return (r == std::cbegin(_groups)) ? _none : static_cast<std::size_t>(r - std::cbegin(_groups) - 1);
+        }
+
+        // format the faces at the positions [first, last) of the writing order
+        void _format_faces(_TextBuffer& out, std::size_t first, std::size_t last, bool zero_based) const
+        {
+            const auto faces = std::size(_data.faces);
+
+            // the smoothing run in effect carries over from the previous chunk
+            auto run   = (first > 0) ? _run_of(_face_at(first - 1)) : _none;
+            auto opens = std::lower_bound(std::cbegin(_opens), std::cend(_opens), std::pair{ first, std::size_t{ 0 } });
+            for (auto i = first; i < last; ++i)
+            {
+                for (; opens != std::cend(_opens) && opens->first == i; ++opens)
+                {
+                    _write_name(out, "o ", _objects[opens->second].name);
+                }
+
+                const auto f = _face_at(i);
+                if (const auto r = _run_of(f); r != run)
+                {
+                    // faces before the first 's' statement are only met again when objects reorder them
+                    if (r == _none)
+                        out.append("s off\n");
+                    else
+                        _write_smoothing_group(out, _groups[r].id);
+                    run = r;
+                }
+
+                const auto polygon = std::empty(_polygon_of) ? _none : _polygon_of[f];
+                if (polygon == _covered)
+                    continue;
+                if (polygon != _none)
+                    _write_face<Index>(out, std::span{ _polygons->triplets }.subspan(
+                        _polygons->first(polygon), _polygons->last(polygon) - _polygons->first(polygon)), zero_based);
+                else
+                    _write_face<Index>(out, _data.faces[f].triplets, zero_based);
+            }
+
+            // statements after the last face, such as objects without faces
+            if (last == _face_positions())
+            {
+                for (; opens != std::cend(_opens); ++opens)
+                {
+                    _write_name(out, "o ", _objects[opens->second].name);
+                }
+                for (const auto& g : _groups)
+                    if (static_cast<std::size_t>(g.first_face) >= faces)
+                        _write_smoothing_group(out, g.id);
+            }
+        }
+    };
+
+    // chunks of text, to be written one after the other
+    template <class Value, class Index>
+    [[nodiscard]] std::vector<std::string> _format_obj_chunks(const MeshData<Value, Index>& d,
+        std::span<const Object<Index>> objects, std::span<const SmoothingGroup<Index>> groups,
+        const PolygonData<Index>& polygons, const ObjWriterConfig& c)
+    {
+        const _ObjLayout<Value, Index> layout{ d, objects, groups, polygons };
+        return _map_ranges(std::size(layout), c.thread_count, [&](std::size_t first, std::size_t last) {
+            return layout.format(first, last, c.zero_based_indices);
+        });
+    }
+
+    [[nodiscard]] std::string _concatenate(std::vector<std::string>&& chunks)
+    {
+        if (std::size(chunks) == 1)
+            return std::move(chunks.front());
+
+        std::string text;
+        text.reserve(std::accumulate(std::cbegin(chunks), std::cend(chunks), std::size_t{ 0 },
+            [](std::size_t n, const auto& s) { return n + std::size(s); }));
+        for (const auto& s : chunks)
+            text += s;
+        return text;
+    }
+
+    void _write_file(const std::filesystem::path& p, const std::vector<std::string>& chunks)
+    {
+        std::ofstream f{ p, std::ios::binary | std::ios::trunc };
+        if (!f)
+            throw std::system_error{ std::make_error_code(std::errc::io_error), "Cannot create file" };
+        for (const auto& s : chunks)
+            f.write(std::data(s), static_cast<std::streamsize>(std::size(s)));
+        f.close();
+        if (!f)
+            throw std::system_error{ std::make_error_code(std::errc::io_error), "Cannot write file" };
+    }
+
+    template <class Value, class Index>
+    std::string format_obj(const MeshData<Value, Index>& d, const ObjWriterConfig& c)
+    {
+        return _concatenate(_format_obj_chunks<Value, Index>(d, {}, {}, PolygonData<Index>{}, c));
+    }
+
+    template <class Value, class Index>
+    std::string format_obj(const ObjParserResult<Value, Index>& r, const ObjWriterConfig& c)
+    {
+        return _concatenate(_format_obj_chunks<Value, Index>(r.data, r.objects, r.smoothing_groups, r.polygons, c));
+    }
+
+    std::string format_mtl(const MtlParserResult& r)
+    {
+        _TextBuffer out;
+        for (const auto& m : r.materials)
+        {
+            _write_name(out, "newmtl ", m.name);
+
+            const std::pair<std::string_view, const DefaultValueType*> colors[] = {
+                { "Ka", m.ka }, { "Kd", m.kd }, { "Ks", m.ks }
+            };
+            for (const auto& [tag, values] : colors)
+                out.commit(_write_statement<DefaultValueType>(
+                    out.reserve(3 * _max_value_length + 4), tag, std::span{ values, 3 }));
+        }
+        return std::move(out).take();
+    }
+
+    template <class Value, class Index>
+    void write_obj(const MeshData<Value, Index>& d, const std::filesystem::path& p, const ObjWriterConfig& c)
+    {
+        _write_file(p, _format_obj_chunks<Value, Index>(d, {}, {}, PolygonData<Index>{}, c));
+    }
+
+    template <class Value, class Index>
+    void write_obj(const ObjParserResult<Value, Index>& r, const std::filesystem::path& p, const ObjWriterConfig& c)
+    {
+        _write_file(p, _format_obj_chunks<Value, Index>(r.data, r.objects, r.smoothing_groups, r.polygons, c));
+    }
+
+    void write_mtl(const MtlParserResult& r, const std::filesystem::path& p)
+    {
+        _write_file(p, { format_mtl(r) });
+    }
+
+
+    // explicit instantiations for the supported value and index types
+
+#define OBJCPP_INSTANTIATE_WRITER(Value, Index)                                                                     \
+    template std::string format_obj(const MeshData<Value, Index>&, const ObjWriterConfig&);                        \
+    template std::string format_obj(const ObjParserResult<Value, Index>&, const ObjWriterConfig&);                 \
+    template void        write_obj(const MeshData<Value, Index>&, const std::filesystem::path&, const ObjWriterConfig&); \
+    template void        write_obj(const ObjParserResult<Value, Index>&, const std::filesystem::path&, const ObjWriterConfig&);
+
+    OBJCPP_INSTANTIATE_WRITER(float, std::uint16_t)
+    OBJCPP_INSTANTIATE_WRITER(float, std::uint32_t)
+    OBJCPP_INSTANTIATE_WRITER(float, std::uint64_t)
+    OBJCPP_INSTANTIATE_WRITER(double, std::uint16_t)
+    OBJCPP_INSTANTIATE_WRITER(double, std::uint32_t)
+    OBJCPP_INSTANTIATE_WRITER(double, std::uint64_t)
+
+#undef OBJCPP_INSTANTIATE_WRITER
+
+} // namespace obj
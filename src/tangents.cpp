@@ -0,0 +1,394 @@
+#include "obj-cpp/tangents.hpp"
+
+#include "obj-cpp/parallel.hpp"
+#include "obj-cpp/welding.hpp"
+
+#include "geometry.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// The tangents follow the reference implementation of MikkTSpace (mikktspace.c by Morten S. Mikkelsen)
+// with its default angular threshold, on a mesh whose faces are all triangles.
+namespace obj
+{
+    template <class Value>
+    [[nodiscard]] std::array<Value, 3> _scale(const std::array<Value, 3>& a, Value s) noexcept
+    {
+        return { a[0] * s, a[1] * s, a[2] * s };
+    }
+
+    template <class Value>
+    [[nodiscard]] std::array<Value, 3> _add(const std::array<Value, 3>& a, const std::array<Value, 3>& b) noexcept
+    {
+        return { a[0] + b[0], a[1] + b[1], a[2] + b[2] };
+    }
+
+    // values are compared with the smallest normal float, whatever their precision
+    template <class Value>
+    [[nodiscard]] bool _not_zero(Value x) noexcept
+    {
+        return std::abs(x) > std::numeric_limits<float>::min();
+    }
+
+    template <class Value>
+    [[nodiscard]] bool _not_zero(const std::array<Value, 3>& a) noexcept
+    {
+        return _not_zero(a[0]) || _not_zero(a[1]) || _not_zero(a[2]);
+    }
+
+    // unit vector with the direction of a, or a itself if it is too short
+    template <class Value>
+    [[nodiscard]] std::array<Value, 3> _normalize(const std::array<Value, 3>& a) noexcept
+    {
+        return _not_zero(a) ? _scale(a, 1 / std::sqrt(_dot(a, a))) : a;
+    }
+
+    // component of a orthogonal to the unit vector n
+    template <class Value>
+    [[nodiscard]] std::array<Value, 3> _reject(const std::array<Value, 3>& a, const std::array<Value, 3>& n) noexcept
+    {
+        return _sub(a, _scale(n, _dot(a, n)));
+    }
+
+    // hash of the values of a vertex, the same for the values that compare equal
+    template <class Value>
+    struct _PackedVertexHash
+    {
+        [[nodiscard]] std::size_t operator()(const PackedVertex<Value>& v) const noexcept
+        {
+            std::size_t h   = 0;
+            const auto  mix = [&](Value x) {
+                h = h * 0x9E3779B97F4A7C15 + std::hash<Value>{}((x == 0) ? Value{ 0 } : x); // -0 as 0
+            };
+            for (const auto x : v.position)
+                mix(x);
+            for (const auto x : v.normal)
+                mix(x);
+            for (const auto x : v.texcoord)
+                mix(x);
+            return h;
+        }
+    };
+
+    // missing neighbor or group
+    constexpr auto _unassigned = std::numeric_limits<std::size_t>::max();
+
+    // triangle whose positions are distinct, with its derivatives and its state in the grouping
+    template <class Value>
+    struct _TangentTriangle
+    {
+        std::array<std::uint32_t, 3> vertices;   // merged vertices of the corners
+        std::array<Value, 3>         s, t;       // unit derivatives along the texture coordinates
+        std::array<std::size_t, 3>   neighbors;  // triangle across each edge, from each corner to the next one
+        std::array<std::size_t, 3>   groups;     // group of each corner
+        bool                         preserving; // texture mapping with the orientation of the face
+        bool                         any;        // no derivatives, joins the group of any neighbor
+    };
+
+    // triangles around a vertex that are joined through their shared edges, with the same orientation
+    struct _TangentGroup
+    {
+        std::uint32_t vertex;
+        bool          preserving;
+        std::size_t   first, last; // range in the list of members
+    };
+
+    // number and vertices of the edge of a triangle between the vertices a and b, in triangle order
+    [[nodiscard]] std::tuple<std::size_t, std::uint32_t, std::uint32_t> _triangle_edge(
+        const std::array<std::uint32_t, 3>& v, std::uint32_t a, std::uint32_t b) noexcept
+    {
+        if (v[0] == a || v[0] == b)
+            return (v[1] == a || v[1] == b) ? std::tuple{ std::size_t{ 0 }, v[0], v[1] }
+                                            : std::tuple{ std::size_t{ 2 }, v[2], v[0] };
+        return { 1, v[1], v[2] };
+    }
+
+    // corner of a triangle at a vertex
+    [[nodiscard]] std::size_t _triangle_corner(const std::array<std::uint32_t, 3>& v, std::uint32_t vertex) noexcept
+    {
+        return (v[0] == vertex) ? 0 : (v[1] == vertex) ? 1 : 2;
+    }
+
+    // pair each edge with the first triangle, in triangle order, that has it in the opposite direction
+    template <class Value>
+    void _find_neighbors(std::vector<_TangentTriangle<Value>>& triangles)
+    {
+        struct Edge
+        {
+            std::uint32_t a, b; // smaller and larger vertex
+            std::size_t   triangle;
+        };
+
+        std::vector<Edge> edges;
+        edges.reserve(3 * std::size(triangles));
+        for (std::size_t i = 0; i < std::size(triangles); ++i)
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                const auto v0 = triangles[i].vertices[k], v1 = triangles[i].vertices[(k + 1) % 3];
+                edges.push_back({ std::min(v0, v1), std::max(v0, v1), i });
+            }
+        std::sort(std::begin(edges), std::end(edges), [](const Edge& x, const Edge& y) {
+            return std::tie(x.a, x.b, x.triangle) < std::tie(y.a, y.b, y.triangle);
+        });
+
+        for (std::size_t i = 0; i < std::size(edges); ++i)
+        {
+            auto&      x                   = triangles[edges[i].triangle];
+            const auto [edge, first, last] = _triangle_edge(x.vertices, edges[i].a, edges[i].b);
+            if (x.neighbors[edge] != _unassigned)
+                continue;
+
+            for (auto j = i + 1; j < std::size(edges) && edges[j].a == edges[i].a && edges[j].b == edges[i].b; ++j)
+            {
+                auto&      y                        = triangles[edges[j].triangle];
+                const auto [other, y_first, y_last] = _triangle_edge(y.vertices, edges[j].a, edges[j].b);
+                if (y_first == last && y_last == first && y.neighbors[other] == _unassigned)
+                {
+                    x.neighbors[edge]  = edges[j].triangle;
+                    y.neighbors[other] = edges[i].triangle;
+                    break;
+                }
+            }
+        }
+    }
+
+    // groups of the corners, started in triangle order from the triangles with derivatives;
+    // a triangle without derivatives takes the orientation of the first group that reaches it
+    template <class Value>
+    void _build_groups(
+        std::vector<_TangentTriangle<Value>>& triangles, std::vector<_TangentGroup>& groups, std::vector<std::size_t>& members)
+    {
+        std::vector<std::size_t> pending;
+        for (std::size_t i = 0; i < std::size(triangles); ++i)
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                if (triangles[i].any || triangles[i].groups[k] != _unassigned)
+                    continue;
+
+                const auto    id = std::size(groups);
+                _TangentGroup g{ triangles[i].vertices[k], triangles[i].preserving, std::size(members), 0 };
+                members.push_back(i);
+                triangles[i].groups[k] = id;
+                pending                = { triangles[i].neighbors[(k + 2) % 3], triangles[i].neighbors[k] };
+                while (!std::empty(pending))
+                {
+                    const auto n = pending.back();
+                    pending.pop_back();
+                    if (n == _unassigned)
+                        continue;
+
+                    auto&      t      = triangles[n];
+                    const auto corner = _triangle_corner(t.vertices, g.vertex);
+                    if (t.groups[corner] != _unassigned)
+                        continue;
+                    if (t.any && std::all_of(std::cbegin(t.groups), std::cend(t.groups),
+                                     [](auto x) { return x == _unassigned; }))
+                        t.preserving = g.preserving;
+                    if (t.preserving != g.preserving)
+                        continue;
+
+                    members.push_back(n);
+                    t.groups[corner] = id;
+                    pending.push_back(t.neighbors[(corner + 2) % 3]);
+                    pending.push_back(t.neighbors[corner]);
+                }
+                g.last = std::size(members);
+                groups.push_back(g);
+            }
+    }
+
+    // tangent of each corner of a welded mesh
+    template <class Value>
+    [[nodiscard]] std::vector<Tangent<Value>> _generate_tangents(const IndexedMesh<Value>& m, const TangentConfig& c)
+    {
+        const auto corners = std::size(m.indices);
+
+        // vertices with the same position, normal and texture coordinates are merged
+        std::vector<std::uint32_t> vertices(std::size(m.vertices));
+        {
+            std::unordered_map<PackedVertex<Value>, std::uint32_t, _PackedVertexHash<Value>> first;
+            first.reserve(std::size(m.vertices));
+            for (std::size_t i = 0; i < std::size(m.vertices); ++i)
+                vertices[i] = first.try_emplace(m.vertices[i], static_cast<std::uint32_t>(i)).first->second;
+        }
+        const auto vertex = [&](std::size_t i) { return vertices[m.indices[i]]; };
+
+        // faces with two equal positions are degenerate, and only used once the other ones are done
+        std::vector<std::size_t> faces, degenerate;
+        for (std::size_t f = 0; f < corners / 3; ++f)
+        {
+            const auto& p0 = m.vertices[m.indices[3 * f]].position;
+            const auto& p1 = m.vertices[m.indices[3 * f + 1]].position;
+            const auto& p2 = m.vertices[m.indices[3 * f + 2]].position;
+            ((p0 == p1 || p0 == p2 || p1 == p2) ? degenerate : faces).push_back(f);
+        }
+
+        std::vector<_TangentTriangle<Value>> triangles(std::size(faces));
+        (void)_map_ranges(std::size(faces), c.thread_count, [&](std::size_t first, std::size_t last) {
+            for (auto i = first; i < last; ++i)
+            {
+                auto& t = triangles[i];
+                for (std::size_t k = 0; k < 3; ++k)
+                    t.vertices[k] = vertex(3 * faces[i] + k);
+                t.neighbors.fill(_unassigned);
+                t.groups.fill(_unassigned);
+
+                const auto& a = m.vertices[t.vertices[0]];
+                const auto& b = m.vertices[t.vertices[1]];
+                const auto& d = m.vertices[t.vertices[2]];
+
+                const auto e1 = _sub(b.position, a.position), e2 = _sub(d.position, a.position);
+                const auto s1 = b.texcoord[0] - a.texcoord[0], t1 = b.texcoord[1] - a.texcoord[1];
+                const auto s2 = d.texcoord[0] - a.texcoord[0], t2 = d.texcoord[1] - a.texcoord[1];
+
+                const auto area = s1 * t2 - t1 * s2; // twice the signed area in texture space
+                const auto s    = _sub(_scale(e1, t2), _scale(e2, t1));
+                const auto r    = _add(_scale(e1, -s2), _scale(e2, s1));
+
+                t.preserving = (area > 0);
+                t.any        = true;
+                t.s = t.t = {};
+                if (!_not_zero(area)) // no mapping to derive the tangent from
+                    continue;
+
+                const auto sign     = t.preserving ? Value{ 1 } : Value{ -1 };
+                const auto length_s = std::sqrt(_dot(s, s)), length_t = std::sqrt(_dot(r, r));
+                if (_not_zero(length_s))
+                    t.s = _scale(s, sign / length_s);
+                if (_not_zero(length_t))
+                    t.t = _scale(r, sign / length_t);
+                t.any = !_not_zero(length_s / std::abs(area)) || !_not_zero(length_t / std::abs(area));
+            }
+            return true;
+        });
+
+        _find_neighbors(triangles);
+
+        std::vector<_TangentGroup> groups;
+        std::vector<std::size_t>   members;
+        _build_groups(triangles, groups, members);
+
+        // the members of a group are split in subgroups of triangles whose derivatives are
+        // closer than the angular threshold, 180 degrees so only opposite ones are split;
+        // corners of triangles never reached by a group keep the default tangent space
+        std::vector<Tangent<Value>> tangents(corners, Tangent<Value>{ 1, 0, 0, -1 });
+        (void)_map_ranges(std::size(groups), c.thread_count, [&](std::size_t first, std::size_t last) {
+            constexpr Value threshold = -1;
+
+            std::vector<std::array<Value, 3>>                                s, t;
+            std::vector<std::size_t>                                         subgroup;
+            std::vector<std::pair<std::vector<std::size_t>, Tangent<Value>>> evaluated;
+            for (auto g = first; g < last; ++g)
+            {
+                const auto& group = groups[g];
+                const auto  n     = m.vertices[group.vertex].normal;
+                const auto  begin = std::cbegin(members) + static_cast<std::ptrdiff_t>(group.first);
+                const auto  count = group.last - group.first;
+
+                s.clear();
+                t.clear();
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    s.push_back(_normalize(_reject(triangles[begin[i]].s, n)));
+                    t.push_back(_normalize(_reject(triangles[begin[i]].t, n)));
+                }
+
+                evaluated.clear();
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    subgroup.clear();
+                    for (std::size_t j = 0; j < count; ++j)
+                        if (triangles[begin[i]].any || triangles[begin[j]].any || i == j ||
+                            (_dot(s[i], s[j]) > threshold && _dot(t[i], t[j]) > threshold))
+                            subgroup.push_back(begin[j]);
+                    std::sort(std::begin(subgroup), std::end(subgroup));
+
+                    auto e = std::find_if(std::cbegin(evaluated), std::cend(evaluated),
+                        [&](const auto& x) { return x.first == subgroup; });
+                    if (e == std::cend(evaluated))
+                    {
+                        // derivatives projected on the plane of the normal, weighted by the angle at the vertex
+                        std::array<Value, 3> sum{};
+                        for (const auto j : subgroup)
+                        {
+                            const auto& x = triangles[j];
+                            if (x.any)
+                                continue;
+
+                            const auto  k  = _triangle_corner(x.vertices, group.vertex);
+                            const auto& p0 = m.vertices[x.vertices[(k + 2) % 3]].position;
+                            const auto& p1 = m.vertices[x.vertices[k]].position;
+                            const auto& p2 = m.vertices[x.vertices[(k + 1) % 3]].position;
+                            const auto  v1 = _normalize(_reject(_sub(p0, p1), n));
+                            const auto  v2 = _normalize(_reject(_sub(p2, p1), n));
+                            const auto  a  = std::acos(std::clamp<Value>(_dot(v1, v2), -1, 1));
+                            sum            = _add(sum, _scale(_normalize(_reject(x.s, n)), a));
+                        }
+                        const auto tangent = _normalize(sum);
+                        evaluated.emplace_back(subgroup,
+                            Tangent<Value>{ tangent[0], tangent[1], tangent[2], group.preserving ? Value{ 1 } : Value{ -1 } });
+                        e = std::prev(std::cend(evaluated));
+                    }
+
+                    const auto& x = triangles[begin[i]];
+                    const auto  k = static_cast<std::size_t>(std::find(std::cbegin(x.groups), std::cend(x.groups), g) -
+                                                            std::cbegin(x.groups));
+                    tangents[3 * faces[begin[i]] + k] = e->second;
+                }
+            }
+            return true;
+        });
+
+        // corners of degenerate faces take the tangent space of the first corner at the same vertex
+        std::vector<std::size_t> first(std::size(m.vertices), _unassigned);
+        for (const auto f : faces)
+            for (std::size_t k = 0; k < 3; ++k)
+                if (auto& i = first[vertex(3 * f + k)]; i == _unassigned)
+                    i = 3 * f + k;
+        for (const auto f : degenerate)
+            for (std::size_t k = 0; k < 3; ++k)
+                if (const auto i = first[vertex(3 * f + k)]; i != _unassigned)
+                    tangents[3 * f + k] = tangents[i];
+        return tangents;
+    }
+
+    template <class Value, class Index>
+    std::vector<Tangent<Value>> generate_tangents(const MeshData<Value, Index>& d, const TangentConfig& c)
+    {
+        return _generate_tangents(weld_vertices(d, c), c);
+    }
+
+    template <class Value, class Index>
+    std::vector<Tangent<Value>> generate_tangents(const SoaMeshData<Value, Index>& d, const TangentConfig& c)
+    {
+        return _generate_tangents(weld_vertices(d, c), c);
+    }
+
+
+    // explicit instantiations for the supported value and index types
+
+#define OBJCPP_INSTANTIATE_TANGENTS(Value, Index)                                                                   \
+    template std::vector<Tangent<Value>> generate_tangents(const MeshData<Value, Index>&, const TangentConfig&); \
+    template std::vector<Tangent<Value>> generate_tangents(const SoaMeshData<Value, Index>&, const TangentConfig&);
+
+    OBJCPP_INSTANTIATE_TANGENTS(float, std::uint16_t)
+    OBJCPP_INSTANTIATE_TANGENTS(float, std::uint32_t)
+    OBJCPP_INSTANTIATE_TANGENTS(float, std::uint64_t)
+    OBJCPP_INSTANTIATE_TANGENTS(double, std::uint16_t)
+    OBJCPP_INSTANTIATE_TANGENTS(double, std::uint32_t)
+    OBJCPP_INSTANTIATE_TANGENTS(double, std::uint64_t)
+
+#undef OBJCPP_INSTANTIATE_TANGENTS
+
+} // namespace obj
@@ -0,0 +1,150 @@
+#include "obj-cpp/thread_pool.hpp"
+
+#include <cassert>
+#include <exception>
+#include <optional>
+
+namespace obj
+{
+    // tasks submitted by a single call of run_all()
+    struct WorkStealingPool::_Group
+    {
+        std::atomic<std::size_t> pending;
+        std::mutex               mutex{};
+        std::exception_ptr       error{}; // first exception thrown by the tasks
+    };
+
+    // pool of the current thread and index of its queue, if it's one of the threads of a pool
+    thread_local const WorkStealingPool* _current_pool  = nullptr;
+    thread_local std::size_t             _current_queue = 0;
+
+    WorkStealingPool::WorkStealingPool(std::size_t thread_count)
+    {
+        // the thread calling run_all() runs tasks as well
+        const auto workers = _thread_count(thread_count) - 1;
+        for (std::size_t i = 0; i <= workers; ++i)
+            _queues.push_back(std::make_unique<_Queue>());
+
+        _threads.reserve(workers);
+        for (std::size_t i = 0; i < workers; ++i)
+            _threads.emplace_back([this, i] { _work(i); });
+    }
+
+    WorkStealingPool::~WorkStealingPool() noexcept
+    {
+        {
+            const std::lock_guard lock{ _idle_mutex };
+            _stop = true;
+        }
+        _idle.notify_all();
+        for (auto& t : _threads)
+            t.join();
+    }
+
+    void WorkStealingPool::run_all(std::span<const std::function<void()>> tasks)
+    {
+        if (std::empty(tasks))
+            return;
+
+        // threads that don't belong to the pool share the last queue
+        const auto queue = (_current_pool == this) ? _current_queue : std::size(_threads);
+
+        _Group group{ std::size(tasks) };
+        if (std::size(tasks) > 1)
+        {
+            _queued += std::size(tasks) - 1; // counted first, so that it never drops below the queued tasks
+            { // pushed in reverse order, so that the owner pops them in order
+                const std::lock_guard lock{ _queues[queue]->mutex };
+                for (auto i = std::size(tasks) - 1; i > 0; --i)
+                    _queues[queue]->tasks.push_back({ &tasks[i], &group });
+            }
+            {
+                const std::lock_guard lock{ _idle_mutex };
+            }
+            _idle.notify_all();
+        }
+
+        _run({ &tasks[0], &group });
+        while (group.pending > 0)
+        {
+            if (_try_run(queue))
+                continue;
+
+            std::unique_lock lock{ _idle_mutex };
+            _idle.wait(lock, [&] { return group.pending == 0 || _queued > 0; });
+        }
+
+        if (group.error)
+            std::rethrow_exception(group.error);
+    }
+
+    void WorkStealingPool::_work(std::size_t index)
+    {
+        _current_pool  = this;
+        _current_queue = index;
+        for (;;)
+        {
+            if (_try_run(index))
+                continue;
+
+            std::unique_lock lock{ _idle_mutex };
+            _idle.wait(lock, [&] { return _stop || _queued > 0; });
+            if (_stop && _queued == 0)
+                return;
+        }
+    }
+
+    bool WorkStealingPool::_try_run(std::size_t queue)
+    {
+        std::optional<_Task> task;
+        { // newest task of the own queue
+            auto&                 q = *_queues[queue];
+            const std::lock_guard lock{ q.mutex };
+            if (!std::empty(q.tasks))
+            {
+                task = q.tasks.back();
+                q.tasks.pop_back();
+            }
+        }
+        for (std::size_t i = 1; !task && i < std::size(_queues); ++i)
+        { // oldest task of another queue
+            auto&                 q = *_queues[(queue + i) % std::size(_queues)];
+            const std::lock_guard lock{ q.mutex };
+            if (!std::empty(q.tasks))
+            {
+                task = q.tasks.front();
+                q.tasks.pop_front();
+            }
+        }
+        if (!task)
+            return false;
+
+        --_queued;
+        _run(*task);
+        return true;
+    }
+
+    void WorkStealingPool::_run(const _Task& t) noexcept
+    {
+        try
+        {
+            (*t.function)();
+        }
+        catch (...)
+        {
+            const std::lock_guard lock{ t.group->mutex };
+            if (!t.group->error)
+                t.group->error = std::current_exception();
+        }
+
+        // the group may be destroyed as soon as its last task is completed
+        if (t.group->pending.fetch_sub(1) == 1)
+        {
+            {
+                const std::lock_guard lock{ _idle_mutex };
+            }
+            _idle.notify_all();
+        }
+    }
+
+} // namespace obj
@@ -0,0 +1,444 @@
+#include "obj-cpp/vertex_cache.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace obj
+{
+    VertexCacheStats analyze_vertex_cache(
+        std::span<const std::uint32_t> indices, std::size_t vertex_count, std::size_t cache_size)
+    {
+        assert(std::size(indices) % 3 == 0);
+
+        // a vertex is in the cache if less than cache_size misses happened after it was loaded
+        std::vector<std::size_t> loaded(vertex_count, 0);
+        std::vector<bool>        used(vertex_count, false);
+
+        VertexCacheStats s;
+        s.triangles = std::size(indices) / 3;
+        for (std::size_t time = cache_size; const auto v : indices)
+        {
+            if (time - loaded[v] >= cache_size)
+            {
+                loaded[v] = time++;
+                ++s.transformed;
+            }
+            s.vertices += !used[v];
+            used[v] = true;
+        }
+        return s;
+    }
+
+    // next vertex to fan around: the one of the last triangles that stays in the cache longer,
+    // if its remaining triangles can be emitted before it's evicted
+    [[nodiscard]] std::size_t _next_fanning_vertex(std::span<const std::uint32_t> candidates,
+        const std::vector<std::uint32_t>& live, const std::vector<std::size_t>& loaded, std::size_t time,
+        std::size_t cache_size) noexcept
+    {
+        auto best = std::numeric_limits<std::size_t>::max();
+        for (std::size_t priority = 0; const auto v : candidates)
+            if (live[v] > 0)
+            {
+                const auto age = time - loaded[v];
+                const auto p   = (age + 2 * live[v] <= cache_size) ? age : 0;
+                if (best == std::numeric_limits<std::size_t>::max() || p > priority)
+                    best = v, priority = p;
+            }
+        return best;
+    }
+
+    // triangle order produced by Tipsify [Sander et al. 2007, Fast triangle reordering
+    // for vertex locality and reduced overdraw]
+    [[nodiscard]] std::vector<std::uint32_t> _tipsify(
+        std::span<const std::uint32_t> indices, std::size_t vertex_count, std::size_t cache_size)
+    {
+        const auto triangles = std::size(indices) / 3;
+
+        // triangles adjacent to each vertex
+        std::vector<std::uint32_t> live(vertex_count, 0);
+        for (const auto v : indices)
+            ++live[v];
+        std::vector<std::size_t> offsets(vertex_count + 1, 0);
+        std::inclusive_scan(std::cbegin(live), std::cend(live), std::begin(offsets) + 1, std::plus<>{}, std::size_t{ 0 });
+        std::vector<std::uint32_t> adjacency(std::size(indices));
+        {
+            auto cursor = offsets;
+            for (std::size_t i = 0; i < std::size(indices); ++i)
+                adjacency[cursor[indices[i]]++] = static_cast<std::uint32_t>(i / 3);
+        }
+
+        std::vector<std::uint32_t> order;
+        order.reserve(triangles);
+        std::vector<bool>          emitted(triangles, false);
+        std::vector<std::size_t>   loaded(vertex_count, 0);
+        std::vector<std::uint32_t> dead_ends; // vertices of the last triangles, to resume from
+        std::vector<std::uint32_t> candidates;
+
+        auto time   = cache_size + 1;
+        auto cursor = std::size_t{ 0 }; // next vertex to check when all dead ends are exhausted
+        for (auto fan = std::size_t{ 0 }; vertex_count > 0;)
+        {
+            candidates.clear();
+            for (auto a = offsets[fan]; a != offsets[fan + 1]; ++a)
+            {
+                const auto t = adjacency[a];
+                if (emitted[t])
+                    continue;
+
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    const auto v = indices[3 * t + k];
+                    dead_ends.push_back(v);
+                    candidates.push_back(v);
+                    --live[v];
+                    if (time - loaded[v] > cache_size)
+                        loaded[v] = time++;
+                }
+                emitted[t] = true;
+                order.push_back(t);
+            }
+
+            fan = _next_fanning_vertex(candidates, live, loaded, time, cache_size);
+            while (fan == std::numeric_limits<std::size_t>::max() && !std::empty(dead_ends))
+            {
+                if (live[dead_ends.back()] > 0)
+                    fan = dead_ends.back();
+                dead_ends.pop_back();
+            }
+            for (; fan == std::numeric_limits<std::size_t>::max() && cursor < vertex_count; ++cursor)
+                if (live[cursor] > 0)
+                    fan = cursor;
+            if (fan == std::numeric_limits<std::size_t>::max())
+                break;
+        }
+        assert(std::size(order) == triangles);
+        return order;
+    }
+
+    void optimize_vertex_cache(std::span<std::uint32_t> indices, std::size_t vertex_count, std::size_t cache_size)
+    {
+        assert(std::size(indices) % 3 == 0);
+
+        const std::vector<std::uint32_t> source(std::cbegin(indices), std::cend(indices));
+        const auto                       order = _tipsify(source, vertex_count, cache_size);
+        for (std::size_t i = 0; i < std::size(order); ++i)
+            std::copy_n(std::cbegin(source) + 3 * order[i], 3, std::begin(indices) + 3 * i);
+    }
+
+    // new position of each element, in order of first use, followed by the unused ones;
+    // index is called with the position of each reference in order
+    template <class Function>
+    [[nodiscard]] std::vector<std::size_t> _first_use_order(std::size_t count, std::size_t references, Function index)
+    {
+        constexpr auto unused = std::numeric_limits<std::size_t>::max();
+
+        std::vector<std::size_t> remap(count, unused);
+        std::size_t              next = 0;
+        for (std::size_t i = 0; i < references; ++i)
+            if (const auto e = index(i); e < count && remap[e] == unused)
+                remap[e] = next++;
+        for (auto& r : remap)
+            if (r == unused)
+                r = next++;
+        return remap;
+    }
+
+    // move each element to its new position
+    template <class Container>
+    void _permute(Container& v, const std::vector<std::size_t>& remap)
+    {
+        Container p(std::size(v), v.get_allocator());
+        for (std::size_t i = 0; i < std::size(v); ++i)
+            p[remap[i]] = std::move(v[i]);
+        v = std::move(p);
+    }
+
+    template <class Value>
+    void optimize_vertex_fetch(IndexedMesh<Value>& m)
+    {
+        const auto remap = _first_use_order(std::size(m.vertices), std::size(m.indices),
+            [&](std::size_t i) { return static_cast<std::size_t>(m.indices[i]); });
+        _permute(m.vertices, remap);
+        for (auto& i : m.indices)
+            i = static_cast<std::uint32_t>(remap[i]);
+    }
+
+
+    // ids of the distinct v/vt/vn triplets of a mesh
+    template <class Data>
+    [[nodiscard]] std::vector<std::uint32_t> _vertex_ids(const Data& d, const VertexCacheConfig& c, std::size_t& count)
+    {
+        auto welded = weld_vertices(d, { .zero_based_indices = c.zero_based_indices });
+        count       = std::size(welded.vertices);
+        return std::move(welded.indices);
+    }
+
+    template <class Data>
+    [[nodiscard]] VertexCacheStats _analyze_vertex_cache(const Data& d, const VertexCacheConfig& c)
+    {
+        std::size_t count = 0;
+        const auto  ids   = _vertex_ids(d, c, count);
+        return analyze_vertex_cache(ids, count, c.cache_size);
+    }
+
+    template <class Value, class Index>
+    VertexCacheStats analyze_vertex_cache(const MeshData<Value, Index>& d, const VertexCacheConfig& c)
+    {
+        return _analyze_vertex_cache(d, c);
+    }
+
+    template <class Value, class Index>
+    VertexCacheStats analyze_vertex_cache(const SoaMeshData<Value, Index>& d, const VertexCacheConfig& c)
+    {
+        return _analyze_vertex_cache(d, c);
+    }
+
+    template <class Value, class Index>
+    std::vector<std::size_t> optimize_vertex_cache(MeshData<Value, Index>& d, const VertexCacheConfig& c)
+    {
+        std::size_t count = 0;
+        const auto  ids   = _vertex_ids(d, c, count);
+        const auto  order = _tipsify(ids, count, c.cache_size);
+
+        decltype(d.faces) faces(std::size(order), d.faces.get_allocator());
+        std::transform(std::cbegin(order), std::cend(order), std::begin(faces), [&](auto t) { return d.faces[t]; });
+        d.faces = std::move(faces);
+        return { std::cbegin(order), std::cend(order) };
+    }
+
+    template <class Value, class Index>
+    std::vector<std::size_t> optimize_vertex_cache(SoaMeshData<Value, Index>& d, const VertexCacheConfig& c)
+    {
+        std::size_t count = 0;
+        const auto  ids   = _vertex_ids(d, c, count);
+        const auto  order = _tipsify(ids, count, c.cache_size);
+
+        for (auto indices : { &d.v_indices, &d.vt_indices, &d.vn_indices })
+        {
+            std::pmr::vector<Index> faces(std::size(*indices), indices->get_allocator());
+            for (std::size_t i = 0; i < std::size(order); ++i)
+                std::copy_n(std::cbegin(*indices) + 3 * order[i], 3, std::begin(faces) + 3 * i);
+            *indices = std::move(faces);
+        }
+        return { std::cbegin(order), std::cend(order) };
+    }
+
+    // position of an element in its list, or count for missing and invalid indices
+    template <class Index>
+    [[nodiscard]] std::size_t _position(Index i, std::size_t count, bool zero_based) noexcept
+    {
+        if (zero_based)
+            return (i < count) ? static_cast<std::size_t>(i) : count;
+        return (i != 0 && i <= count) ? static_cast<std::size_t>(i) - 1 : count;
+    }
+
+    // check that indices are either missing or refer to existing elements
+    template <class Index>
+    void _check_indices(const std::vector<Index*>& refs, std::size_t count, bool zero_based)
+    {
+        const auto missing = zero_based ? std::numeric_limits<Index>::max() : Index{ 0 };
+        for (const auto i : refs)
+            if (*i != missing && _position(*i, count, zero_based) == count)
+                throw std::out_of_range{ "Face index out of range" };
+    }
+
+    // new position of each element of a list in order of first use, after updating the indices that refer to it
+    template <class Index>
+    [[nodiscard]] std::vector<std::size_t> _remap_by_first_use(
+        std::size_t count, const std::vector<Index*>& refs, bool zero_based)
+    {
+        const auto remap = _first_use_order(
+            count, std::size(refs), [&](std::size_t i) { return _position(*refs[i], count, zero_based); });
+
+        const auto base = zero_based ? 0 : 1;
+        for (auto i : refs)
+            if (const auto e = _position(*i, count, zero_based); e != count)
+                *i = static_cast<Index>(remap[e] + base);
+        return remap;
+    }
+
+    template <class Index>
+    [[nodiscard]] std::vector<Index*> _references(std::pmr::vector<Index>& indices)
+    {
+        std::vector<Index*> refs(std::size(indices));
+        std::transform(std::begin(indices), std::end(indices), std::begin(refs), [](auto& i) { return &i; });
+        return refs;
+    }
+
+    // vertex fetch reordering of a mesh and of the polygon triplets that refer to the same elements
+    template <class Value, class Index>
+    void _optimize_vertex_fetch(MeshData<Value, Index>& d, std::span<Triplet<Index>> polygons, const VertexCacheConfig& c)
+    {
+        std::vector<Index*> v, vt, vn;
+        const auto          add = [&](Triplet<Index>& t) { v.push_back(&t.v), vt.push_back(&t.vt), vn.push_back(&t.vn); };
+        for (auto& f : d.faces)
+            for (auto& t : f.triplets)
+                add(t);
+        for (auto& t : polygons) // used after the triangles, so they don't change the order
+            add(t);
+        _check_indices(v, std::size(d.v), c.zero_based_indices);
+        _check_indices(vt, std::size(d.vt), c.zero_based_indices);
+        _check_indices(vn, std::size(d.vn), c.zero_based_indices);
+
+        _permute(d.v, _remap_by_first_use(std::size(d.v), v, c.zero_based_indices));
+        _permute(d.vt, _remap_by_first_use(std::size(d.vt), vt, c.zero_based_indices));
+        _permute(d.vn, _remap_by_first_use(std::size(d.vn), vn, c.zero_based_indices));
+    }
+
+    template <class Value, class Index>
+    void _optimize_vertex_fetch(SoaMeshData<Value, Index>& d, std::span<Triplet<Index>> polygons, const VertexCacheConfig& c)
+    {
+        auto v  = _references(d.v_indices);
+        auto vt = _references(d.vt_indices);
+        auto vn = _references(d.vn_indices);
+        for (auto& t : polygons) // used after the triangles, so they don't change the order
+            v.push_back(&t.v), vt.push_back(&t.vt), vn.push_back(&t.vn);
+        _check_indices(v, std::size(d.x), c.zero_based_indices);
+        _check_indices(vt, std::size(d.uv) / 2, c.zero_based_indices);
+        _check_indices(vn, std::size(d.nx), c.zero_based_indices);
+
+        const auto v_remap = _remap_by_first_use(std::size(d.x), v, c.zero_based_indices);
+        for (auto component : { &d.x, &d.y, &d.z })
+            _permute(*component, v_remap);
+
+        const auto vt_remap = _remap_by_first_use(std::size(d.uv) / 2, vt, c.zero_based_indices);
+        decltype(d.uv) uv(std::size(d.uv), d.uv.get_allocator());
+        for (std::size_t i = 0; i < std::size(vt_remap); ++i)
+            std::copy_n(std::cbegin(d.uv) + 2 * i, 2, std::begin(uv) + 2 * vt_remap[i]);
+        d.uv = std::move(uv);
+
+        const auto vn_remap = _remap_by_first_use(std::size(d.nx), vn, c.zero_based_indices);
+        for (auto component : { &d.nx, &d.ny, &d.nz })
+            _permute(*component, vn_remap);
+    }
+
+    template <class Value, class Index>
+    void optimize_vertex_fetch(MeshData<Value, Index>& d, const VertexCacheConfig& c)
+    {
+        _optimize_vertex_fetch(d, std::span<Triplet<Index>>{}, c);
+    }
+
+    template <class Value, class Index>
+    void optimize_vertex_fetch(SoaMeshData<Value, Index>& d, const VertexCacheConfig& c)
+    {
+        _optimize_vertex_fetch(d, std::span<Triplet<Index>>{}, c);
+    }
+
+    template <class Value, class Index>
+    void optimize_vertex_fetch(ObjParserResult<Value, Index>& r, const VertexCacheConfig& c)
+    {
+        _optimize_vertex_fetch(r.data, std::span{ r.polygons.triplets }, c);
+    }
+
+    template <class Value, class Index>
+    void optimize_vertex_fetch(ObjParserSoaResult<Value, Index>& r, const VertexCacheConfig& c)
+    {
+        _optimize_vertex_fetch(r.data, std::span{ r.polygons.triplets }, c);
+    }
+
+    // face reordering of a parser result, along with the lists that refer to the faces
+    template <class Result>
+    [[nodiscard]] std::vector<std::size_t> _optimize_vertex_cache(Result& r, const VertexCacheConfig& c)
+    {
+        auto order = optimize_vertex_cache(r.data, c);
+        reorder_object_faces(r.objects, order);
+        reorder_smoothing_groups(r.smoothing_groups, order);
+
+        // the triangles of each polygon are no longer consecutive
+        r.polygons.offsets.clear();
+        r.polygons.triplets.clear();
+        r.polygons.faces.clear();
+        return order;
+    }
+
+    template <class Value, class Index>
+    std::vector<std::size_t> optimize_vertex_cache(ObjParserResult<Value, Index>& r, const VertexCacheConfig& c)
+    {
+        return _optimize_vertex_cache(r, c);
+    }
+
+    template <class Value, class Index>
+    std::vector<std::size_t> optimize_vertex_cache(ObjParserSoaResult<Value, Index>& r, const VertexCacheConfig& c)
+    {
+        return _optimize_vertex_cache(r, c);
+    }
+
+    template <class Index>
+    void reorder_object_faces(std::pmr::vector<Object<Index>>& objects, std::span<const std::size_t> order)
+    {
+        std::vector<std::size_t> position(std::size(order)); // new position of each face
+        for (std::size_t i = 0; i < std::size(order); ++i)
+            position[order[i]] = i;
+
+        for (auto& o : objects)
+        {
+            for (auto& f : o.faces)
+                f = static_cast<Index>(position[static_cast<std::size_t>(f)]);
+            std::sort(std::begin(o.faces), std::end(o.faces));
+        }
+    }
+
+    template <class Index>
+    void reorder_smoothing_groups(std::pmr::vector<SmoothingGroup<Index>>& groups, std::span<const std::size_t> order)
+    {
+        const auto faces = std::size(order);
+
+        // group of each face at its previous position, zero before the first run
+        std::vector<std::uint32_t> previous(faces, 0);
+        for (std::size_t i = 0; i < std::size(groups); ++i)
+        {
+            const auto first = std::min(static_cast<std::size_t>(groups[i].first_face), faces);
+            const auto last  = (i + 1 < std::size(groups)) ? std::min(static_cast<std::size_t>(groups[i + 1].first_face), faces) : faces;
+            std::fill(std::begin(previous) + first, std::begin(previous) + last, groups[i].id);
+        }
+
+        groups.clear();
+        std::uint32_t group = 0;
+        for (std::size_t i = 0; i < faces; ++i)
+            if (const auto g = previous[order[i]]; g != group)
+            {
+                groups.push_back({ static_cast<Index>(i), g });
+                group = g;
+            }
+    }
+
+
+    // explicit instantiations for the supported value and index types
+
+#define OBJCPP_INSTANTIATE_VERTEX_CACHE(Value, Index)                                                                 \
+    template VertexCacheStats         analyze_vertex_cache(const MeshData<Value, Index>&, const VertexCacheConfig&);    \
+    template VertexCacheStats         analyze_vertex_cache(const SoaMeshData<Value, Index>&, const VertexCacheConfig&); \
+    template std::vector<std::size_t> optimize_vertex_cache(MeshData<Value, Index>&, const VertexCacheConfig&);         \
+    template std::vector<std::size_t> optimize_vertex_cache(SoaMeshData<Value, Index>&, const VertexCacheConfig&);      \
+    template void                     optimize_vertex_fetch(MeshData<Value, Index>&, const VertexCacheConfig&);         \
+    template void                     optimize_vertex_fetch(SoaMeshData<Value, Index>&, const VertexCacheConfig&);         \
+    template std::vector<std::size_t> optimize_vertex_cache(ObjParserResult<Value, Index>&, const VertexCacheConfig&);    \
+    template std::vector<std::size_t> optimize_vertex_cache(ObjParserSoaResult<Value, Index>&, const VertexCacheConfig&); \
+    template void                     optimize_vertex_fetch(ObjParserResult<Value, Index>&, const VertexCacheConfig&);    \
+    template void                     optimize_vertex_fetch(ObjParserSoaResult<Value, Index>&, const VertexCacheConfig&);
+
+    OBJCPP_INSTANTIATE_VERTEX_CACHE(float, std::uint16_t)
+    OBJCPP_INSTANTIATE_VERTEX_CACHE(float, std::uint32_t)
+    OBJCPP_INSTANTIATE_VERTEX_CACHE(float, std::uint64_t)
+    OBJCPP_INSTANTIATE_VERTEX_CACHE(double, std::uint16_t)
+    OBJCPP_INSTANTIATE_VERTEX_CACHE(double, std::uint32_t)
+    OBJCPP_INSTANTIATE_VERTEX_CACHE(double, std::uint64_t)
+
+    template void optimize_vertex_fetch(IndexedMesh<float>&);
+    template void optimize_vertex_fetch(IndexedMesh<double>&);
+
+    template void reorder_object_faces(std::pmr::vector<Object<std::uint16_t>>&, std::span<const std::size_t>);
+    template void reorder_object_faces(std::pmr::vector<Object<std::uint32_t>>&, std::span<const std::size_t>);
+    template void reorder_object_faces(std::pmr::vector<Object<std::uint64_t>>&, std::span<const std::size_t>);
+
+    template void reorder_smoothing_groups(std::pmr::vector<SmoothingGroup<std::uint16_t>>&, std::span<const std::size_t>);
+    template void reorder_smoothing_groups(std::pmr::vector<SmoothingGroup<std::uint32_t>>&, std::span<const std::size_t>);
+    template void reorder_smoothing_groups(std::pmr::vector<SmoothingGroup<std::uint64_t>>&, std::span<const std::size_t>);
+
+#undef OBJCPP_INSTANTIATE_VERTEX_CACHE
+
+} // namespace obj
\ No newline at end of file
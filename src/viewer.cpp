@@ -1,13 +1,19 @@
 #include "obj-cpp/obj.hpp"
 
+#include <charconv>
+#include <cstdlib>
 #include <filesystem>
-#include <fstream>
 #include <iostream>
+#include <string_view>
+#include <system_error>
 #include <variant>
+#include <vector>
 
 constexpr const auto helper = "Viewer of .obj files\n"
                               "(built on " __DATE__ ")\n"
-                              "Usage: drako-obj-viewer [FILE ...]\n";
+                              "Usage: drako-obj-viewer [--jobs N] [FILE ...]\n"
+                              "\n"
+                              "\t--jobs N \tloads the files on N threads, 0 for one for each core (default 1)\n";
 
 /*
 constexpr const auto helper = "Drako obj visualizer (built on " __DATE__ " with " DRAKO_CC_VERSION ")\n"
@@ -43,42 +49,54 @@ int main(const int argc, const char* argv[])
         std::exit(EXIT_SUCCESS);
     }
 
-    const obj::ObjParserConfig config{
-        .expected_object_count   = 1,
-        .expected_vertex_count   = 1000,
-        .expected_triangle_count = 1000 * 3
+    obj::BatchConfig config{
+        .obj = { .expected_object_count   = 1,
+                 .expected_vertex_count   = 1000,
+                 .expected_triangle_count = 1000 * 3 },
+        .thread_count = 1
     };
 
+    std::vector<std::filesystem::path> paths;
     for (auto i = 1; i < argc; ++i)
     {
-        try
+        if (std::string_view{ argv[i] } == "--jobs")
         {
-            const std::filesystem::path path{ argv[i] };
-            std::ifstream               file{ path };
-            std::string                 source{ std::istreambuf_iterator(file), {} };
+            const std::string_view jobs = (i + 1 < argc) ? argv[++i] : "";
 
-            std::cout << "Parsing " << path << " ...\n";
-            const auto result = obj::parse_as_obj(source, config);
-            std::cout << "Done.\n";
-
-            /*
-            std::cout << "Found " << std::size(result.objects) << " objects:\n";
-            for (const auto& object : result.objects)
+            const auto [end, ec] = std::from_chars(std::data(jobs), std::data(jobs) + std::size(jobs), config.thread_count);
+            if (std::empty(jobs) || ec != std::errc{} || end != std::data(jobs) + std::size(jobs))
             {
-                std::cout << '\t' << object.name << '\n';
+                std::cerr << "Invalid number of jobs: '" << jobs << "'\n";
+                std::exit(EXIT_FAILURE);
             }
+        }
+        else
+            paths.emplace_back(argv[i]);
+    }
+
+    std::cout << "Parsing " << std::size(paths) << " files ...\n";
+    const auto results = obj::load_batch(paths, config);
+    std::cout << "Done.\n";
 
-            std::cout << "Found " << std::size(result.groups) << " groups:\n";
-            for (const auto& group : result.groups)
+    for (std::size_t i = 0; i < std::size(paths); ++i)
+    {
+        try
+        {
+            std::cout << paths[i] << '\n';
+            if (results[i].error)
+                std::rethrow_exception(results[i].error);
+
+            if (const auto* result = std::get_if<obj::ObjParserResult<>>(&results[i].content))
             {
-                std::cout << '\t' << group.name << '\n';
+                std::cout << "# vertices:  " << std::size(result->data.v) << '\n'
+                          << "# normals:   " << std::size(result->data.vn) << '\n'
+                          << "# texcoords: " << std::size(result->data.vt) << '\n'
+                          << "# faces:     " << std::size(result->data.faces) << '\n';
+            }
+            else if (const auto* materials = std::get_if<obj::MtlParserResult>(&results[i].content))
+            {
+                std::cout << "# materials: " << std::size(materials->materials) << '\n';
             }
-            */
-
-            std::cout << "# vertices:  " << std::size(result.data.v) << '\n'
-                      << "# normals:   " << std::size(result.data.vn) << '\n'
-                      << "# texcoords: " << std::size(result.data.vt) << '\n'
-                      << "# faces:     " << std::size(result.data.faces) << '\n';
 
             ++stats.success_count;
         }
@@ -89,7 +107,7 @@ int main(const int argc, const char* argv[])
         }
     }
 
-    std::cout << "Arguments:\t" << argc - 1 << '\n'
+    std::cout << "Files:    \t" << std::size(paths) << '\n'
               << "Completed:\t" << stats.success_count << '\n'
               << "Failed:   \t" << stats.failure_count << '\n';
 }
\ No newline at end of file
@@ -0,0 +1,597 @@
+#include "obj-cpp/welding.hpp"
+
+#include "obj-cpp/parallel.hpp"
+
+#include "geometry.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <future>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace obj
+{
+    // vertex of a face, as the triplet of indices of its attributes
+    template <class Value, class Index>
+    [[nodiscard]] Triplet<Index> _corner(const MeshData<Value, Index>& d, std::size_t i) noexcept
+    {
+        return d.faces[i / 3].triplets[i % 3];
+    }
+
+    template <class Value, class Index>
+    [[nodiscard]] Triplet<Index> _corner(const SoaMeshData<Value, Index>& d, std::size_t i) noexcept
+    {
+        return { d.v_indices[i], d.vt_indices[i], d.vn_indices[i] };
+    }
+
+    // position of an element in its list, or count if the index refers to a missing one
+    template <class Index>
+    [[nodiscard]] std::size_t _element(Index i, std::size_t count, bool zero_based)
+    {
+        const auto missing = zero_based ? (i == std::numeric_limits<Index>::max()) : (i == 0);
+        if (missing)
+            return count;
+
+        const auto e = zero_based ? static_cast<std::size_t>(i) : static_cast<std::size_t>(i) - 1;
+        if (e >= count)
+            throw std::out_of_range{ "Face index out of range" };
+        return e;
+    }
+
+    // attributes of a vertex of a face
+    template <class Value, class Index>
+    [[nodiscard]] PackedVertex<Value> _pack(const MeshData<Value, Index>& d, const Triplet<Index>& t, bool zero_based)
+    {
+        PackedVertex<Value> p{};
+
+        const auto v = _element(t.v, std::size(d.v), zero_based);
+        if (v == std::size(d.v))
+            throw std::out_of_range{ "Face vertex without geometric vertex" };
+        p.position = { d.v[v].x, d.v[v].y, d.v[v].z };
+
+        if (const auto vn = _element(t.vn, std::size(d.vn), zero_based); vn != std::size(d.vn))
+            p.normal = { d.vn[vn].x, d.vn[vn].y, d.vn[vn].z };
+        if (const auto vt = _element(t.vt, std::size(d.vt), zero_based); vt != std::size(d.vt))
+            p.texcoord = { d.vt[vt].u, d.vt[vt].v };
+        return p;
+    }
+
+    template <class Value, class Index>
+    [[nodiscard]] PackedVertex<Value> _pack(const SoaMeshData<Value, Index>& d, const Triplet<Index>& t, bool zero_based)
+    {
+        PackedVertex<Value> p{};
+
+        const auto v = _element(t.v, std::size(d.x), zero_based);
+        if (v == std::size(d.x))
+            throw std::out_of_range{ "Face vertex without geometric vertex" };
+        p.position = { d.x[v], d.y[v], d.z[v] };
+
+        if (const auto vn = _element(t.vn, std::size(d.nx), zero_based); vn != std::size(d.nx))
+            p.normal = { d.nx[vn], d.ny[vn], d.nz[vn] };
+        if (const auto vt = _element(t.vt, std::size(d.uv) / 2, zero_based); vt != std::size(d.uv) / 2)
+            p.texcoord = { d.uv[2 * vt], d.uv[2 * vt + 1] };
+        return p;
+    }
+
+    // mix the indices of a triplet, so that both the low and the high bits are well distributed
+    template <class Index>
+    [[nodiscard]] constexpr std::uint64_t _hash(const Triplet<Index>& t) noexcept
+    {
+        auto h = static_cast<std::uint64_t>(t.v);
+        h ^= static_cast<std::uint64_t>(t.vt) * 0x9E3779B97F4A7C15;
+        h ^= static_cast<std::uint64_t>(t.vn) * 0xC2B2AE3D27D4EB4F;
+        h ^= h >> 30; // splitmix64 finalizer
+        h *= 0xBF58476D1CE4E5B9;
+        h ^= h >> 27;
+        h *= 0x94D049BB133111EB;
+        h ^= h >> 31;
+        return h;
+    }
+
+    // open addressing hash table from triplets to vertex ids, with linear probing
+    template <class Index>
+    class _TripletTable
+    {
+    public:
+        static constexpr std::uint32_t npos = std::numeric_limits<std::uint32_t>::max();
+
+        explicit _TripletTable(std::size_t expected)
+        {
+            _slots.resize(std::bit_ceil(std::max<std::size_t>(2 * expected, 16)));
+        }
+
+        // id of a triplet, inserted with the next free id if missing
+        [[nodiscard]] std::pair<std::uint32_t, bool> insert(const Triplet<Index>& t, std::uint64_t h)
+        {
+            if (2 * (_size + 1) > std::size(_slots)) // load factor kept below 1/2
+                _grow();
+
+            const auto mask = std::size(_slots) - 1;
+            for (auto i = static_cast<std::size_t>(h) & mask;; i = (i + 1) & mask)
+            {
+                auto& s = _slots[i];
+                if (s.id == npos)
+                {
+                    if (_size == npos)
+                        throw std::length_error{ "Too many unique vertices for 32-bit indices" };
+                    s = { t, static_cast<std::uint32_t>(_size++) };
+                    return { s.id, true };
+                }
+                if (s.key == t)
+                    return { s.id, false };
+            }
+        }
+
+    private:
+        struct _Slot
+        {
+            Triplet<Index> key{};
+            std::uint32_t  id = npos;
+        };
+
+        std::vector<_Slot> _slots;
+        std::size_t        _size = 0;
+
+        void _grow()
+        {
+            std::vector<_Slot> old(2 * std::size(_slots));
+            std::swap(old, _slots);
+
+            const auto mask = std::size(_slots) - 1;
+            for (const auto& s : old)
+                if (s.id != npos)
+                {
+                    auto i = static_cast<std::size_t>(_hash(s.key)) & mask;
+                    while (_slots[i].id != npos)
+                        i = (i + 1) & mask;
+                    _slots[i] = s;
+                }
+        }
+    };
+
+    template <class Value, class Index, class Data>
+    [[nodiscard]] IndexedMesh<Value> _weld_serial(const Data& d, const WeldConfig& c)
+    {
+        const auto corners = _corner_count(d);
+
+        IndexedMesh<Value> mesh;
+        mesh.indices.reserve(corners);
+
+        _TripletTable<Index> table{ corners / 8 }; // grown as needed, most meshes share each vertex among many faces
+        for (std::size_t i = 0; i < corners; ++i)
+        {
+            const auto t              = _corner(d, i);
+            const auto [id, inserted] = table.insert(t, _hash(t));
+            if (inserted)
+                mesh.vertices.push_back(_pack(d, t, c.zero_based_indices));
+            mesh.indices.push_back(id);
+        }
+        return mesh;
+    }
+
+    // Triplets are split among the threads by their hash, so that each one has its own table.
+    // Every table assigns ids in order of first use, then the first uses of all tables
+    // are ranked by position to get the same order of the serial implementation.
+    template <class Value, class Index, class Data>
+    [[nodiscard]] IndexedMesh<Value> _weld_parallel(const Data& d, const WeldConfig& c, const std::vector<std::size_t>& bounds)
+    {
+        const auto corners    = _corner_count(d);
+        const auto partitions = std::size(bounds) - 1;
+        assert(partitions <= std::numeric_limits<std::uint8_t>::max());
+
+        std::vector<std::uint8_t> partition(corners);
+
+        // partition of each corner, and number of corners of each range in each partition
+        const auto sizes = _map_ranges(bounds, [&](std::size_t first, std::size_t last) {
+            std::vector<std::size_t> n(partitions);
+            for (auto i = first; i < last; ++i)
+            {
+                partition[i] = static_cast<std::uint8_t>((_hash(_corner(d, i)) >> 32) % partitions);
+                ++n[partition[i]];
+            }
+            return n;
+        });
+
+        // corners grouped by partition, each group in order of position, so that every
+        // table only visits its own corners
+        std::vector<std::size_t>              members(corners);
+        std::vector<std::size_t>              groups(partitions + 1);
+        std::vector<std::vector<std::size_t>> starts(partitions, std::vector<std::size_t>(partitions));
+        for (std::size_t p = 0, next = 0; p < partitions; ++p)
+        {
+            groups[p] = next;
+            for (std::size_t r = 0; r < partitions; ++r)
+            {
+                starts[r][p] = next;
+                next += sizes[r][p];
+            }
+        }
+        groups[partitions] = corners;
+        (void)_map_ranges(bounds, [&](std::size_t first, std::size_t last) {
+            const auto range = std::distance(std::cbegin(bounds), std::lower_bound(std::cbegin(bounds), std::cend(bounds), first));
+            auto       next  = starts[static_cast<std::size_t>(range)];
+            for (auto i = first; i < last; ++i)
+                members[next[partition[i]]++] = i;
+            return true;
+        });
+
+        // id of each corner in the table of its partition, then its final index
+        std::vector<std::uint32_t> ids(corners);
+        std::vector<std::uint8_t>  first_use(corners);
+
+        std::vector<std::future<std::size_t>> tables;
+        for (std::size_t p = 0; p < partitions; ++p)
+            tables.push_back(std::async(std::launch::async, [&, p] {
+                _TripletTable<Index> table{ corners / (8 * partitions) };
+                std::size_t          unique = 0;
+                for (auto k = groups[p]; k < groups[p + 1]; ++k)
+                {
+                    const auto i              = members[k];
+                    const auto t              = _corner(d, i);
+                    const auto [id, inserted] = table.insert(t, _hash(t));
+                    ids[i]                    = id;
+                    first_use[i]              = inserted;
+                    unique += inserted;
+                }
+                return unique;
+            }));
+
+        std::vector<std::vector<std::uint32_t>> remap(partitions); // from table ids to final indices
+        std::size_t                             unique = 0;
+        for (std::size_t p = 0; p < partitions; ++p)
+        {
+            remap[p].resize(tables[p].get());
+            unique += std::size(remap[p]);
+        }
+        if (unique > std::numeric_limits<std::uint32_t>::max())
+            throw std::length_error{ "Too many unique vertices for 32-bit indices" };
+
+        // final index of a vertex is the number of first uses that precede it
+        const auto counts = _map_ranges(bounds, [&](std::size_t first, std::size_t last) {
+            return static_cast<std::size_t>(std::count(std::begin(first_use) + first, std::begin(first_use) + last, 1));
+        });
+        std::vector<std::size_t> offsets(partitions);
+        std::exclusive_scan(std::cbegin(counts), std::cend(counts), std::begin(offsets), std::size_t{ 0 });
+
+        IndexedMesh<Value> mesh;
+        mesh.vertices.resize(unique);
+        (void)_map_ranges(bounds, [&](std::size_t first, std::size_t last) {
+            const auto range = std::distance(std::cbegin(bounds), std::lower_bound(std::cbegin(bounds), std::cend(bounds), first));
+            auto       next  = offsets[static_cast<std::size_t>(range)];
+            for (auto i = first; i < last; ++i)
+                if (first_use[i])
+                {
+                    remap[partition[i]][ids[i]] = static_cast<std::uint32_t>(next);
+                    mesh.vertices[next++]       = _pack(d, _corner(d, i), c.zero_based_indices);
+                }
+            return true;
+        });
+
+        (void)_map_ranges(bounds, [&](std::size_t first, std::size_t last) {
+            for (auto i = first; i < last; ++i)
+                ids[i] = remap[partition[i]][ids[i]];
+            return true;
+        });
+        mesh.indices = std::move(ids);
+        return mesh;
+    }
+
+    template <class Value, class Index, class Data>
+    [[nodiscard]] IndexedMesh<Value> _weld_vertices(const Data& d, const WeldConfig& c)
+    {
+        const auto threads = std::min<std::size_t>(_thread_count(c.thread_count), std::numeric_limits<std::uint8_t>::max());
+        if (const auto bounds = _split_range(_corner_count(d), threads, 1 << 16); std::size(bounds) > 2)
+            return _weld_parallel<Value, Index>(d, c, bounds);
+        return _weld_serial<Value, Index>(d, c);
+    }
+
+    template <class Value, class Index>
+    IndexedMesh<Value> weld_vertices(const MeshData<Value, Index>& d, const WeldConfig& c)
+    {
+        return _weld_vertices<Value, Index>(d, c);
+    }
+
+    template <class Value, class Index>
+    IndexedMesh<Value> weld_vertices(const SoaMeshData<Value, Index>& d, const WeldConfig& c)
+    {
+        return _weld_vertices<Value, Index>(d, c);
+    }
+
+
+    // coordinates of a geometric vertex
+    template <class Value, class Index>
+    [[nodiscard]] std::array<double, 3> _point(const MeshData<Value, Index>& d, std::size_t i) noexcept
+    {
+        return { d.v[i].x, d.v[i].y, d.v[i].z };
+    }
+
+    template <class Value, class Index>
+    [[nodiscard]] std::array<double, 3> _point(const SoaMeshData<Value, Index>& d, std::size_t i) noexcept
+    {
+        return { d.x[i], d.y[i], d.z[i] };
+    }
+
+    template <class Value, class Index>
+    [[nodiscard]] std::size_t _point_count(const MeshData<Value, Index>& d) noexcept
+    {
+        return std::size(d.v);
+    }
+
+    template <class Value, class Index>
+    [[nodiscard]] std::size_t _point_count(const SoaMeshData<Value, Index>& d) noexcept
+    {
+        return std::size(d.x);
+    }
+
+    // keep the vertices at the given positions, in the same order
+    template <class Value, class Index>
+    void _keep_points(MeshData<Value, Index>& d, const std::vector<std::uint32_t>& kept)
+    {
+        decltype(d.v) v(std::size(kept), d.v.get_allocator());
+        std::transform(std::cbegin(kept), std::cend(kept), std::begin(v), [&](auto i) { return d.v[i]; });
+        d.v = std::move(v);
+    }
+
+    template <class Value, class Index>
+    void _keep_points(SoaMeshData<Value, Index>& d, const std::vector<std::uint32_t>& kept)
+    {
+        for (auto c : { &d.x, &d.y, &d.z })
+        {
+            std::remove_reference_t<decltype(*c)> x(std::size(kept), c->get_allocator());
+            std::transform(std::cbegin(kept), std::cend(kept), std::begin(x), [&](auto i) { return (*c)[i]; });
+            *c = std::move(x);
+        }
+    }
+
+    // geometric vertex index of a face vertex, to be read and rewritten
+    template <class Value, class Index>
+    [[nodiscard]] Index& _corner_point(MeshData<Value, Index>& d, std::size_t i) noexcept
+    {
+        return d.faces[i / 3].triplets[i % 3].v;
+    }
+
+    template <class Value, class Index>
+    [[nodiscard]] Index& _corner_point(SoaMeshData<Value, Index>& d, std::size_t i) noexcept
+    {
+        return d.v_indices[i];
+    }
+
+    // cell of the hash grid that contains a coordinate, saturated for huge or invalid values
+    [[nodiscard]] std::int64_t _cell(double x, double size) noexcept
+    {
+        constexpr double limit = 1ll << 62;
+
+        const auto c = std::floor(x / size);
+        return (c == c) ? static_cast<std::int64_t>(std::clamp(c, -limit, limit)) : 0;
+    }
+
+    [[nodiscard]] constexpr std::uint64_t _hash_cell(std::int64_t x, std::int64_t y, std::int64_t z) noexcept
+    {
+        return _hash(Triplet<std::uint64_t>{ static_cast<std::uint64_t>(x), static_cast<std::uint64_t>(y),
+            static_cast<std::uint64_t>(z) });
+    }
+
+    // disjoint sets of vertices, safe for concurrent use, where each set is represented by its smallest vertex
+    class _ConcurrentSets
+    {
+    public:
+        explicit _ConcurrentSets(std::size_t n)
+            : _parent(n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+                _parent[i].store(static_cast<std::uint32_t>(i), std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] std::uint32_t find(std::uint32_t x) noexcept
+        {
+            for (auto p = _parent[x].load(); p != x; p = _parent[x].load())
+            {
+                const auto g = _parent[p].load();
+                _parent[x].compare_exchange_weak(p, g); // path halving, harmless if it fails
+                x = p;
+            }
+            return x;
+        }
+
+        void unite(std::uint32_t a, std::uint32_t b) noexcept
+        {
+            for (;;)
+            {
+                a = find(a);
+                b = find(b);
+                if (a == b)
+                    return;
+                if (a < b)
+                    std::swap(a, b);
+                // link the larger root under the smaller one, retrying if it stopped being a root
+                if (auto expected = a; _parent[a].compare_exchange_strong(expected, b))
+                    return;
+            }
+        }
+
+    private:
+        std::vector<std::atomic<std::uint32_t>> _parent;
+    };
+
+    // welding of a mesh and of the polygon triplets that refer to the same vertices
+    template <class Data, class Index>
+    [[nodiscard]] std::size_t _weld_positions(Data& d, std::span<Triplet<Index>> polygons, double epsilon, const WeldConfig& c)
+    {
+        if (!(epsilon >= 0))
+            throw std::invalid_argument{ "Negative or invalid welding tolerance" };
+
+        const auto n       = _point_count(d);
+        const auto corners = _corner_count(d);
+        if (n > std::numeric_limits<std::uint32_t>::max())
+            throw std::length_error{ "Too many vertices for welding" };
+
+        const auto vertex_bounds = _split_range(n, c.thread_count, 1 << 16);
+        const auto corner_bounds = _split_range(corners, c.thread_count, 1 << 16);
+
+        // indices are checked before changing anything
+        (void)_map_ranges(corner_bounds, [&](std::size_t first, std::size_t last) {
+            for (auto i = first; i < last; ++i)
+                (void)_element(_corner_point(d, i), n, c.zero_based_indices);
+            return true;
+        });
+        for (const auto& t : polygons)
+            (void)_element(t.v, n, c.zero_based_indices);
+
+        // vertices sorted by bucket of their grid cell, buckets may be shared by far cells
+        const auto                 size    = (epsilon > 0) ? epsilon : 1.0;
+        const auto                 buckets = std::bit_ceil(std::max<std::size_t>(n, 1));
+        std::vector<std::uint32_t> bucket(n);
+        std::vector<std::atomic<std::uint32_t>> offsets(buckets + 1);
+        (void)_map_ranges(vertex_bounds, [&](std::size_t first, std::size_t last) {
+            for (auto i = first; i < last; ++i)
+            {
+                const auto p = _point(d, i);
+                bucket[i]    = static_cast<std::uint32_t>(
+                    _hash_cell(_cell(p[0], size), _cell(p[1], size), _cell(p[2], size)) & (buckets - 1));
+                offsets[bucket[i] + 1].fetch_add(1, std::memory_order_relaxed);
+            }
+            return true;
+        });
+        for (std::size_t b = 1; b <= buckets; ++b)
+            offsets[b].store(offsets[b].load(std::memory_order_relaxed) + offsets[b - 1].load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+
+        // order within a bucket depends on scheduling, but doesn't affect the merged sets
+        std::vector<std::uint32_t> sorted(n);
+        {
+            std::vector<std::atomic<std::uint32_t>> cursor(buckets);
+            (void)_map_ranges(vertex_bounds, [&](std::size_t first, std::size_t last) {
+                for (auto i = first; i < last; ++i)
+                {
+                    const auto b = bucket[i];
+                    sorted[offsets[b].load(std::memory_order_relaxed) + cursor[b].fetch_add(1, std::memory_order_relaxed)] =
+                        static_cast<std::uint32_t>(i);
+                }
+                return true;
+            });
+        }
+
+        // each pair of close vertices is found by the one with the larger index
+        const auto      squared = epsilon * epsilon;
+        _ConcurrentSets sets{ n };
+        (void)_map_ranges(vertex_bounds, [&](std::size_t first, std::size_t last) {
+            for (auto i = first; i < last; ++i)
+            {
+                const auto p = _point(d, i);
+                const std::array<std::int64_t, 3> cell{ _cell(p[0], size), _cell(p[1], size), _cell(p[2], size) };
+                for (std::int64_t dx = -1; dx <= 1; ++dx)
+                    for (std::int64_t dy = -1; dy <= 1; ++dy)
+                        for (std::int64_t dz = -1; dz <= 1; ++dz)
+                        {
+                            const auto b = _hash_cell(cell[0] + dx, cell[1] + dy, cell[2] + dz) & (buckets - 1);
+                            for (auto k = offsets[b].load(std::memory_order_relaxed);
+                                 k != offsets[b + 1].load(std::memory_order_relaxed); ++k)
+                            {
+                                const auto j = sorted[k];
+                                if (j >= i)
+                                    continue;
+                                const auto q  = _point(d, j);
+                                const auto d2 = (p[0] - q[0]) * (p[0] - q[0]) + (p[1] - q[1]) * (p[1] - q[1]) +
+                                                (p[2] - q[2]) * (p[2] - q[2]);
+                                if (d2 <= squared)
+                                    sets.unite(static_cast<std::uint32_t>(i), j);
+                            }
+                        }
+            }
+            return true;
+        });
+
+        // kept vertices are the roots, numbered in list order
+        std::vector<std::uint32_t> remap(n);
+        const auto                 counts = _map_ranges(vertex_bounds, [&](std::size_t first, std::size_t last) {
+            std::size_t roots = 0;
+            for (auto i = first; i < last; ++i)
+            {
+                remap[i] = sets.find(static_cast<std::uint32_t>(i));
+                roots += (remap[i] == i);
+            }
+            return roots;
+        });
+
+        std::vector<std::uint32_t> kept;
+        kept.reserve(std::accumulate(std::cbegin(counts), std::cend(counts), std::size_t{ 0 }));
+        for (std::size_t i = 0; i < n; ++i)
+            if (remap[i] == i)
+            {
+                remap[i] = static_cast<std::uint32_t>(std::size(kept));
+                kept.push_back(static_cast<std::uint32_t>(i));
+            }
+            else
+                remap[i] = remap[remap[i]]; // roots precede the other vertices of their set
+
+        const auto base = c.zero_based_indices ? 0 : 1;
+        (void)_map_ranges(corner_bounds, [&](std::size_t first, std::size_t last) {
+            for (auto i = first; i < last; ++i)
+                if (auto& v = _corner_point(d, i); _element(v, n, c.zero_based_indices) != n)
+                    v = static_cast<std::remove_reference_t<decltype(v)>>(remap[v - base] + base);
+            return true;
+        });
+        for (auto& t : polygons)
+            if (_element(t.v, n, c.zero_based_indices) != n)
+                t.v = static_cast<Index>(remap[t.v - base] + base);
+
+        const auto removed = n - std::size(kept);
+        _keep_points(d, kept);
+        return removed;
+    }
+
+    template <class Value, class Index>
+    std::size_t weld_positions(MeshData<Value, Index>& d, Value epsilon, const WeldConfig& c)
+    {
+        return _weld_positions(d, std::span<Triplet<Index>>{}, epsilon, c);
+    }
+
+    template <class Value, class Index>
+    std::size_t weld_positions(SoaMeshData<Value, Index>& d, Value epsilon, const WeldConfig& c)
+    {
+        return _weld_positions(d, std::span<Triplet<Index>>{}, epsilon, c);
+    }
+
+    template <class Value, class Index>
+    std::size_t weld_positions(ObjParserResult<Value, Index>& r, Value epsilon, const WeldConfig& c)
+    {
+        return _weld_positions(r.data, std::span{ r.polygons.triplets }, epsilon, c);
+    }
+
+    template <class Value, class Index>
+    std::size_t weld_positions(ObjParserSoaResult<Value, Index>& r, Value epsilon, const WeldConfig& c)
+    {
+        return _weld_positions(r.data, std::span{ r.polygons.triplets }, epsilon, c);
+    }
+
+
+    // explicit instantiations for the supported value and index types
+
+#define OBJCPP_INSTANTIATE_WELDING(Value, Index)                                                         \
+    template IndexedMesh<Value> weld_vertices<Value, Index>(const MeshData<Value, Index>&, const WeldConfig&); \
+    template IndexedMesh<Value> weld_vertices<Value, Index>(const SoaMeshData<Value, Index>&, const WeldConfig&); \
+    template std::size_t        weld_positions<Value, Index>(MeshData<Value, Index>&, Value, const WeldConfig&);     \
+    template std::size_t        weld_positions<Value, Index>(SoaMeshData<Value, Index>&, Value, const WeldConfig&);  \
+    template std::size_t        weld_positions<Value, Index>(ObjParserResult<Value, Index>&, Value, const WeldConfig&); \
+    template std::size_t        weld_positions<Value, Index>(ObjParserSoaResult<Value, Index>&, Value, const WeldConfig&);
+
+    OBJCPP_INSTANTIATE_WELDING(float, std::uint16_t)
+    OBJCPP_INSTANTIATE_WELDING(float, std::uint32_t)
+    OBJCPP_INSTANTIATE_WELDING(float, std::uint64_t)
+    OBJCPP_INSTANTIATE_WELDING(double, std::uint16_t)
+    OBJCPP_INSTANTIATE_WELDING(double, std::uint32_t)
+    OBJCPP_INSTANTIATE_WELDING(double, std::uint64_t)
+
+#undef OBJCPP_INSTANTIATE_WELDING
+
+} // namespace obj
\ No newline at end of file
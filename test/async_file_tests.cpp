@@ -0,0 +1,118 @@
+#include "obj-cpp/async_file.hpp"
+#include "obj-cpp/obj_parser.hpp"
+#include "obj-cpp/reader.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <system_error>
+
+using namespace obj;
+
+namespace
+{
+    // source text of many lines, with line feeds at every offset of the blocks
+    [[nodiscard]] std::string _make_source(std::size_t faces)
+    {
+        std::stringstream s{};
+        for (std::size_t i = 0; i < faces + 2; ++i)
+            s << "v " << i << ".25 " << i % 7 << " -" << i * 3 << "\nvn 0 0 1\n";
+        s << "o mesh\n";
+        for (std::size_t i = 1; i <= faces; ++i)
+            s << "f " << i << "//" << i << ' ' << i + 1 << "//" << i << ' ' << i + 2 << "//" << i << '\n';
+        return s.str();
+    }
+
+    [[nodiscard]] std::filesystem::path _write_temp(const char* name, const std::string& content)
+    {
+        const auto    path = std::filesystem::temp_directory_path() / name;
+        std::ofstream out{ path, std::ios::binary };
+        out << content;
+        return path;
+    }
+} // namespace
+
+GTEST_TEST(AsyncFile, ReadAhead)
+{
+    const auto content = _make_source(5000);
+    const auto path    = _write_temp("obj-cpp-async.obj", content);
+
+    for (const auto io_uring : { true, false })
+    {
+        AsyncFile file{ path, { .block_size = 4096, .queue_depth = 4, .io_uring = io_uring } };
+        ASSERT_EQ(file.size(), std::size(content));
+        if (!io_uring)
+        {
+            EXPECT_FALSE(file.uses_io_uring());
+        }
+
+        // prefixes become available in order, each one at least as long as requested
+        for (std::size_t n = 0; n < std::size(content); n += 10'000)
+        {
+            const auto available = file.wait_for(n);
+            ASSERT_GE(available, n);
+            ASSERT_LE(available, std::size(content));
+            ASSERT_EQ(std::string_view(file.data(), available), std::string_view(content).substr(0, available));
+        }
+        EXPECT_EQ(file.view(), content);
+        EXPECT_EQ(file.data()[file.size()], '\0');
+    }
+
+    // the reads still in flight are completed before the buffer is released
+    {
+        AsyncFile file{ path, { .block_size = 1024, .queue_depth = 16 } };
+        EXPECT_GE(file.wait_for(1), 1);
+    }
+
+    const auto empty = _write_temp("obj-cpp-async-empty.obj", "");
+    EXPECT_EQ(AsyncFile{ empty }.view(), "");
+
+    EXPECT_THROW(AsyncFile{ "missing.obj" }, std::system_error);
+    std::filesystem::remove(path);
+    std::filesystem::remove(empty);
+}
+
+GTEST_TEST(AsyncFile, Parse)
+{
+    const auto content = _make_source(3000) + "f 1// 2// 3//"; // no line feed at the end
+    const auto path    = _write_temp("obj-cpp-async-parse.obj", content);
+    const auto parsed  = obj::parse_as_obj(content);
+
+    for (const auto io_uring : { true, false })
+    {
+        AsyncFile  file{ path, { .block_size = 4096, .io_uring = io_uring } };
+        const auto result = obj::parse_as_obj(file);
+        EXPECT_EQ(result.data.v, parsed.data.v);
+        EXPECT_EQ(result.data.vn, parsed.data.vn);
+        EXPECT_EQ(result.data.faces, parsed.data.faces);
+        EXPECT_EQ(result.objects, parsed.objects);
+    }
+
+    // relative indices and errors are resolved over the whole file, not over each block
+    const auto relative = _write_temp("obj-cpp-async-relative.obj", content + "\nf -1// -2// -3//\nv 1 2 x\n");
+    try
+    {
+        AsyncFile file{ relative, { .block_size = 4096 } };
+        (void)obj::parse_as_obj(file);
+        FAIL();
+    }
+    catch (const ParserError& e)
+    {
+        const auto line = std::count(std::cbegin(content), std::cend(content), '\n') + 3;
+        EXPECT_NE(std::string{ e.what() }.find("Line " + std::to_string(line) + ","), std::string::npos) << e.what();
+    }
+
+    // the parallel parser reads the whole file first
+    AsyncFile file{ path, { .block_size = 4096 } };
+    EXPECT_EQ(obj::parse_as_obj(file, { .thread_count = 4, .min_chunk_size = 4096 }).data.faces, parsed.data.faces);
+
+    const auto loaded = Reader{}.load_async("cube.obj", { .block_size = 64 });
+    EXPECT_EQ(loaded.data.faces, Reader{}.load("cube.obj").data.faces);
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(relative);
+}
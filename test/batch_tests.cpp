@@ -0,0 +1,115 @@
+#include "obj-cpp/batch.hpp"
+#include "obj-cpp/mapped_file.hpp"
+#include "obj-cpp/mtl_parser.hpp"
+#include "obj-cpp/obj_parser.hpp"
+#include "obj-cpp/thread_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <system_error>
+#include <vector>
+
+using namespace obj;
+
+GTEST_TEST(WorkStealingPool, RunAll)
+{
+    for (const auto threads : { 1, 4 })
+    {
+        WorkStealingPool pool{ static_cast<std::size_t>(threads) };
+        EXPECT_EQ(pool.thread_count(), threads);
+
+        std::vector<int>                   done(100);
+        std::vector<std::function<void()>> tasks;
+        for (std::size_t i = 0; i < std::size(done); ++i)
+            tasks.push_back([&, i] { done[i] += 1; });
+        pool.run_all(tasks);
+        EXPECT_EQ(done, std::vector<int>(100, 1));
+
+        // tasks can wait for their own tasks without blocking the pool
+        std::atomic<int>                   count = 0;
+        std::vector<std::function<void()>> nested(10, [&] {
+            std::vector<std::function<void()>> inner(10, [&] { ++count; });
+            pool.run_all(inner);
+        });
+        pool.run_all(nested);
+        EXPECT_EQ(count, 100);
+
+        // the first exception is thrown once every task is completed
+        count = 0;
+        std::vector<std::function<void()>> failing(20, [&] { ++count; });
+        failing[5] = [] { throw std::runtime_error{ "task" }; };
+        EXPECT_THROW(pool.run_all(failing), std::runtime_error);
+        EXPECT_EQ(count, 19);
+    }
+}
+
+GTEST_TEST(Batch, LoadBatch)
+{
+    // a file large enough to be split in chunks, whose tasks share the pool with the other files
+    const auto large = std::filesystem::temp_directory_path() / "obj-cpp-batch-large.obj";
+    {
+        std::ofstream out{ large, std::ios::binary };
+        for (auto i = 0; i < 3000; ++i)
+        {
+            out << "v " << i << " 0.5 " << -i << "\nvn 0 0 1\n";
+            if (i % 500 == 0)
+                out << "o object" << i << '\n';
+            if (i >= 2)
+                out << "f " << i - 1 << "//" << i << ' ' << i << "//" << i << ' ' << i + 1 << "//" << i << '\n';
+        }
+    }
+    const auto materials_path = std::filesystem::temp_directory_path() / "obj-cpp-batch.MTL";
+    {
+        std::ofstream out{ materials_path, std::ios::binary };
+        out << "newmtl first\nnewmtl second\n";
+    }
+    const auto invalid = std::filesystem::temp_directory_path() / "obj-cpp-batch-invalid.obj";
+    {
+        std::ofstream out{ invalid, std::ios::binary };
+        out << "v 1.0 2.0 3.0x\n";
+    }
+
+    const std::vector<std::filesystem::path> paths = { "cube.obj", materials_path, large, "missing.obj", invalid, "cube.obj" };
+    const BatchConfig config{ .obj = { .min_chunk_size = 4096 }, .thread_count = 4 };
+    const auto        results = obj::load_batch(paths, config);
+    ASSERT_EQ(std::size(results), std::size(paths));
+
+    for (const auto i : { 0, 2, 5 })
+    {
+        ASSERT_FALSE(results[i].error) << i;
+        const auto* result = std::get_if<ObjParserResult<>>(&results[i].content);
+        ASSERT_NE(result, nullptr) << i;
+
+        const auto expected = obj::parse_as_obj(MappedFile{ paths[i] }.view());
+        EXPECT_EQ(result->data.v, expected.data.v) << i;
+        EXPECT_EQ(result->data.vn, expected.data.vn) << i;
+        EXPECT_EQ(result->data.faces, expected.data.faces) << i;
+        EXPECT_EQ(result->objects, expected.objects) << i;
+    }
+
+    ASSERT_FALSE(results[1].error);
+    const auto* materials = std::get_if<MtlParserResult>(&results[1].content);
+    ASSERT_NE(materials, nullptr);
+    EXPECT_EQ(materials->materials, obj::parse_as_mtl(MappedFile{ paths[1] }.view()).materials);
+
+    EXPECT_TRUE(std::holds_alternative<std::monostate>(results[3].content));
+    EXPECT_THROW(std::rethrow_exception(results[3].error), std::system_error);
+    EXPECT_THROW(std::rethrow_exception(results[4].error), ParserError);
+
+    // the same pool can load further batches, with the same results
+    WorkStealingPool pool{ 2 };
+    const auto       reloaded = obj::load_batch(std::span{ paths }.subspan(2, 1), pool, config);
+    ASSERT_EQ(std::size(reloaded), 1);
+    EXPECT_EQ(std::get<ObjParserResult<>>(reloaded[0].content).data.faces,
+              std::get<ObjParserResult<>>(results[2].content).data.faces);
+
+    std::filesystem::remove(large);
+    std::filesystem::remove(materials_path);
+    std::filesystem::remove(invalid);
+}
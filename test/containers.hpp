@@ -0,0 +1,23 @@
+#pragma once
+#ifndef OBJCPP_TEST_CONTAINERS_HPP
+#define OBJCPP_TEST_CONTAINERS_HPP
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+// The containers of the results are std::pmr types, compared in the tests with the std::vector
+// of the expected elements. The operator is declared in the namespace of the elements,
+// so that argument-dependent lookup finds it from the assertions.
+namespace obj
+{
+    template <class T, class A, class B>
+        requires(!std::is_same_v<A, B>)
+    [[nodiscard]] bool operator==(const std::vector<T, A>& a, const std::vector<T, B>& b)
+    {
+        return std::ranges::equal(a, b);
+    }
+
+} // namespace obj
+
+#endif // !OBJCPP_TEST_CONTAINERS_HPP
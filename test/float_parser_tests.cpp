@@ -0,0 +1,84 @@
+#include "obj-cpp/float_parser.hpp"
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <charconv>
+#include <random>
+#include <string>
+
+using namespace obj;
+
+template <class Value>
+void expect_same_as_from_chars(const std::string& s)
+{
+    Value      expected{}, value{};
+    const auto e = std::from_chars(std::data(s), std::data(s) + std::size(s), expected, std::chars_format::general);
+    const auto r = parse_float(std::data(s), std::data(s) + std::size(s), value);
+
+    ASSERT_EQ(r.ec, e.ec) << s;
+    ASSERT_EQ(r.ptr, e.ptr) << s;
+    if (r.ec == std::errc{})
+    {
+        ASSERT_EQ(std::bit_cast<std::uint64_t>(static_cast<double>(value)),
+            std::bit_cast<std::uint64_t>(static_cast<double>(expected)))
+            << s;
+    }
+}
+
+GTEST_TEST(FloatParser, FixedAndScientific)
+{
+    for (const auto s : { "0", "-0", "0.0", "1", "-1", "1.", ".5", "-.5", "3.14159", "0.000001",
+             "1e-5", "1E5", "-2.5e+3", "1e", "1e+", "7.e2", "123456789012345678901234567890",
+             "0.1000000000000000055511151231257827", "1e39", "1e-46", "1e400", "1e-400",
+             "4.9406564584124654e-324", "1.7976931348623157e308", "inf", "-nan", "-", ".", "e5", "" })
+    {
+        expect_same_as_from_chars<float>(s);
+        expect_same_as_from_chars<double>(s);
+    }
+}
+
+GTEST_TEST(FloatParser, RandomDecimals)
+{
+    std::mt19937_64                         rng{ 1234 };
+    std::uniform_int_distribution<int>      digits{ 1, 22 };
+    std::uniform_int_distribution<int>      digit{ 0, 9 };
+    std::uniform_int_distribution<int>      exponent{ -60, 60 };
+    std::uniform_int_distribution<unsigned> coin{ 0, 3 };
+
+    for (auto i = 0; i < 200'000; ++i)
+    {
+        std::string s = (coin(rng) == 0) ? "-" : "";
+
+        const auto count = digits(rng);
+        const auto point = std::uniform_int_distribution<int>{ 0, count }(rng);
+        for (auto d = 0; d < count; ++d)
+        {
+            if (d == point)
+                s += '.';
+            s += static_cast<char>('0' + digit(rng));
+        }
+        if (coin(rng) == 0)
+            s += 'e' + std::to_string(exponent(rng));
+
+        expect_same_as_from_chars<float>(s);
+        expect_same_as_from_chars<double>(s);
+    }
+}
+
+GTEST_TEST(FloatParser, RoundTrip)
+{
+    std::mt19937_64 rng{ 5678 };
+    for (auto i = 0; i < 100'000; ++i)
+    {
+        char buffer[64];
+
+        const auto f = std::bit_cast<float>(static_cast<std::uint32_t>(rng()));
+        auto       r = std::to_chars(std::begin(buffer), std::end(buffer), f);
+        expect_same_as_from_chars<float>({ buffer, r.ptr });
+
+        const auto d = std::bit_cast<double>(rng());
+        r            = std::to_chars(std::begin(buffer), std::end(buffer), d);
+        expect_same_as_from_chars<double>({ buffer, r.ptr });
+    }
+}
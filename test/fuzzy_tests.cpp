@@ -1,5 +1,7 @@
 #include "obj-cpp/obj.hpp"
 
+#include "containers.hpp"
+
 #include <gtest/gtest.h>
 
 #include <algorithm>
@@ -65,49 +67,49 @@ GTEST_TEST(Fuzzy, obj_file_only)
     for (auto i = 0; i < 10; ++i)
     {
         const auto generate_vertex = []() {
-            return Vertex{
+            return Vertex<>{
                 randf(-100, +100),
                 randf(-100, +100),
                 randf(-100, +100)
             };
         };
-        std::vector<Vertex> v(randu(min_v_count, max_v_count));
+        std::vector<Vertex<>> v(randu(min_v_count, max_v_count));
         std::generate(std::begin(v), std::end(v), generate_vertex);
 
         const auto generate_normal = []() {
-            return Normal{
+            return Normal<>{
                 randf(-100, +100),
                 randf(-100, +100),
                 randf(-100, +100)
             };
         };
-        std::vector<Normal> vn(randu(min_vn_count, max_vn_count));
+        std::vector<Normal<>> vn(randu(min_vn_count, max_vn_count));
         std::generate(std::begin(vn), std::end(vn), generate_normal);
 
         const auto generate_texcoord = []() {
-            return Texcoord{
+            return Texcoord<>{
                 randf(-100, +100),
                 randf(-100, +100),
                 randf(-100, +100)
             };
         };
-        std::vector<Texcoord> vt(randu(min_vt_count, max_vt_count));
+        std::vector<Texcoord<>> vt(randu(min_vt_count, max_vt_count));
         std::generate(std::begin(vt), std::end(vt), generate_texcoord);
 
         const auto generate_face = [&]() {
-            return Face{
-                randu(0, static_cast<std::uint32_t>(std::size(v))),
+            return Face<>{
+                randu(1, static_cast<std::uint32_t>(std::size(v))),
                 randu(0, static_cast<std::uint32_t>(std::size(vt))),
                 randu(0, static_cast<std::uint32_t>(std::size(vn))),
-                randu(0, static_cast<std::uint32_t>(std::size(v))),
+                randu(1, static_cast<std::uint32_t>(std::size(v))),
                 randu(0, static_cast<std::uint32_t>(std::size(vt))),
                 randu(0, static_cast<std::uint32_t>(std::size(vn))),
-                randu(0, static_cast<std::uint32_t>(std::size(v))),
+                randu(1, static_cast<std::uint32_t>(std::size(v))),
                 randu(0, static_cast<std::uint32_t>(std::size(vt))),
                 randu(0, static_cast<std::uint32_t>(std::size(vn))),
             };
         };
-        std::vector<Face> f(randu(min_f_count, max_f_count));
+        std::vector<Face<>> f(randu(min_f_count, max_f_count));
         std::generate(std::begin(f), std::end(f), generate_face);
 
 
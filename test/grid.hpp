@@ -0,0 +1,44 @@
+#pragma once
+#ifndef OBJCPP_TEST_GRID_HPP
+#define OBJCPP_TEST_GRID_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+// Meshes large enough to be split among threads, to compare the parallel implementations
+// with the serial ones.
+namespace obj_test
+{
+    // numbers of threads that split the grids in uneven ranges
+    constexpr std::size_t thread_counts[] = { 2, 5 };
+
+    // height of a wavy grid at the vertex (x, y)
+    [[nodiscard]] inline double wave(int x, int y) { return std::sin(x * 0.1) * std::cos(y * 0.2); }
+
+    // Text of a grid of size × size vertices, with the statements written by vertex(s, x, y)
+    // for each vertex, then header, then those written by cell(s, i, x, y) for each cell,
+    // where i is the one-based index of the vertex (x, y) and i + 1, i + size + 1, i + size
+    // are the other corners. Values are written with every significant digit.
+    template <class Vertex, class Cell>
+    [[nodiscard]] std::string grid(int size, Vertex vertex, std::string_view header, Cell cell)
+    {
+        std::ostringstream s{};
+        s.precision(std::numeric_limits<double>::max_digits10);
+        for (auto y = 0; y < size; ++y)
+            for (auto x = 0; x < size; ++x)
+                vertex(s, x, y);
+        s << header;
+        for (auto y = 0; y + 1 < size; ++y)
+            for (auto x = 0; x + 1 < size; ++x)
+                cell(s, y * size + x + 1, x, y);
+        return std::move(s).str();
+    }
+
+} // namespace obj_test
+
+#endif // !OBJCPP_TEST_GRID_HPP
\ No newline at end of file
@@ -1,9 +1,13 @@
 #include "obj-cpp/lexer.hpp"
+#include "obj-cpp/tag_table.hpp"
 
 #include "gtest/gtest.h"
 
 #include <algorithm>
 #include <iostream>
+#include <memory>
+#include <optional>
+#include <random>
 
 using namespace obj;
 
@@ -149,4 +153,108 @@ GTEST_TEST(Lexer, MixedTokenTypes)
 
     const auto result = lexer_multi_line(source);
     assert_lexer_result(result, expected);
-}
\ No newline at end of file
+}
+
+// lex all lines with the given instruction set, returns nothing on lexer errors
+[[nodiscard]] std::optional<MultiLineResult> lexer_all_lines(const std::string& s, LexerIsa isa)
+{
+    try
+    {
+        MultiLineResult lines;
+        LineLexer       lexer{ isa };
+        for (auto p = std::data(s); p != (std::data(s) + std::size(s));)
+        {
+            std::vector<Token> line;
+            p = lexer.lex_until_linefeed(p, line);
+            lines.emplace_back(line);
+        }
+        return lines;
+    }
+    catch (const std::runtime_error&)
+    {
+        return std::nullopt;
+    }
+}
+
+GTEST_TEST(Lexer, VectorizedMatchesScalar)
+{
+    std::vector<LexerIsa> isas{ LexerIsa::scalar };
+    if (detect_lexer_isa() != LexerIsa::scalar)
+        isas.push_back(LexerIsa::sse2);
+    if (detect_lexer_isa() == LexerIsa::avx2)
+        isas.push_back(LexerIsa::avx2);
+
+    std::mt19937                  rng{ 42 };
+    const std::string             alphabet = "vnft0123456789./-#     \n\n";
+    const std::string             invalid  = "\t\r~\x80";
+    std::uniform_int_distribution pick_valid{ std::size_t{ 0 }, std::size(alphabet) - 1 };
+    std::uniform_int_distribution pick_invalid{ std::size_t{ 0 }, std::size(invalid) - 1 };
+    std::uniform_int_distribution length{ 1, 300 };
+    std::uniform_int_distribution percent{ 0, 99 };
+
+    for (auto i = 0; i < 2000; ++i)
+    {
+        std::string source(length(rng), ' ');
+        const auto  with_errors = (i % 4 == 0);
+        for (auto& c : source)
+            c = (with_errors && percent(rng) == 0) ? invalid[pick_invalid(rng)] : alphabet[pick_valid(rng)];
+
+        // start lexing from every alignment of the first character
+        for (auto offset = 0; offset < 64; offset += 13)
+        {
+            const auto shifted  = std::string(offset, '\n') + source;
+            const auto expected = lexer_all_lines(shifted, LexerIsa::scalar);
+            for (const auto isa : isas)
+                ASSERT_EQ(lexer_all_lines(shifted, isa), expected) << "source: " << shifted;
+        }
+    }
+}
+
+GTEST_TEST(Lexer, BoundedSource)
+{
+    std::vector<LexerIsa> isas{ LexerIsa::scalar };
+    if (detect_lexer_isa() != LexerIsa::scalar)
+        isas.push_back(LexerIsa::sse2);
+    if (detect_lexer_isa() == LexerIsa::avx2)
+        isas.push_back(LexerIsa::avx2);
+
+    // no string terminator, and nothing readable past the last character
+    const std::string source = "v 1 2 3\n# comment\nf 1// 2// 3//\n" + std::string(100, 'x') + "\nlast line";
+    for (auto size = std::size_t{ 1 }; size <= std::size(source); size += 7)
+    {
+        const auto data = std::make_unique<char[]>(size);
+        std::copy_n(std::data(source), size, data.get());
+
+        const auto prefix   = source.substr(0, size);
+        const auto expected = lexer_all_lines(prefix, LexerIsa::scalar);
+        for (const auto isa : isas)
+        {
+            LineLexer       lexer{ isa };
+            MultiLineResult lines;
+            lexer.reset(data.get() + size);
+            for (const char* p = data.get(); p != data.get() + size;)
+            {
+                std::vector<Token> line;
+                p = lexer.lex_until_linefeed(p, line);
+                lines.emplace_back(line);
+            }
+            ASSERT_EQ(lines, expected) << "size: " << size;
+        }
+    }
+}
+
+GTEST_TEST(Lexer, TagTable)
+{
+    constexpr std::array<std::string_view, 11> tags = {
+        "v", "vn", "vt", "f", "o", "g", "s", "mtllib", "usemtl", "call", "csh"
+    };
+    constexpr TagTable table{ tags };
+    static_assert(table.find("usemtl") == 8);
+    static_assert(table.find("vp") == table.npos);
+
+    for (std::size_t i = 0; i < std::size(tags); ++i)
+        EXPECT_EQ(table.find(tags[i]), i);
+
+    for (const std::string_view miss : { "", "V", "vv", "fn", "mtllip", "usemtl2", "cal", "cs", "#" })
+        EXPECT_EQ(table.find(miss), table.npos);
+}
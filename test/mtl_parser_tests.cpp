@@ -1,7 +1,13 @@
 #include "obj-cpp/mtl_parser.hpp"
+#include "obj-cpp/parser.hpp"
+
+#include "containers.hpp"
 
 #include <gtest/gtest.h>
 
+#include <memory_resource>
+#include <span>
+
 using namespace obj;
 
 GTEST_TEST(MtlParser, SingleMaterial)
@@ -30,4 +36,36 @@ GTEST_TEST(MtlParser, MultiMaterial)
 
     const auto r = obj::parse_as_mtl(source);
     ASSERT_EQ(r.materials, expected);
-}
\ No newline at end of file
+}
+
+GTEST_TEST(MtlParser, StringTerminator)
+{
+    // an invalid character inside the source, rather than the end of the input
+    constexpr char source[] = "newmtl first\nKd 0.5 0.5\0 0.5\nnewmtl second\n";
+    EXPECT_THROW(auto _ = obj::parse_as_mtl(std::string{ source, sizeof(source) - 1 }), ParserError);
+}
+
+#if __cpp_lib_span
+GTEST_TEST(MtlParser, Span)
+{
+    // the terminator of the buffer ends the input
+    constexpr char source[] = "newmtl a\nKd 0.5 0.5 0.5\n";
+
+    const auto r = obj::parse_as_mtl(std::span{ source });
+    ASSERT_EQ(std::size(r.materials), 1);
+    EXPECT_EQ(r.materials[0].name, "a");
+    EXPECT_EQ(r.materials[0].kd[1], 0.5f);
+}
+#endif
+
+GTEST_TEST(MtlParser, MemoryResource)
+{
+    const std::string source = "newmtl a_material_with_a_long_name\nKd 0.5 0.5 0.5\n";
+
+    std::pmr::monotonic_buffer_resource arena;
+    const auto r = obj::parse_as_mtl(source, { .memory_resource = &arena });
+    ASSERT_EQ(std::size(r.materials), 1);
+    EXPECT_EQ(r.materials.get_allocator().resource(), &arena);
+    EXPECT_EQ(r.materials[0].name.get_allocator().resource(), &arena);
+    EXPECT_EQ(r.materials[0].name, "a_material_with_a_long_name");
+}
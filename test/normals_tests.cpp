@@ -0,0 +1,136 @@
+#include "obj-cpp/normals.hpp"
+#include "obj-cpp/obj_parser.hpp"
+
+#include "grid.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+
+using namespace obj;
+
+namespace
+{
+    // unit cube with faces as quads, after the given smoothing statements
+    std::string cube(const std::string& sides, const std::string& top)
+    {
+        return "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nv 0 0 1\nv 1 0 1\nv 1 1 1\nv 0 1 1\n" + sides +
+               "f 1// 4// 3// 2//\nf 1// 2// 6// 5//\nf 3// 4// 8// 7//\nf 1// 5// 8// 4//\nf 2// 3// 7// 6//\n" + top +
+               "f 5// 6// 7// 8//\n";
+    }
+}
+
+GTEST_TEST(Normals, SmoothingGroups)
+{
+    // with a single group all faces around a corner share its diagonal
+    auto smooth = obj::parse_as_obj(cube("s 1\n", ""));
+    obj::generate_normals(smooth.data, smooth.smoothing_groups);
+    ASSERT_EQ(std::size(smooth.data.vn), 8);
+    for (const auto& f : smooth.data.faces)
+        for (const auto& t : f.triplets)
+        {
+            const auto& v = smooth.data.v[t.v - 1];
+            const auto& n = smooth.data.vn[t.vn - 1];
+            EXPECT_NEAR(n.x, (v.x - 0.5f) * 2 / std::sqrt(3.0f), 1e-6f);
+            EXPECT_NEAR(n.y, (v.y - 0.5f) * 2 / std::sqrt(3.0f), 1e-6f);
+            EXPECT_NEAR(n.z, (v.z - 0.5f) * 2 / std::sqrt(3.0f), 1e-6f);
+        }
+
+    // faces that aren't smoothed have their own normal
+    auto flat = obj::parse_as_obj(cube("", ""));
+    obj::generate_normals(flat.data, flat.smoothing_groups);
+    ASSERT_EQ(std::size(flat.data.vn), 12);
+    EXPECT_EQ(flat.data.vn[0], (Normal<>{ 0, 0, -1 }));
+    EXPECT_EQ(flat.data.vn[11], (Normal<>{ 0, 0, 1 }));
+    EXPECT_EQ(flat.data.faces[11].triplets[2].vn, 12);
+
+    // groups don't blend at their boundary, and the normals of a group that is
+    // flat around a vertex are the same with both weightings
+    auto split = obj::parse_as_obj(cube("s 1\n", "s 2\n"));
+    for (const auto weighting : { NormalConfig::Weighting::angle, NormalConfig::Weighting::area })
+    {
+        obj::generate_normals(split.data, split.smoothing_groups, { .weighting = weighting });
+        ASSERT_EQ(std::size(split.data.vn), 12);
+        for (const auto& t : split.data.faces.back().triplets)
+        {
+            const auto& n = split.data.vn[t.vn - 1];
+            EXPECT_NEAR(n.x, 0, 1e-6f);
+            EXPECT_NEAR(n.y, 0, 1e-6f);
+            EXPECT_NEAR(n.z, 1, 1e-6f);
+        }
+    }
+
+    // zero-based indices and structures of arrays, compared with the last weighting
+    auto zero_based = obj::parse_as_obj(cube("s 1\n", "s 2\n"), { .zero_based_indices = true });
+    obj::generate_normals(zero_based.data, zero_based.smoothing_groups,
+        { .weighting = NormalConfig::Weighting::area, .zero_based_indices = true });
+    EXPECT_EQ(zero_based.data.vn, split.data.vn);
+    EXPECT_EQ(zero_based.data.faces[0].triplets[0].vn, 0);
+
+    auto soa = obj::parse_as_obj_soa(cube("s 1\n", "s 2\n"));
+    obj::generate_normals(soa.data, soa.smoothing_groups, { .weighting = NormalConfig::Weighting::area });
+    ASSERT_EQ(std::size(soa.data.nx), std::size(split.data.vn));
+    for (std::size_t i = 0; i < std::size(soa.data.nx); ++i)
+        EXPECT_EQ((Normal<>{ soa.data.nx[i], soa.data.ny[i], soa.data.nz[i] }), split.data.vn[i]);
+    for (std::size_t i = 0; i < std::size(soa.data.vn_indices); ++i)
+        EXPECT_EQ(soa.data.vn_indices[i], split.data.faces[i / 3].triplets[i % 3].vn);
+
+    auto invalid = obj::parse_as_obj(cube("s 1\n", ""));
+    invalid.data.faces[3].triplets[1].v = 9;
+    EXPECT_THROW(obj::generate_normals(invalid.data, invalid.smoothing_groups), std::out_of_range);
+    EXPECT_TRUE(std::empty(invalid.data.vn));
+}
+
+GTEST_TEST(Normals, Polygons)
+{
+    // the quads of a smooth cube take the diagonal normals of their corners
+    auto smooth = obj::parse_as_obj(cube("s 1\n", ""), { .keep_polygons = true });
+    obj::generate_normals(smooth);
+    ASSERT_EQ(std::size(smooth.data.vn), 8);
+    ASSERT_EQ(std::size(smooth.polygons.triplets), 24);
+    for (const auto& t : smooth.polygons.triplets)
+    {
+        ASSERT_NE(t.vn, 0);
+        const auto& v = smooth.data.v[t.v - 1];
+        const auto& n = smooth.data.vn[t.vn - 1];
+        EXPECT_NEAR(n.x, (v.x - 0.5f) * 2 / std::sqrt(3.0f), 1e-6f);
+        EXPECT_NEAR(n.y, (v.y - 0.5f) * 2 / std::sqrt(3.0f), 1e-6f);
+        EXPECT_NEAR(n.z, (v.z - 0.5f) * 2 / std::sqrt(3.0f), 1e-6f);
+    }
+
+    // flat quads take the normal of their plane
+    auto soa = obj::parse_as_obj_soa(cube("s 1\n", "s 2\n"), { .keep_polygons = true });
+    obj::generate_normals(soa, { .thread_count = 2 });
+    for (auto i = soa.polygons.first(5); i < soa.polygons.last(5); ++i)
+    {
+        const auto vn = soa.polygons.triplets[i].vn - 1;
+        EXPECT_NEAR(soa.data.nx[vn], 0, 1e-6f);
+        EXPECT_NEAR(soa.data.ny[vn], 0, 1e-6f);
+        EXPECT_NEAR(soa.data.nz[vn], 1, 1e-6f);
+    }
+}
+
+GTEST_TEST(Normals, ParallelMatchesSerial)
+{
+    // a wavy grid with a few smoothing groups
+    constexpr auto size = 300;
+
+    const auto source = obj_test::grid(
+        size, [](auto& s, int x, int y) { s << "v " << x << ' ' << y << ' ' << obj_test::wave(x, y) << '\n'; },
+        "", [](auto& s, int i, int x, int y) {
+            if (x == 0 && y % 50 == 0)
+                s << "s " << y / 100 << '\n';
+            s << "f " << i << "// " << i + 1 << "// " << i + size + 1 << "// " << i + size << "//\n";
+        });
+
+    auto serial = obj::parse_as_obj<float, std::uint32_t>(source);
+    obj::generate_normals(serial.data, serial.smoothing_groups);
+    for (const auto threads : obj_test::thread_counts)
+    {
+        auto parallel = obj::parse_as_obj<float, std::uint32_t>(source);
+        obj::generate_normals(parallel.data, parallel.smoothing_groups, { .thread_count = threads });
+        EXPECT_EQ(parallel.data.vn, serial.data.vn) << threads;
+        EXPECT_EQ(parallel.data.faces, serial.data.faces) << threads;
+    }
+}
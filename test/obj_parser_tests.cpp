@@ -1,40 +1,48 @@
+#include "obj-cpp/lexer.hpp"
 #include "obj-cpp/obj_parser.hpp"
 #include "obj-cpp/parser.hpp"
 
+#include "containers.hpp"
+
 #include "gtest/gtest.h"
 
+#include <atomic>
 #include <fstream>
 #include <iostream>
+#include <memory_resource>
+#include <random>
 #include <sstream>
 
 using namespace obj;
 
 namespace obj
 {
-    //template <class Value>
-    inline std::ostream& operator<<(std::ostream& os, const Vertex& v)
+    template <class Value>
+    inline std::ostream& operator<<(std::ostream& os, const Vertex<Value>& v)
     {
         return os << '(' << v.x << ',' << v.y << ',' << v.z << ',' << v.w << ')';
     }
 
-    //template <class Value>
-    inline std::ostream& operator<<(std::ostream& os, const Normal& n)
+    template <class Value>
+    inline std::ostream& operator<<(std::ostream& os, const Normal<Value>& n)
     {
         return os << '(' << n.x << ',' << n.y << ',' << n.z << ')';
     }
 
-    //template <class Value>
-    inline std::ostream& operator<<(std::ostream& os, const Texcoord& n)
+    template <class Value>
+    inline std::ostream& operator<<(std::ostream& os, const Texcoord<Value>& n)
     {
         return os << '(' << n.u << ',' << n.v << ',' << n.w << ')';
     }
 
-    inline std::ostream& operator<<(std::ostream& os, const Triplet& t)
+    template <class Index>
+    inline std::ostream& operator<<(std::ostream& os, const Triplet<Index>& t)
     {
         return os << '(' << t.v << ',' << t.vt << ',' << t.vn << ')';
     }
 
-    inline std::ostream& operator<<(std::ostream& os, const Face& f)
+    template <class Index>
+    inline std::ostream& operator<<(std::ostream& os, const Face<Index>& f)
     {
         return os << '{' << f.triplets[0] << ',' << f.triplets[1] << ',' << f.triplets[2] << '}';
     }
@@ -64,7 +72,7 @@ GTEST_TEST(ObjParser, Vertices)
 
     const auto dom = obj::parse_as_obj(source);
 
-    const std::vector<obj::Vertex> v = {
+    const std::vector<obj::Vertex<>> v = {
         { 1.f, 1.f, 1.f, 1.f },
         { 2.f, 2.f, 2.f, 1.f },
         { 3.f, 3.f, 3.f, 3.f },
@@ -76,13 +84,27 @@ GTEST_TEST(ObjParser, Vertices)
     EXPECT_THROW(auto _ = obj::parse_as_obj(s), ParserError);
 }
 
+GTEST_TEST(ObjParser, ScientificNotation)
+{
+    const std::string source = "v 1e-5 2.5E+2 -3e0\n"
+                               "vn 0.5e1 -1.0e-1 1E0\n";
+
+    const std::vector<Vertex<>> v   = { { 1e-5f, 250.f, -3.f, 1.f } };
+    const std::vector<Normal<>> vn  = { { 5.f, -0.1f, 1.f } };
+    const auto                dom = obj::parse_as_obj(source);
+    ASSERT_EQ(dom.data.v, v);
+    ASSERT_EQ(dom.data.vn, vn);
+
+    EXPECT_THROW(auto _ = obj::parse_as_obj(std::string{ "v 1.0 2.0 3.0x\n" }), ParserError);
+}
+
 GTEST_TEST(ObjParser, Normals)
 {
     const std::string source = "vn 1.0 1.0 1.0\n"
                                "vn 2.0 2.0 2.0\n"
                                "vn 3.0 3.0 3.0\n"
                                "vn 4.0 4.0 4.0\n";
-    const std::vector<Normal> vn = {
+    const std::vector<Normal<>> vn = {
         { 1.f, 1.f, 1.f },
         { 2.f, 2.f, 2.f },
         { 3.f, 3.f, 3.f },
@@ -98,7 +120,7 @@ GTEST_TEST(ObjParser, Texcoords)
     const std::string source = "vt 1.0         # single component\n"
                                "vt 2.0 2.0     # (u, v) \n"
                                "vt 3.0 3.0 3.0 # (u, v, w)\n";
-    const std::vector<Texcoord> vt = {
+    const std::vector<Texcoord<>> vt = {
         { 1.f, 0.f, 0.f },
         { 2.f, 2.f, 0.f },
         { 3.f, 3.f, 3.f },
@@ -110,8 +132,8 @@ GTEST_TEST(ObjParser, Texcoords)
 
 GTEST_TEST(ObjParser, Triplets)
 {
-    ASSERT_EQ(parse_triplet("1/1/1"), Triplet(1, 1, 1));
-    ASSERT_EQ(parse_triplet("1/2/3"), Triplet(1, 2, 3));
+    ASSERT_EQ(parse_triplet("1/1/1"), Triplet<>(1, 1, 1));
+    ASSERT_EQ(parse_triplet("1/2/3"), Triplet<>(1, 2, 3));
     EXPECT_THROW(auto _ = parse_triplet("/11/22"), ParserError);
 }
 
@@ -127,10 +149,795 @@ GTEST_TEST(ObjParser, Faces)
 
     const auto dom = obj::parse_as_obj(source);
 
-    const std::vector<Face> f = {
+    const std::vector<Face<>> f = {
         { 1, 0, 0,   2, 0, 0,   3, 0, 0 },
         { 1, 1, 0,   2, 2, 0,   3, 3, 0 },
         { 1, 1, 1,   2, 2, 2,   3, 3, 3 },
     };
     ASSERT_EQ(dom.data.faces, f);
-}
\ No newline at end of file
+}
+
+GTEST_TEST(ObjParser, FastPathMatchesTokenPath)
+{
+    // the same statements, laid out for the single pass path and with comments for the token path
+    const std::string fast = "v 1.5 -2 3e2\n"
+                             "v  4 5 6 0.5  \n"
+                             "vn 0 1 0\n"
+                             "vt 0.25\n"
+                             "vt 0.25 0.75 1\n"
+                             "f 1//  2/1/  2/2/1\n"
+                             "f 1/2/1 2/1/1 1//";
+    const std::string slow = "v 1.5 -2 3e2 #\n"
+                             "v  4 5 6 0.5  #\n"
+                             "vn 0 1 0#\n"
+                             "vt 0.25 #\n"
+                             "vt 0.25 0.75 1 #\n"
+                             "f 1//  2/1/  2/2/1 #\n"
+                             "f 1/2/1 2/1/1 1// #";
+
+    const auto a = obj::parse_as_obj(fast);
+    const auto b = obj::parse_as_obj(slow);
+    ASSERT_EQ(std::size(a.data.v), 2);
+    ASSERT_EQ(std::size(a.data.faces), 2);
+    EXPECT_EQ(a.data.v, b.data.v);
+    EXPECT_EQ(a.data.vn, b.data.vn);
+    EXPECT_EQ(a.data.vt, b.data.vt);
+    EXPECT_EQ(a.data.faces, b.data.faces);
+    EXPECT_EQ(a.objects, b.objects);
+
+    // malformed lines are still rejected
+    for (const auto s : { "v 1 2 3 4 5\n", "vn 1 2\n", "vt\n", "v 1 2 3x\n", "f 0// 1// 2//\n",
+                          "f 1// 2//\n", "f 1/2 2/3 3/4\n", "f 1//-1 2// 3//\n" })
+        EXPECT_THROW(auto _ = obj::parse_as_obj(std::string{ s }), ParserError) << s;
+
+    // indices that don't fit the index type
+    EXPECT_THROW((void)(obj::parse_as_obj<float, std::uint16_t>(std::string{ "f 1// 2// 70000//\n" })), ParserError);
+}
+
+GTEST_TEST(ObjParser, Polygons)
+{
+    // square with a notch on the top side, a fan around the first vertex flips a triangle
+    const std::string source = "v 0 0 0\n"
+                               "v 2 0 0\n"
+                               "v 2 2 0\n"
+                               "v 1 0.5 0\n"
+                               "v 0 2 0\n"
+                               "o a\n"
+                               "f 1// 2// 3//\n"
+                               "f 1/1/ 2/2/ 3/3/ 5/5/\n"
+                               "o b\n"
+                               "f 1// 2// 3// 4// 5//  # concave\n";
+
+    const auto fan = obj::parse_as_obj(source);
+    const std::vector<Face<>> f = {
+        { 1, 0, 0,   2, 0, 0,   3, 0, 0 },
+        { 1, 1, 0,   2, 2, 0,   3, 3, 0 },
+        { 1, 1, 0,   3, 3, 0,   5, 5, 0 },
+        { 1, 0, 0,   2, 0, 0,   3, 0, 0 },
+        { 1, 0, 0,   3, 0, 0,   4, 0, 0 },
+        { 1, 0, 0,   4, 0, 0,   5, 0, 0 },
+    };
+    ASSERT_EQ(fan.data.faces, f);
+    ASSERT_EQ(fan.objects[1].faces, (std::pmr::vector<DefaultIndexType>{ 3, 4, 5 }));
+    ASSERT_TRUE(std::empty(fan.polygons.triplets));
+
+    ObjParserConfig c{};
+    c.triangulation = ObjParserConfig::Triangulation::ear_clipping;
+    c.keep_polygons = true;
+
+    const auto clipped = obj::parse_as_obj(source, c);
+    ASSERT_EQ(std::size(clipped.data.faces), std::size(f));
+    ASSERT_TRUE(std::equal(std::cbegin(f), std::cbegin(f) + 3, std::cbegin(clipped.data.faces)));
+    ASSERT_EQ(clipped.objects, fan.objects);
+
+    // the triangles of the concave polygon keep its orientation and cover its area
+    double area = 0;
+    for (auto i = 3; i < 6; ++i)
+    {
+        const auto& t = clipped.data.faces[i].triplets;
+        const auto& a = clipped.data.v[t[0].v - 1];
+        const auto& b = clipped.data.v[t[1].v - 1];
+        const auto& d = clipped.data.v[t[2].v - 1];
+
+        const auto doubled = (b.x - a.x) * (d.y - a.y) - (b.y - a.y) * (d.x - a.x);
+        EXPECT_GT(doubled, 0.f);
+        area += doubled / 2;
+    }
+    EXPECT_FLOAT_EQ(area, 2.5);
+
+    ASSERT_EQ(clipped.polygons.size(), 3);
+    EXPECT_EQ(clipped.polygons.offsets, (std::pmr::vector<DefaultIndexType>{ 0, 3, 7 }));
+    EXPECT_EQ(clipped.polygons.faces, (std::pmr::vector<DefaultIndexType>{ 0, 1, 3 }));
+    EXPECT_EQ(clipped.polygons.last(2) - clipped.polygons.first(2), 5);
+    EXPECT_EQ(clipped.polygons.triplets[3], Triplet<>(1, 1, 0));
+
+    // same output from the other layouts and from chunks parsed in parallel
+    const auto soa = obj::parse_as_obj_soa(source, c);
+    for (std::size_t i = 0; i < std::size(f); ++i)
+        for (std::size_t k = 0; k < 3; ++k)
+            EXPECT_EQ(soa.data.v_indices[3 * i + k], clipped.data.faces[i].triplets[k].v);
+
+    c.thread_count   = 3;
+    c.min_chunk_size = 1;
+    const auto parallel = obj::parse_as_obj(source, c);
+    EXPECT_EQ(parallel.data.faces, clipped.data.faces);
+    EXPECT_EQ(parallel.polygons, clipped.polygons);
+    EXPECT_EQ(parallel.objects, clipped.objects);
+}
+
+GTEST_TEST(ObjParser, RelativeIndices)
+{
+    const std::string source = "v 1 0 0\n"
+                               "v 2 0 0\n"
+                               "v 3 0 0\n"
+                               "vt 0.5\n"
+                               "vn 0 0 1\n"
+                               "f -3/-1/-1 -2/-1/ -1//-1\n"
+                               "f -3/-1/-1 -2/-1/ -1//-1 # same statement, token path\n"
+                               "v 4 0 0\n"
+                               "f 1// -2// -1//\n";
+
+    const std::vector<Face<>> f = {
+        { 1, 1, 1,   2, 1, 0,   3, 0, 1 },
+        { 1, 1, 1,   2, 1, 0,   3, 0, 1 },
+        { 1, 0, 0,   3, 0, 0,   4, 0, 0 },
+    };
+    ASSERT_EQ(obj::parse_as_obj(source).data.faces, f);
+
+    for (const auto s : { "v 1 0 0\nf -1// -2// -1//\n", "v 1 0 0\nf -1// -1// -1/-1/\n", "v 1 0 0\nf -0// -1// -1//\n",
+                          "v 1 0 0\nf --1// -1// -1//\n", "v 1 0 0\nf -2// -1// -1// #\n" })
+        EXPECT_THROW(auto _ = obj::parse_as_obj(std::string{ s }), ParserError) << s;
+
+    // chunks parsed in parallel and streamed blocks refer to the vertices before them
+    std::stringstream g{};
+    for (auto i = 0; i < 500; ++i)
+    {
+        g << "v " << i << " 0 0\n";
+        if (i % 7 == 6)
+            g << "vt 0.5 0.5\nf -1/-1/ -4/-1/ -7//\n";
+    }
+    const auto long_source = g.str();
+    const auto expected    = obj::parse_as_obj(long_source);
+    ASSERT_EQ(expected.data.faces.back(), (Face<>{ 497, 71, 0,   494, 71, 0,   491, 0, 0 }));
+
+    ObjParserConfig c{};
+    c.thread_count   = 4;
+    c.min_chunk_size = 64;
+    EXPECT_EQ(obj::parse_as_obj(long_source, c).data.faces, expected.data.faces);
+
+    ObjParserResult<>  streamed;
+    ObjResultBuilder<> builder{ streamed };
+    ObjStreamParser<>  parser{ builder };
+    for (std::size_t pos = 0; pos < std::size(long_source); pos += 13)
+        parser.feed(std::string_view{ long_source }.substr(pos, 13));
+    parser.finish();
+    EXPECT_EQ(streamed.data.faces, expected.data.faces);
+}
+
+GTEST_TEST(ObjParser, ZeroBasedIndices)
+{
+    const std::string source = "v 1 0 0\n"
+                               "v 2 0 0\n"
+                               "v 3 0 0\n"
+                               "vt 0.5\n"
+                               "vn 0 0 1\n"
+                               "f 1/1/1 2/1/ 3//1\n";
+
+    constexpr auto            missing = std::numeric_limits<DefaultIndexType>::max();
+    const std::vector<Face<>> f       = {
+        { 0, 0, 0,   1, 0, missing,   2, missing, 0 },
+    };
+
+    ObjParserConfig c{};
+    c.zero_based_indices = true;
+    ASSERT_EQ(obj::parse_as_obj(source, c).data.faces, f);
+
+    auto soa = obj::parse_as_obj_soa(source);
+    obj::normalize_indices(soa.data);
+    EXPECT_EQ(soa.data.v_indices, (std::pmr::vector<std::uint32_t>{ 0, 1, 2 }));
+    EXPECT_EQ(soa.data.vt_indices, (std::pmr::vector<std::uint32_t>{ 0, 0, 0xFFFFFFFF }));
+
+    // indices beyond the declared elements are reported, and data is left unchanged
+    for (const auto s : { "f 1// 2// 4//\n", "f 1/2/ 2// 3//\n", "f 1// 2// 3//2\n" })
+    {
+        const auto bad = obj::parse_as_obj(source + s);
+        EXPECT_THROW(obj::validate_indices(bad.data), ParserError) << s;
+        EXPECT_THROW(auto _ = obj::parse_as_obj(source + s, c), ParserError) << s;
+
+        auto copy = bad;
+        EXPECT_THROW(obj::normalize_indices(copy.data, 2), ParserError) << s;
+        EXPECT_EQ(copy.data.faces, bad.data.faces);
+    }
+}
+
+GTEST_TEST(ObjParser, ValueAndIndexTypes)
+{
+    const std::string source = "v 0.1 6378137.25 -1e-30\n"
+                               "vn 0.0 1.0 0.0\n"
+                               "vt 0.5 0.25\n"
+                               "o mesh\n"
+                               "f 1/1/1 1/1/1 65535/1/1\n";
+
+    const auto dom = obj::parse_as_obj<double, std::uint32_t>(source);
+    static_assert(std::is_same_v<decltype(dom.data.v)::value_type, Vertex<double>>);
+    static_assert(std::is_same_v<decltype(dom.data.faces)::value_type, Face<std::uint32_t>>);
+
+    const std::vector<Vertex<double>> v = { { 0.1, 6378137.25, -1e-30, 1.0 } };
+    ASSERT_EQ(dom.data.v, v);
+    ASSERT_EQ(dom.data.faces[0].triplets[2], (Triplet<std::uint32_t>{ 65535, 1, 1 }));
+    ASSERT_EQ(dom.objects[0].faces, std::pmr::vector<std::uint32_t>{ 0 });
+
+    const auto small = obj::parse_as_obj<float, std::uint16_t>(source);
+    ASSERT_EQ(small.data.faces[0].triplets[2].v, 65535);
+    const std::string overflow = "f 1// 1// 65536//\n";
+    EXPECT_THROW((void)(obj::parse_as_obj<float, std::uint16_t>(overflow)), ParserError);
+}
+
+GTEST_TEST(ObjParser, ParallelMatchesSerial)
+{
+    std::stringstream s{};
+    s << "v 0.0 0.0 0.0\n"
+      << "f 1// 1// 1//\n"; // face outside of any object
+    for (auto o = 0; o < 20; ++o)
+    {
+        s << "o object_" << o << '\n';
+        for (auto i = 0; i < 10; ++i)
+            s << "v " << o << ".0 " << i << ".0 1.5\n"
+              << "vn 0.0 1.0 0.0\n"
+              << "vt 0.25 0.75\n"
+              << "# comment line\n"
+              << "f " << i + 1 << "/1/1 " << i + 2 << "/2/1 " << i + 3 << "/3/1\n";
+    }
+    const auto source = s.str();
+
+    const auto serial = obj::parse_as_obj(source);
+    ASSERT_EQ(std::size(serial.objects), 20);
+    ASSERT_EQ(std::size(serial.objects[0].faces), 10);
+
+    for (const auto threads : { 2, 3, 7, 64 })
+    {
+        const ObjParserConfig config{ .thread_count = static_cast<std::size_t>(threads), .min_chunk_size = 1 };
+
+        const auto parallel = obj::parse_as_obj(source, config);
+        EXPECT_EQ(parallel.data.v, serial.data.v);
+        EXPECT_EQ(parallel.data.vn, serial.data.vn);
+        EXPECT_EQ(parallel.data.vt, serial.data.vt);
+        EXPECT_EQ(parallel.data.faces, serial.data.faces);
+        EXPECT_EQ(parallel.objects, serial.objects);
+    }
+
+    const std::string duplicate = "o a\nv 1.0 1.0 1.0\no b\nv 1.0 1.0 1.0\no a\n";
+    EXPECT_THROW(auto _ = obj::parse_as_obj(duplicate, { .thread_count = 3, .min_chunk_size = 1 }), ParserError);
+
+    // errors found while merging the chunks are located as the serial parser locates them
+    std::stringstream many{};
+    many << "v 0.0 0.0 0.0\n";
+    for (auto i = 0; i < 70'000; ++i)
+        many << "f 1// 1// 1//\n";
+    for (const auto& text : { duplicate, many.str() })
+    {
+        const auto serial_error = std::get<ParserErrorReport>(obj::try_parse<float, std::uint16_t>(text));
+        for (const auto threads : { 2, 3 })
+        {
+            const auto parallel_error = std::get<ParserErrorReport>(obj::try_parse<float, std::uint16_t>(
+                text, { .thread_count = static_cast<std::size_t>(threads), .min_chunk_size = 1 }));
+            EXPECT_EQ(parallel_error.code(), serial_error.code());
+            EXPECT_EQ(parallel_error.line(), serial_error.line());
+            EXPECT_EQ(parallel_error.column(), serial_error.column());
+        }
+    }
+}
+
+GTEST_TEST(ObjParser, Prescan)
+{
+    std::stringstream s{};
+    s << "v 0.0 0.0 0.0\n";
+    for (auto o = 0; o < 7; ++o)
+    {
+        s << "o object_" << o << '\n'
+          << "# v 1.0 1.0 1.0\n"; // not counted, as any other comment
+        for (auto i = 0; i < 13; ++i)
+            s << "v " << o << ".0 " << i << ".0 1.5\n"
+              << "vn 0.0 1.0 0.0\n"
+              << "vt 0.25 0.75\n"
+              << "f " << i + 1 << "/1/1 " << i + 2 << "/2/1 " << i + 3 << "/3/1\n";
+        s << "vt 1.0 0.0\n";
+    }
+    s << "o end"; // last statement without line feed
+    const auto source = s.str();
+
+    // every length exercises a different mix of vectorized blocks and scalar tail
+    for (auto size = std::size(source) - 40; size <= std::size(source); ++size)
+    {
+        const auto view     = std::string_view{ source }.substr(0, size);
+        const auto expected = [&](std::string_view tag) {
+            std::size_t count = 0;
+            for (std::size_t p = 0; p < std::size(view); p = view.find('\n', p) + 1)
+            {
+                count += view.substr(p).starts_with(tag);
+                if (view.find('\n', p) == std::string_view::npos)
+                    break;
+            }
+            return count;
+        };
+
+        const auto counts = count_statements(std::data(view), std::size(view));
+        EXPECT_EQ(counts.v, expected("v "));
+        EXPECT_EQ(counts.vn, expected("vn"));
+        EXPECT_EQ(counts.vt, expected("vt"));
+        EXPECT_EQ(counts.f, expected("f "));
+        EXPECT_EQ(counts.o, expected("o "));
+    }
+
+    const auto plain = obj::parse_as_obj(source);
+    for (const auto threads : { 1, 3 })
+    {
+        const ObjParserConfig config{
+            .prescan = true, .thread_count = static_cast<std::size_t>(threads), .min_chunk_size = 1
+        };
+        const auto prescanned = obj::parse_as_obj(source, config);
+        EXPECT_EQ(prescanned.data.v, plain.data.v);
+        EXPECT_EQ(prescanned.data.vn, plain.data.vn);
+        EXPECT_EQ(prescanned.data.vt, plain.data.vt);
+        EXPECT_EQ(prescanned.data.faces, plain.data.faces);
+        EXPECT_EQ(prescanned.objects, plain.objects);
+    }
+
+    const auto serial = obj::parse_as_obj(source, { .prescan = true });
+    EXPECT_EQ(serial.data.v.capacity(), std::size(serial.data.v));
+    EXPECT_EQ(serial.data.faces.capacity(), std::size(serial.data.faces));
+
+    // storage is only reserved in advance for the counts set by the caller
+    const auto tiny = obj::parse_as_obj(std::string{ "v 0 0 0\n" });
+    EXPECT_LT(tiny.data.v.capacity(), 16);
+    EXPECT_EQ(tiny.data.faces.capacity(), 0);
+    const auto reserved = obj::parse_as_obj(std::string{ "v 0 0 0\n" }, { .expected_vertex_count = 100 });
+    EXPECT_GE(reserved.data.v.capacity(), 100);
+}
+
+
+GTEST_TEST(ObjParser, StructureOfArrays)
+{
+    std::stringstream s{};
+    for (auto o = 0; o < 5; ++o)
+    {
+        s << "o object_" << o << '\n';
+        for (auto i = 0; i < 10; ++i)
+            s << "v " << o << ".0 " << i << ".0 1.5 2.0\n"
+              << "vn 0.0 " << i << ".0 0.0\n"
+              << "vt 0.25 0." << i << " 1.0\n"
+              << "f " << i + 1 << "/1/ " << i + 2 << "/2/1 " << i + 3 << "//3\n";
+    }
+    const auto source = s.str();
+    const auto aos    = obj::parse_as_obj(source);
+
+    for (const auto threads : { 1, 3 })
+    {
+        const ObjParserConfig config{ .thread_count = static_cast<std::size_t>(threads), .min_chunk_size = 1 };
+
+        const auto soa = obj::parse_as_obj_soa(source, config);
+        ASSERT_EQ(std::size(soa.data.x), std::size(aos.data.v));
+        for (std::size_t i = 0; i < std::size(aos.data.v); ++i)
+        {
+            EXPECT_EQ(soa.data.x[i], aos.data.v[i].x);
+            EXPECT_EQ(soa.data.y[i], aos.data.v[i].y);
+            EXPECT_EQ(soa.data.z[i], aos.data.v[i].z);
+        }
+        ASSERT_EQ(std::size(soa.data.nx), std::size(aos.data.vn));
+        for (std::size_t i = 0; i < std::size(aos.data.vn); ++i)
+            EXPECT_EQ(soa.data.ny[i], aos.data.vn[i].y);
+        ASSERT_EQ(std::size(soa.data.uv), 2 * std::size(aos.data.vt));
+        for (std::size_t i = 0; i < std::size(aos.data.vt); ++i)
+        {
+            EXPECT_EQ(soa.data.uv[2 * i], aos.data.vt[i].u);
+            EXPECT_EQ(soa.data.uv[2 * i + 1], aos.data.vt[i].v);
+        }
+        ASSERT_EQ(std::size(soa.data.v_indices), 3 * std::size(aos.data.faces));
+        for (std::size_t i = 0; i < std::size(aos.data.faces); ++i)
+            for (std::size_t j = 0; j < 3; ++j)
+            {
+                EXPECT_EQ(soa.data.v_indices[3 * i + j], aos.data.faces[i].triplets[j].v);
+                EXPECT_EQ(soa.data.vt_indices[3 * i + j], aos.data.faces[i].triplets[j].vt);
+                EXPECT_EQ(soa.data.vn_indices[3 * i + j], aos.data.faces[i].triplets[j].vn);
+            }
+        EXPECT_EQ(soa.objects, (obj::parse_as_obj<float, std::uint32_t>(source).objects));
+    }
+
+    EXPECT_THROW(auto _ = obj::parse_as_obj_soa(std::string{ "f 1// 2// 4294967296//\n" }), ParserError);
+}
+
+GTEST_TEST(ObjParser, Visitor)
+{
+    struct Recorder final : ObjVisitor<>
+    {
+        std::vector<std::string> statements;
+
+        void on_vertex(const Vertex<>&) override { statements.push_back("v"); }
+        void on_normal(const Normal<>&) override { statements.push_back("vn"); }
+        void on_texcoord(const Texcoord<>&) override { statements.push_back("vt"); }
+        void on_face(const Face<>& f) override { statements.push_back("f " + std::to_string(f.triplets[2].v)); }
+        void on_object(std::string_view name) override { statements.push_back("o " + std::string{ name }); }
+        void on_group(std::span<const Token> names) override { statements.push_back("g " + std::to_string(std::size(names))); }
+        void on_use_material(std::span<const Token> args) override { statements.push_back("usemtl " + std::string{ args[0] }); }
+    };
+
+    const std::string source = "mtllib cube.mtl\n"
+                               "o first\n"
+                               "v 1.0 1.0 1.0\n"
+                               "vn 0.0 1.0 0.0\n"
+                               "vt 0.5 0.5\n"
+                               "g left right\n"
+                               "usemtl steel\n"
+                               "s off\n"
+                               "f 1/1/1 1/1/1 1/1/1\n";
+    const std::vector<std::string> expected = { "o first", "v", "vn", "vt", "g 2", "usemtl steel", "f 1" };
+
+    Recorder recorder;
+    obj::parse_as_obj(source, recorder);
+    ASSERT_EQ(recorder.statements, expected);
+
+    ObjVisitor<> ignore_all;
+    EXPECT_NO_THROW(obj::parse_as_obj(source, ignore_all));
+    EXPECT_THROW(obj::parse_as_obj(std::string{ "v 1.0\n" }, ignore_all), ParserError);
+
+    // the scratch buffers of the parser come from the configured resource
+    std::pmr::monotonic_buffer_resource arena;
+    Recorder                            scratch;
+    obj::parse_as_obj(source, scratch, { .memory_resource = &arena });
+    EXPECT_EQ(scratch.statements, expected);
+}
+
+
+GTEST_TEST(ObjParser, StreamParser)
+{
+    std::stringstream s{};
+    s << "# streamed source\n"
+      << "o streamed\n";
+    for (auto i = 0; i < 50; ++i)
+        s << "v " << i << ".5 -1.25 2e-3\n"
+          << "vt 0.25 0.75   # comment\n"
+          << "f " << i + 1 << "/1/ " << i + 1 << "/1/ " << i + 1 << "/1/\n";
+    s << "vn 0.0 0.0 1.0"; // no line feed at the end
+    const auto source   = s.str();
+    const auto expected = obj::parse_as_obj(source);
+
+    std::mt19937 rng{ 7 };
+    for (const auto max_block : { 1, 2, 7, 64, 4096 })
+    {
+        ObjParserResult<>  result;
+        ObjResultBuilder<> builder{ result };
+        ObjStreamParser<>  parser{ builder };
+
+        std::uniform_int_distribution block{ 1, max_block };
+        for (std::size_t pos = 0; pos < std::size(source);)
+        {
+            const auto n = std::min<std::size_t>(block(rng), std::size(source) - pos);
+            parser.feed(std::string_view{ source }.substr(pos, n));
+            pos += n;
+        }
+        parser.finish();
+
+        EXPECT_EQ(result.data.v, expected.data.v);
+        EXPECT_EQ(result.data.vn, expected.data.vn);
+        EXPECT_EQ(result.data.vt, expected.data.vt);
+        EXPECT_EQ(result.data.faces, expected.data.faces);
+        EXPECT_EQ(result.objects, expected.objects);
+    }
+
+    // errors are located in the whole stream, rather than in the block that completes their line
+    ObjVisitor<>      ignore_all;
+    ObjStreamParser<> located{ ignore_all };
+    located.feed("v 1 2 3\nv 4 5");
+    try
+    {
+        located.feed(" 6\nvn 0 1\n");
+        ADD_FAILURE() << "Invalid statement not reported";
+    }
+    catch (const ParserError& e)
+    {
+        const ParserErrorReport expected_error{ 3, 1, 16, ParserErrorCode::tag_vn_invalid_args_count };
+        EXPECT_STREQ(e.what(), ParserError{ expected_error }.what());
+    }
+
+    // the last line ends at the end of the input, not at a string terminator
+    constexpr char    terminated_source[] = "v 1 2 3\nv 4\0 5 6";
+    ObjStreamParser<> terminated{ ignore_all };
+    terminated.feed(std::string_view{ terminated_source, sizeof(terminated_source) - 1 });
+    EXPECT_THROW(terminated.finish(), ParserError);
+}
+
+
+GTEST_TEST(ObjParser, TryParse)
+{
+    const std::string valid = "o cube\n"
+                              "v 1.0 2.0 3.0\n"
+                              "v 4.0 5.0 6.0\n"
+                              "v 7.0 8.0 9.0\n"
+                              "f 1// 2// 3//\n";
+    const auto parsed = obj::try_parse(valid);
+    ASSERT_TRUE(std::holds_alternative<ObjParserResult<>>(parsed));
+    EXPECT_EQ(std::get<ObjParserResult<>>(parsed).data.faces, obj::parse_as_obj(valid).data.faces);
+
+    const std::string invalid = "v 1.0 2.0 3.0\n"
+                                "v 1.0 2.0 3.0x\n"
+                                "  vn 0.0 1.0\n"
+                                "v 1.0 2.0 3.0\n"
+                                "unknown 1\n"
+                                "f 1// 2// 4//\n"
+                                "o a\n"
+                                "o a\n";
+    const auto first = obj::try_parse(invalid);
+    ASSERT_TRUE(std::holds_alternative<ParserErrorReport>(first));
+    const auto& report = std::get<ParserErrorReport>(first);
+    EXPECT_EQ(report.code(), ParserErrorCode::invalid_arg_format);
+    EXPECT_EQ(report.line(), 2);
+    EXPECT_EQ(report.column(), 11);
+    EXPECT_EQ(report.char_index(), 24);
+
+    for (const auto threads : { 1, 3 })
+    {
+        const ObjParserConfig config{ .thread_count = static_cast<std::size_t>(threads), .min_chunk_size = 1 };
+
+        const auto [result, errors] = obj::try_force_parse(invalid, config);
+        const std::vector<std::tuple<ParserErrorCode, std::size_t, std::size_t>> expected = {
+            { ParserErrorCode::invalid_arg_format, 2, 11 },
+            { ParserErrorCode::tag_vn_invalid_args_count, 3, 3 },
+            { ParserErrorCode::unknown_tag, 5, 1 },
+        };
+        ASSERT_GE(std::size(errors), std::size(expected)) << threads;
+        for (std::size_t i = 0; i < std::size(expected); ++i)
+            EXPECT_EQ(std::make_tuple(errors[i].code(), errors[i].line(), errors[i].column()), expected[i]);
+        ASSERT_EQ(std::size(errors), 4);
+        EXPECT_EQ(std::make_tuple(errors[3].code(), errors[3].line(), errors[3].column()),
+            std::make_tuple(ParserErrorCode::duplicate_object_name, 8, 1));
+
+        // invalid elements are still declared, so that faces refer to the same ones as in the source
+        ASSERT_EQ(std::size(result.data.v), 3);
+        ASSERT_EQ(std::size(result.data.vn), 1);
+        EXPECT_EQ(result.data.v[1], (Vertex<>{ 0, 0, 0, 1 }));
+        ASSERT_EQ(std::size(result.data.faces), 1);
+        EXPECT_EQ(result.data.faces[0].triplets[2].v, 4);
+        EXPECT_EQ(std::size(result.objects), 1);
+
+        const auto soa = obj::try_parse_soa(invalid, config);
+        ASSERT_TRUE(std::holds_alternative<ParserErrorReport>(soa));
+        EXPECT_EQ(std::get<ParserErrorReport>(soa).line(), 2);
+        EXPECT_EQ(std::size(std::get<1>(obj::try_force_parse_soa(invalid, config))), 4);
+    }
+
+    // indices are checked after parsing, the error is still located at the face
+    for (const auto threads : { 1, 3 })
+    {
+        const auto unchecked = obj::try_force_parse(invalid,
+            { .zero_based_indices = true, .thread_count = static_cast<std::size_t>(threads), .min_chunk_size = 1 });
+        ASSERT_EQ(std::size(std::get<1>(unchecked)), 5);
+        const auto& index = std::get<1>(unchecked).back();
+        EXPECT_EQ(std::make_tuple(index.code(), index.line(), index.column()),
+            std::make_tuple(ParserErrorCode::index_out_of_range, 6, 1));
+    }
+
+    ObjVisitor<> ignore_all;
+    EXPECT_FALSE(obj::try_parse(valid, ignore_all));
+    const auto invalid_character = obj::try_parse("v 1.0 2.0 3.0\nv 1.0 2.0\x01 3.0\n", ignore_all);
+    ASSERT_TRUE(invalid_character);
+    EXPECT_EQ(invalid_character->code(), ParserErrorCode::invalid_character);
+    EXPECT_EQ(invalid_character->line(), 2);
+    EXPECT_EQ(invalid_character->column(), 10);
+
+    // a string terminator inside the source is an invalid character, rather than the end of the input
+    constexpr char    terminated_source[] = "v 1.0 2.0 3.0\nv 1.0\0 2.0 3.0\nv 4.0 5.0 6.0\nf -1// -2// -2//\n";
+    const std::string terminated{ terminated_source, sizeof(terminated_source) - 1 };
+
+    const auto terminator = obj::try_parse(terminated, ignore_all);
+    ASSERT_TRUE(terminator);
+    EXPECT_EQ(std::make_tuple(terminator->code(), terminator->line(), terminator->column()),
+        std::make_tuple(ParserErrorCode::invalid_character, 2, 6));
+    for (const auto threads : { 1, 3 })
+    {
+        const auto [result, errors] = obj::try_force_parse(terminated,
+            { .thread_count = static_cast<std::size_t>(threads), .min_chunk_size = 1 });
+        ASSERT_EQ(std::size(errors), 1) << threads;
+        EXPECT_EQ(std::make_tuple(errors[0].code(), errors[0].line(), errors[0].column()),
+            std::make_tuple(ParserErrorCode::invalid_character, 2, 6));
+        EXPECT_EQ(result.data.v, (std::vector<Vertex<>>{ { 1, 2, 3, 1 }, { 4, 5, 6, 1 } }));
+        EXPECT_EQ(result.data.faces, (std::vector<Face<>>{ { 2, 0, 0,   1, 0, 0,   1, 0, 0 } }));
+    }
+}
+
+
+GTEST_TEST(ObjParser, RecoveredParallelMatchesSerial)
+{
+    // lines with invalid characters aren't declared, while other invalid elements are,
+    // so relative indices must resolve to the same elements in every chunk
+    std::stringstream s{};
+    for (auto i = 0; i < 200; ++i)
+    {
+        s << "v " << i << ".0 0.0 0.0\n";
+        if (i % 7 == 0)
+            s << "v 1.0 2.0\x01 3.0\n";
+        if (i % 11 == 0)
+            s << "vt 0.5\t0.5\n";
+        if (i % 13 == 0)
+            s << "v 1.0 2.0 3.0x\n";
+        s << "vt 0.25 0.75\n";
+        if (i >= 2)
+            s << "f -1/-1/ -2/-2/ -3/-3/\n";
+    }
+    const auto source           = s.str();
+    const auto [serial, errors] = obj::try_force_parse(source);
+    ASSERT_EQ(std::size(serial.data.faces), 198);
+    ASSERT_FALSE(std::empty(errors));
+
+    for (const auto threads : { 2, 5 })
+    {
+        const ObjParserConfig config{ .thread_count = static_cast<std::size_t>(threads), .min_chunk_size = 1 };
+
+        const auto [parallel, parallel_errors] = obj::try_force_parse(source, config);
+        EXPECT_EQ(parallel.data.v, serial.data.v) << threads;
+        EXPECT_EQ(parallel.data.vt, serial.data.vt) << threads;
+        EXPECT_EQ(parallel.data.faces, serial.data.faces) << threads;
+        EXPECT_EQ(std::size(parallel_errors), std::size(errors)) << threads;
+    }
+}
+
+GTEST_TEST(ObjParser, SmoothingGroups)
+{
+    std::stringstream s{};
+    s << "v 0.0 0.0 0.0\nv 1.0 0.0 0.0\nv 0.0 1.0 0.0\n"
+      << "f 1// 2// 3//\n"; // face before any group
+    for (auto i = 0; i < 40; ++i)
+    {
+        s << "s " << (i % 4 == 0 ? std::string{ "off" } : std::to_string(i % 3)) << '\n';
+        if (i % 5 != 0) // some groups have no faces
+            s << "f 1// 2// 3//\nf 3// 2// 1//\n";
+    }
+    const auto source = s.str();
+
+    const auto serial = obj::parse_as_obj(source);
+    ASSERT_FALSE(std::empty(serial.smoothing_groups));
+    EXPECT_EQ(serial.smoothing_groups[0], (SmoothingGroup<>{ 1, 1 }));
+    for (std::size_t i = 1; i < std::size(serial.smoothing_groups); ++i)
+    {
+        EXPECT_LT(serial.smoothing_groups[i - 1].first_face, serial.smoothing_groups[i].first_face);
+        EXPECT_NE(serial.smoothing_groups[i - 1].id, serial.smoothing_groups[i].id);
+    }
+
+    for (const auto threads : { 2, 3, 7, 64 })
+    {
+        const ObjParserConfig config{ .thread_count = static_cast<std::size_t>(threads), .min_chunk_size = 1 };
+        EXPECT_EQ(obj::parse_as_obj(source, config).smoothing_groups, serial.smoothing_groups) << threads;
+        EXPECT_EQ(obj::parse_as_obj_soa(source, config).smoothing_groups,
+            obj::parse_as_obj_soa(source).smoothing_groups) << threads;
+    }
+
+    EXPECT_THROW(auto _ = obj::parse_as_obj(std::string{ "s smooth\n" }), ParserError);
+    EXPECT_THROW(auto _ = obj::parse_as_obj(std::string{ "s 1 2\n" }), ParserError);
+}
+
+namespace
+{
+    // forwards to the heap, counting the allocations
+    class CountingResource : public std::pmr::memory_resource
+    {
+    public:
+        std::atomic<std::size_t> allocations = 0; // chunks parsed by other threads use it as well
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+        {
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    };
+}
+
+GTEST_TEST(ObjParser, MemoryResource)
+{
+    std::stringstream s{};
+    for (auto o = 0; o < 20; ++o)
+    {
+        s << "o object_with_a_long_name_" << o << "\ns " << o % 2 << '\n';
+        for (auto i = 0; i < 10; ++i)
+            s << "v " << o << ".0 " << i << ".0 1.5\nvn 0.0 1.0 0.0\nvt 0.25 0.75\n"
+              << "f " << i + 1 << "/1/1 " << i + 2 << "/2/1 " << i + 3 << "/3/1 " << i + 4 << "/4/1\n";
+    }
+    const auto source = s.str();
+    const auto serial = obj::parse_as_obj(source);
+
+    // nothing is taken from the default resource once another one is set
+    CountingResource fallback;
+    const auto       previous = std::pmr::set_default_resource(&fallback);
+    for (const auto threads : { 1, 3 })
+    {
+        std::pmr::monotonic_buffer_resource arena{ std::pmr::new_delete_resource() };
+        const ObjParserConfig               config{ .keep_polygons   = true,
+                          .thread_count    = static_cast<std::size_t>(threads),
+                          .min_chunk_size  = (threads == 1) ? std::size_t{ 1 } << 20 : 1,
+                          .memory_resource = &arena };
+
+        const auto dom = obj::parse_as_obj(source, config);
+        EXPECT_EQ(dom.data.v.get_allocator().resource(), &arena);
+        EXPECT_EQ(dom.data.faces.get_allocator().resource(), &arena);
+        EXPECT_EQ(dom.polygons.triplets.get_allocator().resource(), &arena);
+        EXPECT_EQ(dom.smoothing_groups.get_allocator().resource(), &arena);
+        for (const auto& o : dom.objects)
+        {
+            EXPECT_EQ(o.name.get_allocator().resource(), &arena);
+            EXPECT_EQ(o.faces.get_allocator().resource(), &arena);
+        }
+        EXPECT_EQ(dom.data.faces, serial.data.faces);
+        EXPECT_EQ(dom.objects, serial.objects);
+
+        const auto soa = obj::parse_as_obj_soa(source, config);
+        EXPECT_EQ(soa.data.uv.get_allocator().resource(), &arena);
+        EXPECT_EQ(soa.data.vn_indices.get_allocator().resource(), &arena);
+
+        if (threads == 1) // chunks parsed by other threads use the default resource
+        {
+            EXPECT_EQ(fallback.allocations, 0);
+        }
+    }
+    std::pmr::set_default_resource(previous);
+}
+
+GTEST_TEST(ObjParser, ReusedStorage)
+{
+    const auto source = [](int objects) {
+        std::stringstream s{};
+        for (auto o = 0; o < objects; ++o)
+        {
+            s << "o object_with_a_long_name_" << o << "\ns " << o % 2 << '\n';
+            for (auto i = 0; i < 10; ++i)
+                s << "v " << o << ".0 " << i << ".0 1.5\nvn 0.0 1.0 0.0\nvt 0.25 0.75\n"
+                  << "f " << i + 1 << "/1/1 " << i + 2 << "/2/1 " << i + 3 << "/3/1 " << i + 4 << "/4/1 "
+                  << i + 5 << "/5/1\n";
+        }
+        return s.str();
+    };
+    const auto large = source(20), small = source(12);
+
+    CountingResource         upstream;
+    obj::ObjParser<>         parser{ { .memory_resource = &upstream } };
+    const ObjParserResult<>& first = parser.parse(large);
+    EXPECT_EQ(first.data.faces, obj::parse_as_obj(large).data.faces);
+    EXPECT_EQ(first.objects, obj::parse_as_obj(large).objects);
+    EXPECT_GT(upstream.allocations, 0);
+
+    // sources that fit the storage of the previous ones don't allocate
+    const std::size_t allocations = upstream.allocations;
+    for (const auto& s : { small, large, small })
+    {
+        const auto& result = parser.parse(s);
+        EXPECT_EQ(result.data.v, obj::parse_as_obj(s).data.v);
+        EXPECT_EQ(result.objects, obj::parse_as_obj(s).objects);
+        EXPECT_EQ(result.smoothing_groups, obj::parse_as_obj(s).smoothing_groups);
+    }
+    EXPECT_EQ(upstream.allocations, allocations);
+
+    const auto error = parser.try_parse("v 1.0 2.0 3.0\nf 1// 2//\n");
+    ASSERT_TRUE(error);
+    EXPECT_EQ(error->line(), 2);
+    EXPECT_EQ(std::size(parser.parse(small).objects), 12);
+
+    // chunks are merged into the same storage, while the other threads use the default resource
+    CountingResource pooled;
+    obj::ObjParser<> parallel{ { .thread_count = 3, .min_chunk_size = 1, .memory_resource = &pooled } };
+    EXPECT_EQ(parallel.parse(large).data.faces, obj::parse_as_obj(large).data.faces);
+    const std::size_t merged   = pooled.allocations;
+    const auto        capacity = parallel.result().data.faces.capacity();
+    for (const auto& s : { small, large, small })
+    {
+        const auto& result = parallel.parse(s);
+        EXPECT_EQ(result.data.faces, obj::parse_as_obj(s).data.faces);
+        EXPECT_EQ(result.objects, obj::parse_as_obj(s).objects);
+        EXPECT_EQ(result.data.faces.capacity(), capacity);
+    }
+    EXPECT_EQ(pooled.allocations, merged);
+}
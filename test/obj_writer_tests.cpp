@@ -0,0 +1,124 @@
+#include "obj-cpp/mtl_parser.hpp"
+#include "obj-cpp/obj_parser.hpp"
+#include "obj-cpp/obj_writer.hpp"
+#include "obj-cpp/reader.hpp"
+
+#include "grid.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <filesystem>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+using namespace obj;
+
+namespace
+{
+    template <class Result>
+    void _expect_same_result(const Result& a, const Result& b)
+    {
+        EXPECT_EQ(a.data.v, b.data.v);
+        EXPECT_EQ(a.data.vn, b.data.vn);
+        EXPECT_EQ(a.data.vt, b.data.vt);
+        EXPECT_EQ(a.data.faces, b.data.faces);
+        EXPECT_EQ(a.objects, b.objects);
+        EXPECT_EQ(a.smoothing_groups, b.smoothing_groups);
+        EXPECT_EQ(a.polygons, b.polygons);
+    }
+} // namespace
+
+GTEST_TEST(ObjWriter, Format)
+{
+    const std::string source = "v 1 2 3\nv 0.1 -2.5 1e-07 0.5\nvn 0 0 1\nvt 0.25 0.75\nvt 1 0 0.5\n"
+                               "f 1/1/1 2/2/1 1//1\n"
+                               "o first\ns 1\nf 2// 1// 2/1/\n";
+    const auto result = obj::parse_as_obj(source);
+    EXPECT_EQ(obj::format_obj(result), "v 1 2 3\nv 0.1 -2.5 1e-07 0.5\nvn 0 0 1\nvt 0.25 0.75\nvt 1 0 0.5\n"
+                                       "f 1/1/1 2/2/1 1//1\n"
+                                       "o first\ns 1\nf 2// 1// 2/1/\n");
+
+    // mesh data alone, with zero-based indices where the missing ones wrap around
+    auto zero_based = result;
+    normalize_indices(zero_based.data);
+    EXPECT_EQ(obj::format_obj(zero_based.data, { .zero_based_indices = true }),
+        "v 1 2 3\nv 0.1 -2.5 1e-07 0.5\nvn 0 0 1\nvt 0.25 0.75\nvt 1 0 0.5\n"
+        "f 1/1/1 2/2/1 1//1\nf 2// 1// 2/1/\n");
+
+    auto invalid = result;
+    invalid.objects[0].faces.push_back(7);
+    EXPECT_THROW(auto _ = obj::format_obj(invalid), std::out_of_range);
+
+    // smoothing ends again for a face that precedes the first 's' statement
+    auto reordered = obj::parse_as_obj(std::string{ "v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1// 2// 3//\ns 1\no a\nf 3// 2// 1//\n" });
+    reordered.objects[0].faces.push_back(0);
+    EXPECT_EQ(obj::format_obj(reordered), "v 0 0 0\nv 1 0 0\nv 0 1 0\n"
+                                          "o a\ns 1\nf 3// 2// 1//\ns off\nf 1// 2// 3//\n");
+}
+
+GTEST_TEST(ObjWriter, Unwritable)
+{
+    // values and names the parser would not read back
+    const auto result = obj::parse_as_obj(std::string{ "v 0 0 0\nv 1 0 0\nv 0 1 0\no a\nf 1// 2// 3//\n" });
+    for (const auto value : { std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::infinity() })
+    {
+        auto invalid        = result;
+        invalid.data.v[1].y = value;
+        EXPECT_THROW(auto _ = obj::format_obj(invalid), std::invalid_argument);
+    }
+    for (const auto name : { "", "two words", "a#b" })
+    {
+        auto invalid            = result;
+        invalid.objects[0].name = name;
+        EXPECT_THROW(auto _ = obj::format_obj(invalid), std::invalid_argument);
+    }
+}
+
+GTEST_TEST(ObjWriter, RoundTrip)
+{
+    // values that need every significant digit, with objects, smoothing groups and polygons
+    constexpr auto size = 200;
+
+    const auto source = obj_test::grid(
+        size, [](auto& s, int x, int y) {
+            s << "v " << x / 3.0 << ' ' << std::sin(x * y * 0.001) * 1e-5 << ' ' << -y * 1e6 / 7 << '\n'
+              << "vt " << x * 0.01 << ' ' << y * 0.01 << '\n';
+        },
+        "vn 0 0 1\ns off\n", [](auto& s, int i, int x, int y) {
+            if (x == 0 && y % 50 == 0)
+                s << "o row" << y << "\ns " << y / 50 << '\n';
+            s << "f " << i << '/' << i << "/1 " << i + 1 << '/' << i + 1 << "/1 " << i + size + 1 << "//1";
+            s << ((x % 3 == 0) ? " " + std::to_string(i + size) + "//\n" : "\n");
+        }) + "o empty\ns 3\n";
+
+    for (const auto keep_polygons : { false, true })
+    {
+        const ObjParserConfig config{ .keep_polygons = keep_polygons };
+        const auto            single = obj::parse_as_obj<float, std::uint32_t>(source, config);
+        const auto            doubles = obj::parse_as_obj<double, std::uint32_t>(source, config);
+
+        const auto text = obj::format_obj(single);
+        _expect_same_result(obj::parse_as_obj<float, std::uint32_t>(text, config), single);
+        _expect_same_result(obj::parse_as_obj<double, std::uint32_t>(obj::format_obj(doubles), config), doubles);
+        for (const auto threads : obj_test::thread_counts)
+            EXPECT_EQ(obj::format_obj(single, { .thread_count = threads }), text);
+    }
+
+    // written to a file, in chunks
+    const auto path   = std::filesystem::temp_directory_path() / "obj-cpp-writer.obj";
+    const auto result = obj::parse_as_obj(source);
+    Writer{ { .thread_count = 4 } }.save(result, path);
+    _expect_same_result(Reader{}.load(path), result);
+    std::filesystem::remove(path);
+}
+
+GTEST_TEST(ObjWriter, Materials)
+{
+    const std::string source = "newmtl first\nKa 0.1 0.2 0.3\nKd 1 1 1\nKs 0 0.5 0\nnewmtl second\n";
+    const auto        result = obj::parse_as_mtl(source);
+    EXPECT_EQ(obj::format_mtl(result),
+        "newmtl first\nKa 0.1 0.2 0.3\nKd 1 1 1\nKs 0 0.5 0\nnewmtl second\nKa 0.2 0.2 0.2\nKd 0.8 0.8 0.8\nKs 1 1 1\n");
+    EXPECT_EQ(obj::parse_as_mtl(obj::format_mtl(result)).materials, result.materials);
+}
@@ -1,9 +1,18 @@
 #include "obj-cpp/reader.hpp"
 
+#include "containers.hpp"
+
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
 #include <fstream>
 #include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace obj;
 
@@ -22,7 +31,7 @@ GTEST_TEST(Reader, AssetFiles)
     // TODO: enable 'ArrayInitializerAlignmentStyle' option
     //  when clang-format 13 is supported by VS.
 
-    const std::vector<Vertex> v = {
+    const std::vector<Vertex<>> v = {
         // clang-format off
         {  1,  1, -1, 1 },
         {  1, -1, -1, 1 },
@@ -37,7 +46,7 @@ GTEST_TEST(Reader, AssetFiles)
     EXPECT_EQ(std::size(dom.data.v), std::size(v));
     EXPECT_EQ(dom.data.v, v);
 
-    const std::vector<Normal> vn = {
+    const std::vector<Normal<>> vn = {
         // clang-format off
         {  0.0,  1.0,  0.0 },
         {  0.0,  0.0,  1.0 },
@@ -50,7 +59,7 @@ GTEST_TEST(Reader, AssetFiles)
     EXPECT_EQ(std::size(dom.data.vn), 6);
     EXPECT_EQ(dom.data.vn, vn);
 
-    const std::vector<Texcoord> vt = {
+    const std::vector<Texcoord<>> vt = {
         { 0.875000, 0.500000, 0 },
         { 0.625000, 0.750000, 0 },
         { 0.625000, 0.500000, 0 },
@@ -69,7 +78,7 @@ GTEST_TEST(Reader, AssetFiles)
     EXPECT_EQ(std::size(dom.data.vt), std::size(vt));
     EXPECT_EQ(dom.data.vt, vt);
 
-    const std::vector<Face> faces = {
+    const std::vector<Face<>> faces = {
         // clang-format off
         { 5,  1, 1,     3,  2, 1,    1,  3, 1 },
         { 3,  2, 2,     8,  4, 2,    4,  5, 2 },
@@ -87,4 +96,136 @@ GTEST_TEST(Reader, AssetFiles)
     };
     EXPECT_EQ(std::size(dom.data.faces), std::size(faces));
     EXPECT_EQ(dom.data.faces, faces);
-}
\ No newline at end of file
+}
+
+GTEST_TEST(Reader, MappedFile)
+{
+    std::ifstream file{ "cube.obj" };
+    ASSERT_TRUE(file);
+    std::stringstream source{};
+    source << file.rdbuf();
+
+    const obj::MappedFile mapped{ "cube.obj" };
+    EXPECT_EQ(mapped.view(), source.str());
+    EXPECT_EQ(mapped.data()[mapped.size()], '\0');
+
+    obj::Reader reader{};
+    const auto  dom = reader.load("cube.obj");
+    EXPECT_EQ(dom.data.v, obj::parse_as_obj(source.str()).data.v);
+    EXPECT_EQ(dom.data.faces, obj::parse_as_obj(source.str()).data.faces);
+
+    obj::ObjParser<> parser{};
+    EXPECT_EQ(parser.load("cube.obj").data.faces, dom.data.faces);
+    EXPECT_EQ(parser.load("cube.obj").objects, dom.objects);
+
+    EXPECT_THROW(obj::MappedFile{ "missing.obj" }, std::system_error);
+}
+
+GTEST_TEST(Reader, MappedFilePageMultiple)
+{
+    // a multiple of every common page size leaves no room for the terminator in the last page
+    const auto  path = std::filesystem::temp_directory_path() / "obj-cpp-page-multiple.obj";
+    std::string content;
+    std::size_t vertices = 0;
+    for (; std::size(content) < 65536 - 16; ++vertices)
+        content += "v 1.0 2.0 3.0\n";
+    content += std::string(65536 - std::size(content) - 1, '#') + '\n';
+    {
+        std::ofstream out{ path, std::ios::binary };
+        out << content;
+    }
+
+    {
+        const obj::MappedFile mapped{ path };
+        ASSERT_EQ(mapped.size(), 65536);
+        EXPECT_EQ(mapped.view(), content);
+        EXPECT_EQ(mapped.data()[mapped.size()], '\0');
+
+        const auto dom = obj::Reader{}.load(path);
+        EXPECT_EQ(std::size(dom.data.v), vertices);
+    }
+    std::filesystem::remove(path);
+}
+
+GTEST_TEST(Reader, Cache)
+{
+    const auto directory = std::filesystem::temp_directory_path();
+    const auto source    = directory / "obj-cpp-cache.obj";
+    const auto cache     = directory / "obj-cpp-cache.obj.cache";
+    std::filesystem::remove(cache);
+    {
+        std::ofstream out{ source, std::ios::binary };
+        out << "v 1.0 2.0 3.0\nv 4.0 5.0 6.0\nv 7.0 8.0 9.0\nvn 0.0 1.0 0.0\nvt 0.5 0.5\n"
+            << "f 1/1/1 2/1/1 3/1/1\n"
+            << "o first\nf 3//1 2//1 1//1\nf 1// 2// 3//\n"
+            << "o second\ns 2\nf 2/1/ 3/1/ 1/1/\ns off\nf 1// 2// 3// 1//\n";
+    }
+    const ObjParserConfig config{ .keep_polygons = true };
+    const auto            parsed = obj::parse_as_obj(std::string_view{ MappedFile{ source }.view() }, config);
+
+    obj::Reader reader{ config };
+    {
+        const auto loaded = reader.load_cached(source);
+        ASSERT_TRUE(std::filesystem::exists(cache));
+        EXPECT_TRUE(std::ranges::equal(loaded.v(), parsed.data.v));
+        EXPECT_TRUE(std::ranges::equal(loaded.vn(), parsed.data.vn));
+        EXPECT_TRUE(std::ranges::equal(loaded.vt(), parsed.data.vt));
+        EXPECT_TRUE(std::ranges::equal(loaded.faces(), parsed.data.faces));
+        ASSERT_EQ(loaded.object_count(), 2);
+        EXPECT_EQ(loaded.object(1).name, "second");
+        EXPECT_TRUE(std::ranges::equal(loaded.object(1).faces, parsed.objects[1].faces));
+    }
+
+    { // padding bytes are written as zeros
+        const MeshCache<> loaded{ cache, config };
+        for (const auto& n : loaded.vn())
+        {
+            const auto bytes = reinterpret_cast<const char*>(&n);
+            EXPECT_TRUE(std::all_of(bytes + 3 * sizeof(float), bytes + sizeof(n), [](char c) { return c == 0; }));
+        }
+    }
+
+    { // concurrent writers of the same cache use different temporary files
+        std::vector<std::thread> writers;
+        for (auto i = 0; i < 4; ++i)
+            writers.emplace_back([&] { write_cache(parsed, cache, config); });
+        for (auto& w : writers)
+            w.join();
+        EXPECT_EQ(MeshCache<>(cache, config).to_result().objects, parsed.objects);
+        for (const auto& entry : std::filesystem::directory_iterator{ directory })
+            EXPECT_EQ(entry.path().filename().string().find("obj-cpp-cache.obj.cache.tmp"), std::string::npos);
+    }
+
+    const auto reloaded = reader.load_cached(source).to_result();
+    EXPECT_EQ(reloaded.data.v, parsed.data.v);
+    EXPECT_EQ(reloaded.data.faces, parsed.data.faces);
+    EXPECT_EQ(reloaded.objects, parsed.objects);
+    EXPECT_EQ(reloaded.smoothing_groups, parsed.smoothing_groups);
+    EXPECT_EQ(reloaded.polygons, parsed.polygons);
+    EXPECT_EQ(std::size(reloaded.smoothing_groups), 2);
+    EXPECT_EQ(std::size(reloaded.polygons.offsets), 5);
+
+    // a cache written with other parser options is rebuilt
+    {
+        const ObjParserConfig zero_based{ .zero_based_indices = true };
+        EXPECT_THROW(MeshCache(cache, zero_based), CacheError);
+        EXPECT_TRUE(std::ranges::equal(
+            obj::Reader{ zero_based }.load_cached(source).faces(), obj::parse_as_obj(MappedFile{ source }.view(), zero_based).data.faces));
+        EXPECT_THROW(MeshCache{ cache }, CacheError);
+        EXPECT_EQ(reader.load_cached(source).to_result().data.faces, parsed.data.faces);
+    }
+
+    // a damaged cache is rejected and rebuilt from the source file
+    std::filesystem::resize_file(cache, std::filesystem::file_size(cache) - 1);
+    EXPECT_THROW(MeshCache{ cache }, CacheError);
+    EXPECT_EQ(reader.load_cached(source).to_result().objects, parsed.objects);
+
+    // a stale cache is rebuilt from the source file
+    std::filesystem::last_write_time(cache, std::filesystem::last_write_time(source) - std::chrono::hours{ 1 });
+    EXPECT_FALSE(is_cache_fresh(source, cache));
+    EXPECT_EQ(std::size(reader.load_cached(source).v()), 3);
+    EXPECT_TRUE(is_cache_fresh(source, cache));
+
+    std::filesystem::remove(source);
+    std::filesystem::remove(cache);
+}
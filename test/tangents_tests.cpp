@@ -0,0 +1,132 @@
+#include "obj-cpp/normals.hpp"
+#include "obj-cpp/obj_parser.hpp"
+#include "obj-cpp/tangents.hpp"
+
+#include "grid.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+#include <vector>
+
+using namespace obj;
+
+namespace
+{
+    // tangents computed in floating point, compared with exact ones
+    void expect_tangents(const std::vector<Tangent<>>& actual, const std::vector<Tangent<>>& expected)
+    {
+        ASSERT_EQ(std::size(actual), std::size(expected));
+        for (std::size_t i = 0; i < std::size(actual); ++i)
+        {
+            EXPECT_NEAR(actual[i].x, expected[i].x, 1e-6f) << i;
+            EXPECT_NEAR(actual[i].y, expected[i].y, 1e-6f) << i;
+            EXPECT_NEAR(actual[i].z, expected[i].z, 1e-6f) << i;
+            EXPECT_EQ(actual[i].w, expected[i].w) << i;
+        }
+    }
+}
+
+GTEST_TEST(Tangents, Quad)
+{
+    const std::string source = "v 0 0 0\nv 2 0 0\nv 2 1 0\nv 0 1 0\n"
+                               "vt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\n"
+                               "vn 0 0 1\n"
+                               "f 1/1/1 2/2/1 3/3/1 4/4/1\n";
+    const auto result = obj::parse_as_obj(source);
+
+    const auto tangents = obj::generate_tangents(result.data);
+    ASSERT_EQ(std::size(tangents), 6);
+    for (const auto& t : tangents)
+        EXPECT_EQ(t, (Tangent<>{ 1, 0, 0, 1 }));
+
+    // mirrored texture coordinates flip the tangent and the handedness, but not the bitangent
+    auto mirrored = result;
+    for (auto& vt : mirrored.data.vt)
+        vt.u = 1 - vt.u;
+    for (const auto& t : obj::generate_tangents(mirrored.data))
+        EXPECT_EQ(t, (Tangent<>{ -1, 0, 0, -1 }));
+
+    auto zero_based = result;
+    normalize_indices(zero_based.data);
+    EXPECT_EQ(obj::generate_tangents(zero_based.data, { .zero_based_indices = true }), tangents);
+    EXPECT_EQ(obj::generate_tangents(obj::parse_as_obj_soa(source).data), tangents);
+
+    auto invalid = result;
+    invalid.data.faces[1].triplets[0].vt = 5;
+    EXPECT_THROW(auto _ = obj::generate_tangents(invalid.data), std::out_of_range);
+}
+
+GTEST_TEST(Tangents, MikkTSpace)
+{
+    // expected values follow the rules of the MikkTSpace reference implementation
+    constexpr Tangent<> right{ 1, 0, 0, 1 }, left{ -1, 0, 0, -1 }, none{ 1, 0, 0, -1 };
+
+    // a mirrored texture seam splits the vertices it shares, by orientation of the mapping
+    const std::string quad = "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+                             "vt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\n"
+                             "vn 0 0 1\n"
+                             "f 1/1/1 2/2/1 3/3/1 4/4/1\n";
+    const auto seam = obj::parse_as_obj(quad + "v 2 0 0\nv 2 1 0\nf 2/2/1 5/1/1 6/4/1 3/3/1\n");
+    expect_tangents(obj::generate_tangents(seam.data), { right, right, right, right, right, right, left, left, left, left,
+                                                           left, left });
+
+    // a face without texture area takes the tangents of its neighbors, except at its own vertex
+    const auto flat = obj::parse_as_obj(quad + "v 2 0.5 0\nvt 1 0.5\nf 2/2/1 5/5/1 3/3/1\n");
+    expect_tangents(obj::generate_tangents(flat.data), { right, right, right, right, right, right, right, none, right });
+
+    // a degenerate face copies the tangents of the first face at each of its vertices
+    const auto degenerate = obj::parse_as_obj(quad + "v 1 1 0\nvt 0.5 0.5\nf 3/3/1 5/5/1 4/4/1\n");
+    expect_tangents(
+        obj::generate_tangents(degenerate.data), { right, right, right, right, right, right, right, none, right });
+
+    // vertices with equal values are merged, even if written twice; the tangents at the shared
+    // vertices are the average of (1, 0, 0) and the diagonal, both with a right angle at the origin
+    // and an angle of 45 degrees at (0, 1, 0)
+    const std::string fan = "v 0 0 0\nv 1 0 0\nv 0 1 0\nv -1 0 0\nv 0 0 0\n"
+                            "vt 0 0\nvt 1 0\nvt 0 1\nvt -1 1\nvt 0 0\n"
+                            "vn 0 0 1\n"
+                            "f 1/1/1 2/2/1 3/3/1\n";
+    const auto      c = static_cast<float>(std::cos(std::numbers::pi / 8)), s = static_cast<float>(std::sin(std::numbers::pi / 8));
+    const auto      d = static_cast<float>(std::numbers::sqrt2 / 2);
+    const Tangent<> shared{ c, s, 0, 1 }, diagonal{ d, d, 0, 1 };
+    for (const auto* second : { "f 1/1/1 3/3/1 4/4/1\n", "f 5/5/1 3/3/1 4/4/1\n" })
+        expect_tangents(obj::generate_tangents(obj::parse_as_obj(fan + second).data),
+            { shared, right, shared, shared, shared, diagonal });
+}
+
+GTEST_TEST(Tangents, CurvedSurface)
+{
+    // a wavy grid with generated normals
+    constexpr auto size = 300;
+
+    const auto source = obj_test::grid(
+        size, [](auto& s, int x, int y) {
+            s << "v " << x << ' ' << y << ' ' << obj_test::wave(x, y) << '\n'
+              << "vt " << x * 0.01 << ' ' << y * 0.01 << '\n';
+        },
+        "s 1\n", [](auto& s, int i, int, int) {
+            s << "f " << i << '/' << i << "/ " << i + 1 << '/' << i + 1 << "/ " << i + size + 1 << '/'
+              << i + size + 1 << "/ " << i + size << '/' << i + size << "/\n";
+        });
+
+    auto result = obj::parse_as_obj<float, std::uint32_t>(source);
+    obj::generate_normals(result.data, result.smoothing_groups);
+
+    const auto serial = obj::generate_tangents(result.data);
+    ASSERT_EQ(std::size(serial), 3 * std::size(result.data.faces));
+    for (std::size_t i = 0; i < std::size(serial); ++i)
+    {
+        const auto& t = serial[i];
+        const auto& n = result.data.vn[result.data.faces[i / 3].triplets[i % 3].vn - 1];
+        ASSERT_NEAR(t.x * t.x + t.y * t.y + t.z * t.z, 1, 1e-5) << i;
+        ASSERT_NEAR(t.x * n.x + t.y * n.y + t.z * n.z, 0, 1e-5) << i;
+        ASSERT_GT(t.x, 0) << i; // along increasing x, as u
+        ASSERT_EQ(t.w, 1) << i;
+    }
+
+    for (const auto threads : obj_test::thread_counts)
+        EXPECT_EQ(obj::generate_tangents(result.data, { .thread_count = threads }), serial);
+}
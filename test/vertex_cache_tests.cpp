@@ -0,0 +1,191 @@
+#include "obj-cpp/obj_parser.hpp"
+#include "obj-cpp/vertex_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+using namespace obj;
+
+namespace
+{
+    // square grid of vertices with two triangles for each cell, in random order
+    std::string shuffled_grid(int size)
+    {
+        std::stringstream s{};
+        for (auto y = 0; y < size; ++y)
+            for (auto x = 0; x < size; ++x)
+                s << "v " << x << ' ' << y << " 0\n";
+        s << "vn 0 0 1\n";
+
+        std::vector<std::string> faces;
+        for (auto y = 0; y + 1 < size; ++y)
+            for (auto x = 0; x + 1 < size; ++x)
+            {
+                const auto i = std::to_string(y * size + x + 1), j = std::to_string(y * size + x + 2),
+                           k = std::to_string((y + 1) * size + x + 1), l = std::to_string((y + 1) * size + x + 2);
+                faces.push_back("f " + i + "//1 " + j + "//1 " + l + "//1\n");
+                faces.push_back("f " + i + "//1 " + l + "//1 " + k + "//1\n");
+            }
+        std::shuffle(std::begin(faces), std::end(faces), std::mt19937{ 7 });
+        s << "o grid\n";
+        for (const auto& f : faces)
+            s << f;
+        return s.str();
+    }
+}
+
+GTEST_TEST(VertexCache, Analyze)
+{
+    // a strip of quads, where each triangle reuses two vertices of the previous one
+    const std::vector<std::uint32_t> strip = { 0, 1, 2, 1, 3, 2, 2, 3, 4, 3, 5, 4 };
+
+    const auto s = obj::analyze_vertex_cache(strip, 6, 16);
+    EXPECT_EQ(s.transformed, 6);
+    EXPECT_EQ(s.triangles, 4);
+    EXPECT_EQ(s.vertices, 6);
+    EXPECT_DOUBLE_EQ(s.acmr(), 1.5);
+    EXPECT_DOUBLE_EQ(s.atvr(), 1.0);
+
+    // vertices evicted from a cache too small to hold a whole triangle are processed again
+    EXPECT_EQ(obj::analyze_vertex_cache(strip, 6, 1).transformed, 12);
+    EXPECT_EQ(obj::analyze_vertex_cache({}, 0).acmr(), 0);
+}
+
+GTEST_TEST(VertexCache, OptimizeFaces)
+{
+    const auto result = obj::parse_as_obj<float, std::uint32_t>(shuffled_grid(100));
+    const auto before = obj::analyze_vertex_cache(result.data);
+
+    auto       optimized = result;
+    const auto order     = obj::optimize_vertex_cache(optimized.data);
+    const auto after     = obj::analyze_vertex_cache(optimized.data);
+    EXPECT_LT(after.acmr(), 0.8 * before.acmr());
+    EXPECT_EQ(after.vertices, before.vertices);
+
+    // faces are only reordered
+    ASSERT_EQ(std::size(order), std::size(result.data.faces));
+    for (std::size_t i = 0; i < std::size(order); ++i)
+        ASSERT_EQ(optimized.data.faces[i], result.data.faces[order[i]]) << i;
+    auto sorted = order;
+    std::sort(std::begin(sorted), std::end(sorted));
+    for (std::size_t i = 0; i < std::size(sorted); ++i)
+        ASSERT_EQ(sorted[i], i);
+
+    // the same order with the index buffer of the welded mesh
+    auto mesh = obj::weld_vertices(result.data);
+    obj::optimize_vertex_cache(mesh.indices, std::size(mesh.vertices));
+    EXPECT_EQ(obj::analyze_vertex_cache(mesh.indices, std::size(mesh.vertices)).transformed, after.transformed);
+
+    auto soa = obj::parse_as_obj_soa<float, std::uint32_t>(shuffled_grid(100));
+    EXPECT_EQ(obj::optimize_vertex_cache(soa.data), order);
+
+    // object face lists follow the new positions
+    obj::reorder_object_faces(optimized.objects, order);
+    ASSERT_EQ(std::size(optimized.objects), 1);
+    EXPECT_EQ(optimized.objects[0].faces, result.objects[0].faces);
+
+    // parser results keep their smoothing groups consistent, and drop the polygons
+    auto       smoothed = obj::parse_as_obj<float, std::uint32_t>("s 1\n" + shuffled_grid(100) + "s off\nf 1// 2// 102// 101//\n",
+        { .keep_polygons = true });
+    const auto original = smoothed;
+    const auto moved    = obj::optimize_vertex_cache(smoothed);
+    EXPECT_EQ(std::size(smoothed.data.faces), std::size(optimized.data.faces) + 2);
+    EXPECT_TRUE(std::empty(smoothed.polygons.offsets) && std::empty(smoothed.polygons.triplets));
+    EXPECT_EQ(std::size(smoothed.objects[0].faces), std::size(original.objects[0].faces));
+    const auto group_of = [](const auto& groups, std::size_t f) {
+        std::uint32_t g = 0;
+        for (const auto& r : groups)
+            if (r.first_face <= f)
+                g = r.id;
+        return g;
+    };
+    for (std::size_t i = 0; i < std::size(moved); i += 97)
+        ASSERT_EQ(group_of(smoothed.smoothing_groups, i), group_of(original.smoothing_groups, moved[i])) << i;
+    for (std::size_t i = 1; i < std::size(smoothed.smoothing_groups); ++i)
+        ASSERT_NE(smoothed.smoothing_groups[i].id, smoothed.smoothing_groups[i - 1].id);
+
+    std::pmr::vector<Object<std::uint32_t>> objects = { { "first", { 0, 2 } }, { "second", { 1 } } };
+    const std::vector<std::size_t>     swap    = { 2, 1, 0 };
+    obj::reorder_object_faces(objects, swap);
+    EXPECT_EQ(objects[0].faces, (std::pmr::vector<std::uint32_t>{ 0, 2 }));
+    EXPECT_EQ(objects[1].faces, (std::pmr::vector<std::uint32_t>{ 1 }));
+}
+
+GTEST_TEST(VertexCache, OptimizeFetch)
+{
+    const std::string source = "v 0.0 0.0 0.0\n"
+                               "v 1.0 0.0 0.0\n"
+                               "v 2.0 0.0 0.0\n"
+                               "v 3.0 0.0 0.0\n"
+                               "vt 0.0 0.5\n"
+                               "vt 1.0 0.5\n"
+                               "vn 0.0 0.0 1.0\n"
+                               "f 4/2/1 2/1/1 3/1/1\n"
+                               "f 3//1 2//1 4//1\n";
+    const auto result = obj::parse_as_obj(source);
+
+    auto d = result.data;
+    obj::optimize_vertex_fetch(d);
+    std::vector<float> x;
+    for (const auto& v : d.v)
+        x.push_back(v.x);
+    EXPECT_EQ(x, (std::vector<float>{ 3, 1, 2, 0 }));
+    EXPECT_EQ(d.vt, (std::pmr::vector<Texcoord<>>{ result.data.vt[1], result.data.vt[0] }));
+    EXPECT_EQ(d.vn, result.data.vn);
+    EXPECT_EQ(d.faces[0], (Face<>{ { { { 1, 1, 1 }, { 2, 2, 1 }, { 3, 2, 1 } } } }));
+    EXPECT_EQ(d.faces[1], (Face<>{ { { { 3, 0, 1 }, { 2, 0, 1 }, { 1, 0, 1 } } } }));
+
+    // same result with zero-based indices and with structures of arrays
+    auto zero_based = result.data;
+    normalize_indices(zero_based);
+    obj::optimize_vertex_fetch(zero_based, { .zero_based_indices = true });
+    EXPECT_EQ(zero_based.v, d.v);
+    EXPECT_EQ(zero_based.faces[1].triplets[0].v, 2);
+    EXPECT_EQ(zero_based.faces[1].triplets[0].vt, std::numeric_limits<DefaultIndexType>::max());
+
+    auto soa = obj::parse_as_obj_soa(source).data;
+    obj::optimize_vertex_fetch(soa);
+    EXPECT_EQ(soa.x, (std::pmr::vector<float>{ 3, 1, 2, 0 }));
+    EXPECT_EQ(soa.uv, (std::pmr::vector<float>{ 1, 0.5f, 0, 0.5f }));
+    EXPECT_EQ(soa.v_indices, (std::pmr::vector<std::uint32_t>{ 1, 2, 3, 3, 2, 1 }));
+    EXPECT_EQ(soa.vt_indices, (std::pmr::vector<std::uint32_t>{ 1, 2, 2, 0, 0, 0 }));
+
+    // welded vertices in order of first use
+    obj::IndexedMesh<float> mesh{ { { { 0, 0, 0 }, { 0, 0, 1 }, { 0, 0 } },
+                                    { { 1, 0, 0 }, { 0, 0, 1 }, { 1, 0 } },
+                                    { { 2, 0, 0 }, { 0, 0, 1 }, { 1, 1 } } },
+                                  { 2, 0, 2 } };
+    obj::optimize_vertex_fetch(mesh);
+    EXPECT_EQ(mesh.indices, (std::vector<std::uint32_t>{ 0, 1, 0 }));
+    EXPECT_EQ(mesh.vertices[0].position, (std::array<float, 3>{ 2, 0, 0 }));
+    EXPECT_EQ(mesh.vertices[2].position, (std::array<float, 3>{ 1, 0, 0 }));
+    EXPECT_EQ(mesh.vertices[0].texcoord, (std::array<float, 2>{ 1, 1 }));
+
+    // the triplets of the polygons follow the elements they refer to
+    auto polygons = obj::parse_as_obj(source + "f 1/1/1 4/2/1 3// 2//\n", { .keep_polygons = true });
+    auto expected = polygons;
+    obj::optimize_vertex_fetch(polygons);
+    ASSERT_EQ(std::size(polygons.polygons.triplets), std::size(expected.polygons.triplets));
+    for (std::size_t i = 0; i < std::size(expected.polygons.triplets); ++i)
+    {
+        const auto& a = polygons.polygons.triplets[i];
+        const auto& b = expected.polygons.triplets[i];
+        EXPECT_EQ(polygons.data.v[a.v - 1], expected.data.v[b.v - 1]);
+        EXPECT_EQ(a.vt == 0, b.vt == 0);
+        if (a.vt != 0)
+        {
+            EXPECT_EQ(polygons.data.vt[a.vt - 1], expected.data.vt[b.vt - 1]);
+        }
+    }
+    EXPECT_EQ(polygons.data.faces.back().triplets[0], polygons.polygons.triplets[std::size(polygons.polygons.triplets) - 4]);
+
+    auto invalid = result.data;
+    invalid.faces[1].triplets[0].vn = 2;
+    EXPECT_THROW(obj::optimize_vertex_fetch(invalid), std::out_of_range);
+    EXPECT_EQ(invalid.v, result.data.v);
+}
\ No newline at end of file
@@ -0,0 +1,175 @@
+#include "obj-cpp/obj_parser.hpp"
+#include "obj-cpp/welding.hpp"
+
+#include "grid.hpp"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <map>
+#include <random>
+#include <stdexcept>
+
+using namespace obj;
+
+GTEST_TEST(Welding, SharedTriplets)
+{
+    const std::string source = "v 0.0 0.0 0.0\n"
+                               "v 1.0 0.0 0.0\n"
+                               "v 1.0 1.0 0.0\n"
+                               "v 0.0 1.0 0.0\n"
+                               "vt 0.5 0.25\n"
+                               "vn 0.0 0.0 1.0\n"
+                               "f 1/1/1 2/1/1 3/1/1\n"
+                               "f 1/1/1 3/1/1 4//1\n";
+    const auto result = obj::parse_as_obj(source);
+
+    const auto mesh = obj::weld_vertices(result.data);
+    ASSERT_EQ(std::size(mesh.vertices), 4);
+    EXPECT_EQ(mesh.indices, (std::vector<std::uint32_t>{ 0, 1, 2, 0, 2, 3 }));
+    EXPECT_EQ(mesh.vertices[1], (PackedVertex<>{ { 1, 0, 0 }, { 0, 0, 1 }, { 0.5f, 0.25f } }));
+    EXPECT_EQ(mesh.vertices[3], (PackedVertex<>{ { 0, 1, 0 }, { 0, 0, 1 }, { 0, 0 } }));
+
+    auto zero_based = result;
+    normalize_indices(zero_based.data);
+    EXPECT_EQ(obj::weld_vertices(zero_based.data, { .zero_based_indices = true }).vertices, mesh.vertices);
+
+    auto invalid = result;
+    invalid.data.faces[1].triplets[2].vn = 2;
+    EXPECT_THROW(auto _ = obj::weld_vertices(invalid.data), std::out_of_range);
+}
+
+GTEST_TEST(Welding, ParallelMatchesSerial)
+{
+    // a grid with faces in random order
+    constexpr auto size = 300;
+
+    std::vector<std::string> faces;
+    auto                     source = obj_test::grid(
+        size, [](auto& s, int x, int y) { s << "v " << x << ' ' << y << " 0\nvt " << x % 2 << ' ' << y % 2 << '\n'; },
+        "vn 0 0 1\n", [&](auto&, int i, int, int) {
+            faces.push_back("f " + std::to_string(i) + '/' + std::to_string(i) + "/1 " + std::to_string(i + 1) +
+                            '/' + std::to_string(i + 1) + "/1 " + std::to_string(i + size) + "//1\n");
+        });
+    std::shuffle(std::begin(faces), std::end(faces), std::mt19937{ 11 });
+    for (const auto& f : faces)
+        source += f;
+
+    const auto result = obj::parse_as_obj<float, std::uint32_t>(source);
+    const auto serial = obj::weld_vertices(result.data);
+
+    // vertices come in order of first use, each one referenced by the expected triplet
+    std::map<std::tuple<std::uint32_t, std::uint32_t, std::uint32_t>, std::uint32_t> ids;
+    for (std::size_t i = 0; i < std::size(serial.indices); ++i)
+    {
+        const auto& t = result.data.faces[i / 3].triplets[i % 3];
+        const auto [it, inserted] = ids.try_emplace({ t.v, t.vt, t.vn }, static_cast<std::uint32_t>(std::size(ids)));
+        ASSERT_EQ(serial.indices[i], it->second) << i;
+    }
+    ASSERT_EQ(std::size(serial.vertices), std::size(ids));
+
+    for (const auto threads : obj_test::thread_counts)
+    {
+        const WeldConfig config{ .thread_count = threads };
+
+        const auto parallel = obj::weld_vertices(result.data, config);
+        EXPECT_EQ(parallel.indices, serial.indices);
+        EXPECT_EQ(parallel.vertices, serial.vertices);
+
+        const auto soa = obj::weld_vertices(obj::parse_as_obj_soa(source).data, config);
+        EXPECT_EQ(soa.indices, serial.indices);
+        EXPECT_EQ(soa.vertices, serial.vertices);
+    }
+}
+
+GTEST_TEST(Welding, NearbyPositions)
+{
+    const std::string source = "v 0.0 0.0 0.0\n"
+                               "v 1.0 0.0 0.0\n"
+                               "v 0.00001 0.0 0.0\n"
+                               "v 1.0 0.0 0.00002\n"
+                               "v 0.0 1.0 0.0\n"
+                               "v 0.0 1.00003 0.0\n"
+                               "f 1// 2// 5//\n"
+                               "f 3// 4// 6//\n";
+
+    for (const auto threads : { 1, 4 })
+    {
+        auto result = obj::parse_as_obj(source);
+        EXPECT_EQ(obj::weld_positions(result.data, 1e-4f, { .thread_count = static_cast<std::size_t>(threads) }), 3);
+        EXPECT_EQ(result.data.v, (std::pmr::vector<Vertex<>>{ { 0, 0, 0, 1 }, { 1, 0, 0, 1 }, { 0, 1, 0, 1 } }));
+        EXPECT_EQ(result.data.faces[0], result.data.faces[1]);
+        EXPECT_EQ(result.data.faces[1].triplets[2].v, 3);
+    }
+
+    auto exact = obj::parse_as_obj_soa(source + "v 0.0 1.0 0.0\nf 7// 7// 7//\n");
+    EXPECT_EQ(obj::weld_positions(exact.data, 0.f), 1);
+    EXPECT_EQ(exact.data.v_indices.back(), 5);
+
+    auto negative = obj::parse_as_obj(source);
+    EXPECT_THROW(obj::weld_positions(negative.data, -0.5f), std::invalid_argument);
+    EXPECT_THROW(obj::weld_positions(negative.data, std::numeric_limits<float>::quiet_NaN()), std::invalid_argument);
+    EXPECT_EQ(std::size(negative.data.v), 6);
+
+    auto invalid = obj::parse_as_obj(source + "f 1// 2// 9//\n");
+    EXPECT_THROW(obj::weld_positions(invalid.data, 1e-4f), std::out_of_range);
+    EXPECT_EQ(std::size(invalid.data.v), 6);
+}
+
+GTEST_TEST(Welding, Polygons)
+{
+    const std::string source = "v 0.0 0.0 0.0\n"
+                               "v 1.0 0.0 0.0\n"
+                               "v 1.0 1.0 0.0\n"
+                               "v 0.0 1.0 0.0\n"
+                               "v 0.0 0.0 0.0001\n"
+                               "f 1// 2// 3// 5//\n";
+
+    auto result = obj::parse_as_obj(source, { .keep_polygons = true });
+    EXPECT_EQ(obj::weld_positions(result, 0.01f), 1);
+    EXPECT_EQ(std::size(result.data.v), 4);
+    EXPECT_EQ(result.polygons.triplets.back().v, 1);
+    EXPECT_EQ(result.data.faces.back().triplets[2].v, 1);
+
+    auto soa = obj::parse_as_obj_soa(source, { .keep_polygons = true });
+    EXPECT_EQ(obj::weld_positions(soa, 0.01f, { .thread_count = 2 }), 1);
+    EXPECT_EQ(soa.polygons.triplets.back().v, 1);
+
+    auto invalid = obj::parse_as_obj(source, { .keep_polygons = true });
+    invalid.polygons.triplets.back().v = 9;
+    EXPECT_THROW(obj::weld_positions(invalid, 0.01f), std::out_of_range);
+    EXPECT_EQ(std::size(invalid.data.v), 5);
+}
+
+GTEST_TEST(Welding, NoisyGrid)
+{
+    // each grid point is written several times with noise smaller than the tolerance
+    constexpr auto size = 200;
+
+    std::mt19937                          rng{ 3 };
+    std::uniform_real_distribution<float> noise{ -1e-4f, 1e-4f };
+
+    SoaMeshData<> d;
+    for (auto copy = 0; copy < 4; ++copy)
+        for (auto y = 0; y < size; ++y)
+            for (auto x = 0; x < size; ++x)
+            {
+                d.x.push_back(static_cast<float>(x) + noise(rng));
+                d.y.push_back(static_cast<float>(y) + noise(rng));
+                d.z.push_back(noise(rng));
+                d.v_indices.push_back(static_cast<std::uint32_t>(std::size(d.x)));
+            }
+    while (std::size(d.v_indices) % 3 != 0)
+        d.v_indices.push_back(1);
+    d.vt_indices.resize(std::size(d.v_indices));
+    d.vn_indices.resize(std::size(d.v_indices));
+
+    auto serial = d;
+    EXPECT_EQ(obj::weld_positions(serial, 1e-3f), 3 * size * size);
+    for (std::size_t i = 0; i < std::size(d.v_indices); ++i)
+        ASSERT_EQ(serial.v_indices[i], (d.v_indices[i] - 1) % (size * size) + 1) << i;
+
+    auto parallel = d;
+    EXPECT_EQ(obj::weld_positions(parallel, 1e-3f, { .thread_count = 3 }), 3 * size * size);
+    EXPECT_EQ(parallel, serial);
+}